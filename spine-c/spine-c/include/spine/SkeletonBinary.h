@@ -46,6 +46,7 @@ typedef struct spSkeletonBinary {
 	float scale;
 	spAttachmentLoader* attachmentLoader;
 	const char* const error;
+	spCurveMode curveMode; /* How bezier curves are stored in the timelines. Default is SP_CURVE_MODE_SAMPLED. */
 } spSkeletonBinary;
 
 SP_API spSkeletonBinary* spSkeletonBinary_createWithLoader (spAttachmentLoader* attachmentLoader);
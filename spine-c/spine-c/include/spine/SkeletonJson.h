@@ -47,6 +47,7 @@ typedef struct spSkeletonJson {
 	float scale;
 	spAttachmentLoader* attachmentLoader;
 	const char* const error;
+	spCurveMode curveMode; /* How bezier curves are stored in the timelines. Default is SP_CURVE_MODE_SAMPLED. */
 } spSkeletonJson;
 
 SP_API spSkeletonJson* spSkeletonJson_createWithLoader (spAttachmentLoader* attachmentLoader);
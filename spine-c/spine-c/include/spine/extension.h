@@ -122,8 +122,17 @@
 #define ISNAN(A) (int)isnan(A)
 #endif
 
+/* Defining SPINE_TRIG_POLYNOMIAL (or SPINE_TRIG_TABLE, as spine-cpp does) replaces the C library for sine and cosine
+ * in degrees with _spMath_sinCosDeg. SIN_COS_DEG computes both for the same angle. */
+#if defined(SPINE_TRIG_POLYNOMIAL) || defined(SPINE_TRIG_TABLE)
+#define SIN_DEG(A) _spMath_sinDeg(A)
+#define COS_DEG(A) _spMath_cosDeg(A)
+#define SIN_COS_DEG(A,OUT_SIN,OUT_COS) _spMath_sinCosDeg(A, &(OUT_SIN), &(OUT_COS))
+#else
 #define SIN_DEG(A) SIN((A) * DEG_RAD)
 #define COS_DEG(A) COS((A) * DEG_RAD)
+#define SIN_COS_DEG(A,OUT_SIN,OUT_COS) ((OUT_SIN) = SIN_DEG(A), (OUT_COS) = COS_DEG(A))
+#endif
 #define CLAMP(x, min, max) ((x) < (min) ? (min) : ((x) > (max) ? (max) : (x)))
 #ifndef MIN
 #define MIN(x, y) ((x) < (y) ? (x) : (y))
@@ -196,6 +205,9 @@ float _spMath_randomTriangularWith(float min, float max, float mode);
 float _spMath_interpolate(float (*apply) (float a), float start, float end, float a);
 float _spMath_pow2_apply(float a);
 float _spMath_pow2out_apply(float a);
+void _spMath_sinCosDeg(float degrees, float* outSin, float* outCos);
+float _spMath_sinDeg(float degrees);
+float _spMath_cosDeg(float degrees);
 
 /**/
 
@@ -233,9 +245,7 @@ struct _spAnimationState {
 
 	_spEventQueue* queue;
 
-	int* propertyIDs;
-	int propertyIDsCount;
-	int propertyIDsCapacity;
+	spIntSet* propertyIDs;
 
 	int /*boolean*/ animationsChanged;
 
@@ -246,8 +256,6 @@ struct _spAnimationState {
 		events(0),
 		queue(0),
 		propertyIDs(0),
-		propertyIDsCount(0),
-		propertyIDsCapacity(0),
 		animationsChanged(0) {
 	}
 #endif
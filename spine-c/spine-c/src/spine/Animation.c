@@ -104,7 +104,7 @@ int spTimeline_getPropertyId (const spTimeline* self) {
 
 /**/
 
-static const float CURVE_LINEAR = 0, CURVE_STEPPED = 1, CURVE_BEZIER = 2;
+static const float CURVE_LINEAR = 0, CURVE_STEPPED = 1, CURVE_BEZIER = 2, CURVE_BEZIER_UNIFORM = 3;
 static const int BEZIER_SIZE = 10 * 2 - 1;
 
 void _spCurveTimeline_init (spCurveTimeline* self, spTimelineType type, int framesCount, /**/
@@ -152,6 +152,36 @@ void spCurveTimeline_setCurve (spCurveTimeline* self, int frameIndex, float cx1,
 	}
 }
 
+void spCurveTimeline_setCurveWithMode (spCurveTimeline* self, int frameIndex, float cx1, float cy1, float cx2, float cy2,
+	spCurveMode mode
+) {
+	/* The y at percents 0, 1/17, ..., 1. They are used if they follow the curve at least as closely as the sampled points,
+	 * which steep curves need more points for. */
+	float uniform[10 * 2 - 2]; /* BEZIER_SIZE - 1 */
+	float sampledError = 0, uniformError = 0;
+	int i, step, n = BEZIER_SIZE - 2;
+
+	spCurveTimeline_setCurve(self, frameIndex, cx1, cy1, cx2, cy2);
+	if (mode == SP_CURVE_MODE_SAMPLED) return;
+
+	for (i = 0; i <= n; i++)
+		uniform[i] = spCurveTimeline_getBezierPercent(cx1, cy1, cx2, cy2, i / (float)n);
+	for (i = 0; i < n; i++) {
+		for (step = 1; step < 4; step++) {
+			float percent = (i + step * 0.25f) / n, expected = spCurveTimeline_getBezierPercent(cx1, cy1, cx2, cy2, percent);
+			float error = spCurveTimeline_getCurvePercent(self, frameIndex, percent) - expected;
+			error = ABS(error);
+			sampledError = MAX(sampledError, error);
+			error = uniform[i] + (uniform[i + 1] - uniform[i]) * step * 0.25f - expected;
+			error = ABS(error);
+			uniformError = MAX(uniformError, error);
+		}
+	}
+	if (uniformError > sampledError) return;
+	self->curves[frameIndex * BEZIER_SIZE] = CURVE_BEZIER_UNIFORM;
+	memcpy(self->curves + frameIndex * BEZIER_SIZE + 1, uniform, sizeof(float) * (n + 1));
+}
+
 float spCurveTimeline_getCurvePercent (const spCurveTimeline* self, int frameIndex, float percent) {
 	float x, y;
 	int i = frameIndex * BEZIER_SIZE, start, n;
@@ -159,6 +189,14 @@ float spCurveTimeline_getCurvePercent (const spCurveTimeline* self, int frameInd
 	percent = CLAMP(percent, 0, 1);
 	if (type == CURVE_LINEAR) return percent;
 	if (type == CURVE_STEPPED) return 0;
+	if (type == CURVE_BEZIER_UNIFORM) {
+		const float* points;
+		int index;
+		x = percent * (BEZIER_SIZE - 2);
+		index = MIN((int)x, BEZIER_SIZE - 3);
+		points = self->curves + i + 1 + index;
+		return points[0] + (points[1] - points[0]) * (x - index);
+	}
 	i++;
 	x = 0;
 	for (start = i, n = i + BEZIER_SIZE - 1; i < n; i += 2) {
@@ -179,6 +217,38 @@ float spCurveTimeline_getCurvePercent (const spCurveTimeline* self, int frameInd
 	return y + (1 - y) * (percent - x) / (1 - x); /* Last point is 1,1. */
 }
 
+float spCurveTimeline_getBezierPercent (float cx1, float cy1, float cx2, float cy2, float percent) {
+	/* x(t) = ((ax * t + bx) * t + cx) * t, likewise for y. */
+	float cx = 3 * cx1, bx = 3 * (cx2 - cx1) - cx, ax = 1 - cx - bx;
+	float cy = 3 * cy1, by = 3 * (cy2 - cy1) - cy, ay = 1 - cy - by;
+	float t, low = 0, high = 1;
+	int i;
+	percent = CLAMP(percent, 0, 1);
+
+	/* Newton's method usually converges in a few iterations. x(t) is monotonic for handles from 0 to 1, so bisection is
+	 * used when it does not. */
+	t = percent;
+	for (i = 0; i < 8; i++) {
+		float error = ((ax * t + bx) * t + cx) * t - percent, slope;
+		if (ABS(error) < 1e-6f) return ((ay * t + by) * t + cy) * t;
+		slope = (3 * ax * t + 2 * bx) * t + cx;
+		if (ABS(slope) < 1e-6f) break;
+		t -= error / slope;
+		if (t < 0 || t > 1) break;
+	}
+	t = percent;
+	for (i = 0; i < 32; i++) {
+		float x = ((ax * t + bx) * t + cx) * t;
+		if (ABS(x - percent) < 1e-6f) break;
+		if (x < percent)
+			low = t;
+		else
+			high = t;
+		t = (low + high) * 0.5f;
+	}
+	return ((ay * t + by) * t + cy) * t;
+}
+
 /* @param target After the first and before the last entry. */
 static int binarySearch (float *values, int valuesLength, float target, int step) {
 	int low = 0, current;
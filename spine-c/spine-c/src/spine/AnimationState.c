@@ -64,7 +64,6 @@ void _spAnimationState_disposeNext (spAnimationState* self, spTrackEntry* entry)
 void _spAnimationState_animationsChanged (spAnimationState* self);
 float* _spAnimationState_resizeTimelinesRotation(spTrackEntry* entry, int newSize);
 int* _spAnimationState_resizeTimelinesFirst(spTrackEntry* entry, int newSize);
-void _spAnimationState_ensureCapacityPropertyIDs(spAnimationState* self, int capacity);
 int _spAnimationState_addPropertyID(spAnimationState* self, int id);
 void _spTrackEntry_computeHold(spTrackEntry* self, spAnimationState* state);
 
@@ -237,8 +236,7 @@ spAnimationState* spAnimationState_create (spAnimationStateData* data) {
 	internal->queue = _spEventQueue_create(internal);
 	internal->events = CALLOC(spEvent*, 128);
 
-	internal->propertyIDs = CALLOC(int, 128);
-	internal->propertyIDsCapacity = 128;
+	internal->propertyIDs = spIntSet_create(128);
 
 	return self;
 }
@@ -251,7 +249,7 @@ void spAnimationState_dispose (spAnimationState* self) {
 	FREE(self->tracks);
 	_spEventQueue_free(internal->queue);
 	FREE(internal->events);
-	FREE(internal->propertyIDs);
+	spIntSet_dispose(internal->propertyIDs);
 	FREE(internal);
 }
 
@@ -933,7 +931,7 @@ void _spAnimationState_animationsChanged (spAnimationState* self) {
 	spTrackEntry* entry;
 	internal->animationsChanged = 0;
 
-	internal->propertyIDsCount = 0;
+	spIntSet_clear(internal->propertyIDs);
 	i = 0; n = self->tracksCount;
 
 	for (;i < n; i++) {
@@ -958,29 +956,9 @@ float* _spAnimationState_resizeTimelinesRotation(spTrackEntry* entry, int newSiz
 	return entry->timelinesRotation;
 }
 
-void _spAnimationState_ensureCapacityPropertyIDs(spAnimationState* self, int capacity) {
-	_spAnimationState* internal = SUB_CAST(_spAnimationState, self);
-	if (internal->propertyIDsCapacity < capacity) {
-		int *newPropertyIDs = CALLOC(int, capacity << 1);
-		memcpy(newPropertyIDs, internal->propertyIDs, sizeof(int) * internal->propertyIDsCount);
-		FREE(internal->propertyIDs);
-		internal->propertyIDs = newPropertyIDs;
-		internal->propertyIDsCapacity = capacity << 1;
-	}
-}
-
 int _spAnimationState_addPropertyID(spAnimationState* self, int id) {
-	int i, n;
 	_spAnimationState* internal = SUB_CAST(_spAnimationState, self);
-
-	for (i = 0, n = internal->propertyIDsCount; i < n; i++) {
-		if (internal->propertyIDs[i] == id) return 0;
-	}
-
-	_spAnimationState_ensureCapacityPropertyIDs(self, internal->propertyIDsCount + 1);
-	internal->propertyIDs[internal->propertyIDsCount] = id;
-	internal->propertyIDsCount++;
-	return 1;
+	return spIntSet_add(internal->propertyIDs, id);
 }
 
 spTrackEntry* spAnimationState_getCurrent (spAnimationState* self, int trackIndex) {
@@ -30,69 +30,28 @@
 #include <spine/AnimationStateData.h>
 #include <spine/extension.h>
 
-typedef struct _ToEntry _ToEntry;
-struct _ToEntry {
-	spAnimation* animation;
-	float duration;
-	_ToEntry* next;
-};
-
-_ToEntry* _ToEntry_create (spAnimation* to, float duration) {
-	_ToEntry* self = NEW(_ToEntry);
-	self->animation = to;
-	self->duration = duration;
-	return self;
-}
-
-void _ToEntry_dispose (_ToEntry* self) {
-	FREE(self);
-}
-
-/**/
+typedef struct _spMixKey {
+	spAnimation* from;
+	spAnimation* to;
+} _spMixKey;
 
-typedef struct _FromEntry _FromEntry;
-struct _FromEntry {
-	spAnimation* animation;
-	_ToEntry* toEntries;
-	_FromEntry* next;
-};
+#define _spMixKey_hash(key) ((unsigned int)(size_t)(key).from * 31u + (unsigned int)(size_t)(key).to)
+#define _spMixKey_equals(a, b) ((a).from == (b).from && (a).to == (b).to)
 
-_FromEntry* _FromEntry_create (spAnimation* from) {
-	_FromEntry* self = NEW(_FromEntry);
-	self->animation = from;
-	return self;
-}
-
-void _FromEntry_dispose (_FromEntry* self) {
-	FREE(self);
-}
+_SP_HASH_MAP_DECLARE_STATIC_TYPE(_spMixMap, _spMixKey, float)
+_SP_HASH_MAP_IMPLEMENT_STATIC_TYPE(_spMixMap, _spMixKey, float, _spMixKey_hash, _spMixKey_equals)
 
 /**/
 
 spAnimationStateData* spAnimationStateData_create (spSkeletonData* skeletonData) {
 	spAnimationStateData* self = NEW(spAnimationStateData);
 	CONST_CAST(spSkeletonData*, self->skeletonData) = skeletonData;
+	CONST_CAST(void*, self->entries) = _spMixMap_create(16);
 	return self;
 }
 
 void spAnimationStateData_dispose (spAnimationStateData* self) {
-	_ToEntry* toEntry;
-	_ToEntry* nextToEntry;
-	_FromEntry* nextFromEntry;
-
-	_FromEntry* fromEntry = (_FromEntry*)self->entries;
-	while (fromEntry) {
-		toEntry = fromEntry->toEntries;
-		while (toEntry) {
-			nextToEntry = toEntry->next;
-			_ToEntry_dispose(toEntry);
-			toEntry = nextToEntry;
-		}
-		nextFromEntry = fromEntry->next;
-		_FromEntry_dispose(fromEntry);
-		fromEntry = nextFromEntry;
-	}
-
+	_spMixMap_dispose((_spMixMap*)self->entries);
 	FREE(self);
 }
 
@@ -106,45 +65,17 @@ void spAnimationStateData_setMixByName (spAnimationStateData* self, const char*
 }
 
 void spAnimationStateData_setMix (spAnimationStateData* self, spAnimation* from, spAnimation* to, float duration) {
-	/* Find existing FromEntry. */
-	_ToEntry* toEntry;
-	_FromEntry* fromEntry = (_FromEntry*)self->entries;
-	while (fromEntry) {
-		if (fromEntry->animation == from) {
-			/* Find existing ToEntry. */
-			toEntry = fromEntry->toEntries;
-			while (toEntry) {
-				if (toEntry->animation == to) {
-					toEntry->duration = duration;
-					return;
-				}
-				toEntry = toEntry->next;
-			}
-			break; /* Add new ToEntry to the existing FromEntry. */
-		}
-		fromEntry = fromEntry->next;
-	}
-	if (!fromEntry) {
-		fromEntry = _FromEntry_create(from);
-		fromEntry->next = (_FromEntry*)self->entries;
-		CONST_CAST(_FromEntry*, self->entries) = fromEntry;
-	}
-	toEntry = _ToEntry_create(to, duration);
-	toEntry->next = fromEntry->toEntries;
-	fromEntry->toEntries = toEntry;
+	_spMixKey key;
+	key.from = from;
+	key.to = to;
+	_spMixMap_put((_spMixMap*)self->entries, key, duration);
 }
 
 float spAnimationStateData_getMix (spAnimationStateData* self, spAnimation* from, spAnimation* to) {
-	_FromEntry* fromEntry = (_FromEntry*)self->entries;
-	while (fromEntry) {
-		if (fromEntry->animation == from) {
-			_ToEntry* toEntry = fromEntry->toEntries;
-			while (toEntry) {
-				if (toEntry->animation == to) return toEntry->duration;
-				toEntry = toEntry->next;
-			}
-		}
-		fromEntry = fromEntry->next;
-	}
+	_spMixKey key;
+	float duration;
+	key.from = from;
+	key.to = to;
+	if (_spMixMap_get((_spMixMap*)self->entries, key, &duration)) return duration;
 	return self->defaultMix;
 }
@@ -36,3 +36,5 @@ _SP_ARRAY_IMPLEMENT_TYPE(spShortArray, short)
 _SP_ARRAY_IMPLEMENT_TYPE(spUnsignedShortArray, unsigned short)
 _SP_ARRAY_IMPLEMENT_TYPE(spArrayFloatArray, spFloatArray*)
 _SP_ARRAY_IMPLEMENT_TYPE(spArrayShortArray, spShortArray*)
+
+_SP_HASH_SET_IMPLEMENT_TYPE(spIntSet, int, _SP_HASH_INT, _SP_HASH_EQUALS)
@@ -61,7 +61,7 @@ void spBone_updateWorldTransform (spBone* self) {
 }
 
 void spBone_updateWorldTransformWith (spBone* self, float x, float y, float rotation, float scaleX, float scaleY, float shearX, float shearY) {
-	float cosine, sine;
+	float cosine, sine, sinX, cosX, sinY, cosY;
 	float pa, pb, pc, pd;
 	spBone* parent = self->parent;
 	float sx = self->skeleton->scaleX;
@@ -78,10 +78,12 @@ void spBone_updateWorldTransformWith (spBone* self, float x, float y, float rota
 
 	if (!parent) { /* Root bone. */
 		float rotationY = rotation + 90 + shearY;
-		CONST_CAST(float, self->a) = COS_DEG(rotation + shearX) * scaleX * sx;
-		CONST_CAST(float, self->b) = COS_DEG(rotationY) * scaleY * sx;
-		CONST_CAST(float, self->c) = SIN_DEG(rotation + shearX) * scaleX * sy;
-		CONST_CAST(float, self->d) = SIN_DEG(rotationY) * scaleY * sy;
+		SIN_COS_DEG(rotation + shearX, sinX, cosX);
+		SIN_COS_DEG(rotationY, sinY, cosY);
+		CONST_CAST(float, self->a) = cosX * scaleX * sx;
+		CONST_CAST(float, self->b) = cosY * scaleY * sx;
+		CONST_CAST(float, self->c) = sinX * scaleX * sy;
+		CONST_CAST(float, self->d) = sinY * scaleY * sy;
 		CONST_CAST(float, self->worldX) = x * sx + self->skeleton->x;
 		CONST_CAST(float, self->worldY) = y * sy + self->skeleton->y;
 		return;
@@ -97,11 +99,13 @@ void spBone_updateWorldTransformWith (spBone* self, float x, float y, float rota
 
 	switch (self->data->transformMode) {
 	case SP_TRANSFORMMODE_NORMAL: {
-		float rotationY = rotation + 90 + shearY;
-		float la = COS_DEG(rotation + shearX) * scaleX;
-		float lb = COS_DEG(rotationY) * scaleY;
-		float lc = SIN_DEG(rotation + shearX) * scaleX;
-		float ld = SIN_DEG(rotationY) * scaleY;
+		float la, lb, lc, ld;
+		SIN_COS_DEG(rotation + shearX, sinX, cosX);
+		SIN_COS_DEG(rotation + 90 + shearY, sinY, cosY);
+		la = cosX * scaleX;
+		lb = cosY * scaleY;
+		lc = sinX * scaleX;
+		ld = sinY * scaleY;
 		CONST_CAST(float, self->a) = pa * la + pb * lc;
 		CONST_CAST(float, self->b) = pa * lb + pb * ld;
 		CONST_CAST(float, self->c) = pc * la + pd * lc;
@@ -109,11 +113,12 @@ void spBone_updateWorldTransformWith (spBone* self, float x, float y, float rota
 		return;
 	}
 	case SP_TRANSFORMMODE_ONLYTRANSLATION: {
-		float rotationY = rotation + 90 + shearY;
-		CONST_CAST(float, self->a) = COS_DEG(rotation + shearX) * scaleX;
-		CONST_CAST(float, self->b) = COS_DEG(rotationY) * scaleY;
-		CONST_CAST(float, self->c) = SIN_DEG(rotation + shearX) * scaleX;
-		CONST_CAST(float, self->d) = SIN_DEG(rotationY) * scaleY;
+		SIN_COS_DEG(rotation + shearX, sinX, cosX);
+		SIN_COS_DEG(rotation + 90 + shearY, sinY, cosY);
+		CONST_CAST(float, self->a) = cosX * scaleX;
+		CONST_CAST(float, self->b) = cosY * scaleY;
+		CONST_CAST(float, self->c) = sinX * scaleX;
+		CONST_CAST(float, self->d) = sinY * scaleY;
 		break;
 	}
 	case SP_TRANSFORMMODE_NOROTATIONORREFLECTION: {
@@ -133,10 +138,12 @@ void spBone_updateWorldTransformWith (spBone* self, float x, float y, float rota
 		}
 		rx = rotation + shearX - prx;
 		ry = rotation + shearY - prx + 90;
-		la = COS_DEG(rx) * scaleX;
-		lb = COS_DEG(ry) * scaleY;
-		lc = SIN_DEG(rx) * scaleX;
-		ld = SIN_DEG(ry) * scaleY;
+		SIN_COS_DEG(rx, sinX, cosX);
+		SIN_COS_DEG(ry, sinY, cosY);
+		la = cosX * scaleX;
+		lb = cosY * scaleY;
+		lc = sinX * scaleX;
+		ld = sinY * scaleY;
 		CONST_CAST(float, self->a) = pa * la - pb * lc;
 		CONST_CAST(float, self->b) = pa * lb - pb * ld;
 		CONST_CAST(float, self->c) = pc * la + pd * lc;
@@ -147,7 +154,7 @@ void spBone_updateWorldTransformWith (spBone* self, float x, float y, float rota
 	case SP_TRANSFORMMODE_NOSCALEORREFLECTION: {
 		float za, zc, s;
 		float r, zb, zd, la, lb, lc, ld;
-		cosine = COS_DEG(rotation); sine = SIN_DEG(rotation);
+		SIN_COS_DEG(rotation, sine, cosine);
 		za = (pa * cosine + pb * sine) / sx;
 		zc = (pc * cosine + pd * sine) / sy;
 		s = SQRT(za * za + zc * zc);
@@ -160,10 +167,12 @@ void spBone_updateWorldTransformWith (spBone* self, float x, float y, float rota
 		r = PI / 2 + ATAN2(zc, za);
 		zb = COS(r) * s;
 		zd = SIN(r) * s;
-		la = COS_DEG(shearX) * scaleX;
-		lb = COS_DEG(90 + shearY) * scaleY;
-		lc = SIN_DEG(shearX) * scaleX;
-		ld = SIN_DEG(90 + shearY) * scaleY;
+		SIN_COS_DEG(shearX, sinX, cosX);
+		SIN_COS_DEG(90 + shearY, sinY, cosY);
+		la = cosX * scaleX;
+		lb = cosY * scaleY;
+		lc = sinX * scaleX;
+		ld = sinY * scaleY;
 		CONST_CAST(float, self->a) = za * la + zb * lc;
 		CONST_CAST(float, self->b) = za * lb + zb * ld;
 		CONST_CAST(float, self->c) = zc * la + zd * lc;
@@ -265,22 +274,21 @@ void spBone_localToWorld (spBone* self, float localX, float localY, float* world
 
 float spBone_worldToLocalRotation (spBone* self, float worldRotation) {
 	float sine, cosine;
-	sine = SIN_DEG(worldRotation);
-	cosine = COS_DEG(worldRotation);
+	SIN_COS_DEG(worldRotation, sine, cosine);
 	return ATAN2(self->a * sine - self->c * cosine, self->d * cosine - self->b * sine) * RAD_DEG + self->rotation - self->shearX;
 }
 
 float spBone_localToWorldRotation (spBone* self, float localRotation) {
 	float sine, cosine;
 	localRotation -= self->rotation - self->shearX;
-	sine = SIN_DEG(localRotation);
-	cosine = COS_DEG(localRotation);
+	SIN_COS_DEG(localRotation, sine, cosine);
 	return ATAN2(cosine * self->c + sine * self->d, cosine * self->a + sine * self->b) * RAD_DEG;
 }
 
 void spBone_rotateWorld (spBone* self, float degrees) {
 	float a = self->a, b = self->b, c = self->c, d = self->d;
-	float cosine = COS_DEG(degrees), sine = SIN_DEG(degrees);
+	float cosine, sine;
+	SIN_COS_DEG(degrees, sine, cosine);
 	CONST_CAST(float, self->a) = cosine * a - sine * c;
 	CONST_CAST(float, self->b) = cosine * b - sine * d;
 	CONST_CAST(float, self->c) = sine * a + cosine * c;
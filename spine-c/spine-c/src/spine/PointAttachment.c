@@ -59,8 +59,7 @@ void spPointAttachment_computeWorldPosition (spPointAttachment* self, spBone* bo
 
 float spPointAttachment_computeWorldRotation (spPointAttachment* self, spBone* bone) {
 	float cosine, sine, x, y;
-	cosine = COS_DEG(self->rotation);
-	sine = SIN_DEG(self->rotation);
+	SIN_COS_DEG(self->rotation, sine, cosine);
 	x = cosine * bone->a + sine * bone->b;
 	y = cosine * bone->c + sine * bone->d;
 	return ATAN2(y, x) * RAD_DEG;
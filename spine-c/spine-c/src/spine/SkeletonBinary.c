@@ -204,7 +204,7 @@ static void readColor (_dataInput* input, float *r, float *g, float *b, float *a
 #define PATH_ROTATE_CHAIN 1
 #define PATH_ROTATE_CHAIN_SCALE 2
 
-static void readCurve (_dataInput* input, spCurveTimeline* timeline, int frameIndex) {
+static void readCurve (_dataInput* input, spCurveTimeline* timeline, int frameIndex, spCurveMode mode) {
 	switch (readByte(input)) {
 	case CURVE_STEPPED: {
 		spCurveTimeline_setStepped(timeline, frameIndex);
@@ -215,7 +215,7 @@ static void readCurve (_dataInput* input, spCurveTimeline* timeline, int frameIn
 		float cy1 = readFloat(input);
 		float cx2 = readFloat(input);
 		float cy2 = readFloat(input);
-		spCurveTimeline_setCurve(timeline, frameIndex, cx1, cy1, cx2, cy2);
+		spCurveTimeline_setCurveWithMode(timeline, frameIndex, cx1, cy1, cx2, cy2, mode);
 		break;
 	}
 	}
@@ -285,7 +285,7 @@ static spAnimation* _spSkeletonBinary_readAnimation (spSkeletonBinary* self, con
 					float r, g, b, a;
 					readColor(input, &r, &g, &b, &a);
 					spColorTimeline_setFrame(timeline, frameIndex, time, r, g, b, a);
-					if (frameIndex < frameCount - 1) readCurve(input, SUPER(timeline), frameIndex);
+					if (frameIndex < frameCount - 1) readCurve(input, SUPER(timeline), frameIndex, self->curveMode);
 				}
 				spTimelineArray_add(timelines, (spTimeline*)timeline);
 				duration = MAX(duration, timeline->frames[(frameCount - 1) * COLOR_ENTRIES]);
@@ -301,7 +301,7 @@ static spAnimation* _spSkeletonBinary_readAnimation (spSkeletonBinary* self, con
 					readColor(input, &r, &g, &b, &a);
 					readColor(input, &a2, &r2, &g2, &b2);
 					spTwoColorTimeline_setFrame(timeline, frameIndex, time, r, g, b, a, r2, g2, b2);
-					if (frameIndex < frameCount - 1) readCurve(input, SUPER(timeline), frameIndex);
+					if (frameIndex < frameCount - 1) readCurve(input, SUPER(timeline), frameIndex, self->curveMode);
 				}
 				spTimelineArray_add(timelines, (spTimeline*)timeline);
 				duration = MAX(duration, timeline->frames[(frameCount - 1) * TWOCOLOR_ENTRIES]);
@@ -332,7 +332,7 @@ static spAnimation* _spSkeletonBinary_readAnimation (spSkeletonBinary* self, con
 					float time = readFloat(input);
 					float degrees = readFloat(input);
 					spRotateTimeline_setFrame(timeline, frameIndex, time, degrees);
-					if (frameIndex < frameCount - 1) readCurve(input, SUPER(timeline), frameIndex);
+					if (frameIndex < frameCount - 1) readCurve(input, SUPER(timeline), frameIndex, self->curveMode);
 				}
 				spTimelineArray_add(timelines, (spTimeline*)timeline);
 				duration = MAX(duration, timeline->frames[(frameCount - 1) * ROTATE_ENTRIES]);
@@ -363,7 +363,7 @@ static spAnimation* _spSkeletonBinary_readAnimation (spSkeletonBinary* self, con
 					float x = readFloat(input) * timelineScale;
 					float y = readFloat(input) * timelineScale;
 					spTranslateTimeline_setFrame(timeline, frameIndex, time, x, y);
-					if (frameIndex < frameCount - 1) readCurve(input, SUPER(timeline), frameIndex);
+					if (frameIndex < frameCount - 1) readCurve(input, SUPER(timeline), frameIndex, self->curveMode);
 				}
 				spTimelineArray_add(timelines, (spTimeline*)timeline);
 				duration = MAX(duration, timeline->frames[(frameCount - 1) * TRANSLATE_ENTRIES]);
@@ -394,7 +394,7 @@ static spAnimation* _spSkeletonBinary_readAnimation (spSkeletonBinary* self, con
 			int compress = readBoolean(input);
 			int stretch = readBoolean(input);
 			spIkConstraintTimeline_setFrame(timeline, frameIndex, time, mix, softness, bendDirection, compress, stretch);
-			if (frameIndex < frameCount - 1) readCurve(input, SUPER(timeline), frameIndex);
+			if (frameIndex < frameCount - 1) readCurve(input, SUPER(timeline), frameIndex, self->curveMode);
 		}
 		spTimelineArray_add(timelines, (spTimeline*)timeline);
 		duration = MAX(duration, timeline->frames[(frameCount - 1) * IKCONSTRAINT_ENTRIES]);
@@ -414,7 +414,7 @@ static spAnimation* _spSkeletonBinary_readAnimation (spSkeletonBinary* self, con
 			float shearMix = readFloat(input);
 			spTransformConstraintTimeline_setFrame(timeline, frameIndex, time, rotateMix, translateMix,
 				scaleMix, shearMix);
-			if (frameIndex < frameCount - 1) readCurve(input, SUPER(timeline), frameIndex);
+			if (frameIndex < frameCount - 1) readCurve(input, SUPER(timeline), frameIndex, self->curveMode);
 		}
 		spTimelineArray_add(timelines, (spTimeline*)timeline);
 		duration = MAX(duration, timeline->frames[(frameCount - 1) * TRANSFORMCONSTRAINT_ENTRIES]);
@@ -446,7 +446,7 @@ static spAnimation* _spSkeletonBinary_readAnimation (spSkeletonBinary* self, con
 					float time = readFloat(input);
 					float value = readFloat(input) * timelineScale;
 					spPathConstraintPositionTimeline_setFrame(timeline, frameIndex, time, value);
-					if (frameIndex < frameCount - 1) readCurve(input, SUPER(timeline), frameIndex);
+					if (frameIndex < frameCount - 1) readCurve(input, SUPER(timeline), frameIndex, self->curveMode);
 				}
 				spTimelineArray_add(timelines, (spTimeline*)timeline);
 				duration = MAX(duration, timeline->frames[(frameCount - 1) * PATHCONSTRAINTPOSITION_ENTRIES]);
@@ -460,7 +460,7 @@ static spAnimation* _spSkeletonBinary_readAnimation (spSkeletonBinary* self, con
 					float rotateMix = readFloat(input);
 					float translateMix = readFloat(input);
 					spPathConstraintMixTimeline_setFrame(timeline, frameIndex, time, rotateMix, translateMix);
-					if (frameIndex < frameCount - 1) readCurve(input, SUPER(timeline), frameIndex);
+					if (frameIndex < frameCount - 1) readCurve(input, SUPER(timeline), frameIndex, self->curveMode);
 				}
 				spTimelineArray_add(timelines, (spTimeline*)timeline);
 				duration = MAX(duration, timeline->frames[(frameCount - 1) * PATHCONSTRAINTMIX_ENTRIES]);
@@ -530,7 +530,7 @@ static spAnimation* _spSkeletonBinary_readAnimation (spSkeletonBinary* self, con
 						}
 					}
 					spDeformTimeline_setFrame(timeline, frameIndex, time, deform);
-					if (frameIndex < frameCount - 1) readCurve(input, SUPER(timeline), frameIndex);
+					if (frameIndex < frameCount - 1) readCurve(input, SUPER(timeline), frameIndex, self->curveMode);
 				}
 				FREE(tempDeform);
 
@@ -127,3 +127,33 @@ float _spMath_pow2_apply(float a) {
 float _spMath_pow2out_apply(float a) {
 	return POW(a - 1, 2) * -1 + 1;
 }
+
+/* Minimax polynomials after reduction to [-45, 45] degrees, largest error about 1e-7. Branch free so loops over many
+ * angles can be vectorized. The angle must be within +-2^31 quarter turns. */
+void _spMath_sinCosDeg(float degrees, float* outSin, float* outCos) {
+	float q = degrees * (1.0f / 90.0f), fraction, x, x2, s, c, swap, keep;
+	int quadrant = (int)q;
+	fraction = q - quadrant;
+	quadrant += (int)(fraction > 0.5f) - (int)(fraction < -0.5f);
+	x = (degrees - quadrant * 90.0f) * DEG_RAD;
+	x2 = x * x;
+	s = x + x * x2 * (-1.6666654611e-1f + x2 * (8.3321608736e-3f + x2 * -1.9515295891e-4f));
+	c = 1.0f - 0.5f * x2 + x2 * x2 * (4.166664568298827e-2f + x2 * (-1.388731625493765e-3f + x2 * 2.443315711809948e-5f));
+	/* Rotate by the quarter turns, selecting and negating by multiplying with exact 0 and +-1. */
+	swap = (float)(quadrant & 1);
+	keep = 1.0f - swap;
+	*outSin = (s * keep + c * swap) * (1.0f - (float)(quadrant & 2));
+	*outCos = (c * keep + s * swap) * (1.0f - (float)((quadrant + 1) & 2));
+}
+
+float _spMath_sinDeg(float degrees) {
+	float s, c;
+	_spMath_sinCosDeg(degrees, &s, &c);
+	return s;
+}
+
+float _spMath_cosDeg(float degrees) {
+	float s, c;
+	_spMath_sinCosDeg(degrees, &s, &c);
+	return c;
+}
@@ -0,0 +1,145 @@
+#include <spine/spine.h>
+
+#include "Benchmark.h"
+
+using namespace spine;
+
+/// Forwards to another extension, counting the calls that reach it.
+class CountingExtension : public DefaultSpineExtension {
+public:
+	explicit CountingExtension(SpineExtension *extension) : _extension(extension), _allocations(0), _frees(0) {
+	}
+
+	size_t getAllocations() { return _allocations; }
+
+	size_t getFrees() { return _frees; }
+
+protected:
+	virtual void *_alloc(size_t size, const char *file, int line) {
+		_allocations++;
+		return _extension->_alloc(size, file, line);
+	}
+
+	virtual void *_calloc(size_t size, const char *file, int line) {
+		_allocations++;
+		return _extension->_calloc(size, file, line);
+	}
+
+	virtual void *_realloc(void *ptr, size_t size, const char *file, int line) {
+		_allocations++;
+		return _extension->_realloc(ptr, size, file, line);
+	}
+
+	virtual void _free(void *mem, const char *file, int line) {
+		if (mem) _frees++;
+		_extension->_free(mem, file, line);
+	}
+
+private:
+	SpineExtension *_extension;
+	size_t _allocations;
+	size_t _frees;
+};
+
+enum LoadMode {
+	LoadMode_Heap,
+	LoadMode_Arena,
+	LoadMode_InPlace
+};
+
+static const char *loadModeNames[] = {"heap", "arena", "inplace"};
+
+static SkeletonData *loadSkeletonData(Atlas *atlas, char *data, int length, bool binary, LoadMode mode) {
+	if (binary) {
+		SkeletonBinary loader(atlas);
+		loader.setUseArena(mode == LoadMode_Arena);
+		if (mode == LoadMode_InPlace) return loader.readSkeletonDataInPlace((unsigned char *) data, length, true);
+		return loader.readSkeletonData((const unsigned char *) data, length);
+	}
+	SkeletonJson loader(atlas);
+	loader.setUseArena(mode != LoadMode_Heap);
+	return loader.readSkeletonData(data);
+}
+
+/// Loads every example skeleton as binary and JSON, each with and without an arena, and binaries in place. The file is
+/// read once, so only parsing and building the SkeletonData is measured.
+void spine::arenaBenchmark() {
+	const char *names[] = {"alien", "coin", "dragon", "goblins", "hero", "mix-and-match", "owl", "powerup", "raptor",
+						   "speedy", "spineboy", "stretchyman", "tank", "vine", "windmill"};
+	const int numNames = sizeof(names) / sizeof(names[0]);
+	const int numLoads = 10;
+	SkeletonData *loaded[numLoads];
+	char *copies[numLoads];
+
+	for (int mode = LoadMode_Heap; mode <= LoadMode_InPlace; mode++) {
+		const char *modeName = loadModeNames[mode];
+		double totalLoad = 0, totalFree = 0;
+		size_t totalAllocations = 0;
+		for (int i = 0; i < numNames; i++) {
+			for (int binary = 0; binary < 2; binary++) {
+				if (mode == LoadMode_InPlace && !binary) continue;
+				String skeletonFile, atlasFile;
+				if (!findBenchmarkSkeleton(names[i], binary != 0, skeletonFile, atlasFile)) continue;
+				Atlas *atlas = new(__FILE__, __LINE__) Atlas(atlasFile, NULL);
+				int length;
+				char *data = SpineExtension::readFile(skeletonFile, &length);
+				for (int ii = 0; ii < numLoads; ii++) {
+					// Loading in place consumes the buffer.
+					copies[ii] = data;
+					if (mode == LoadMode_InPlace) {
+						copies[ii] = SpineExtension::alloc<char>(length, __FILE__, __LINE__);
+						memcpy(copies[ii], data, length);
+					}
+				}
+
+				SpineExtension *extension = SpineExtension::getInstance();
+				CountingExtension counter(extension);
+				SpineExtension::setInstance(&counter);
+				double start = benchmarkTime();
+				for (int ii = 0; ii < numLoads; ii++)
+					loaded[ii] = loadSkeletonData(atlas, copies[ii], length, binary != 0, (LoadMode) mode);
+				double loadTime = benchmarkTime() - start;
+				size_t allocations = counter.getAllocations();
+
+				size_t usedBytes = 0, reservedBytes = 0;
+				if (loaded[0] && loaded[0]->getArena()) {
+					usedBytes = loaded[0]->getArena()->getUsedBytes();
+					reservedBytes = loaded[0]->getArena()->getReservedBytes();
+				}
+
+				start = benchmarkTime();
+				for (int ii = 0; ii < numLoads; ii++)
+					delete loaded[ii];
+				double freeTime = benchmarkTime() - start;
+				SpineExtension::setInstance(extension);
+
+				char name[96];
+				sprintf(name, "%s/%s/%s/load", names[i], binary ? "binary" : "json", modeName);
+				benchmarkReport("arena", name, loadTime * 1000 / numLoads, "ms");
+				sprintf(name, "%s/%s/%s/free", names[i], binary ? "binary" : "json", modeName);
+				benchmarkReport("arena", name, freeTime * 1000 / numLoads, "ms");
+				sprintf(name, "%s/%s/%s/allocations", names[i], binary ? "binary" : "json", modeName);
+				benchmarkReport("arena", name, (double) allocations / numLoads, "count");
+				if (mode != LoadMode_Heap) {
+					sprintf(name, "%s/%s/%s/used", names[i], binary ? "binary" : "json", modeName);
+					benchmarkReport("arena", name, usedBytes / 1024.0, "KB");
+					sprintf(name, "%s/%s/%s/reserved", names[i], binary ? "binary" : "json", modeName);
+					benchmarkReport("arena", name, reservedBytes / 1024.0, "KB");
+				}
+
+				totalLoad += loadTime;
+				totalFree += freeTime;
+				totalAllocations += allocations;
+				SpineExtension::free(data, __FILE__, __LINE__);
+				delete atlas;
+			}
+		}
+		char name[96];
+		sprintf(name, "all/%s/load", modeName);
+		benchmarkReport("arena", name, totalLoad * 1000, "ms");
+		sprintf(name, "all/%s/free", modeName);
+		benchmarkReport("arena", name, totalFree * 1000, "ms");
+		sprintf(name, "all/%s/allocations", modeName);
+		benchmarkReport("arena", name, (double) totalAllocations, "count");
+	}
+}
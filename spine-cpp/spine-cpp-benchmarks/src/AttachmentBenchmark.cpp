@@ -0,0 +1,75 @@
+#include <spine/spine.h>
+
+#include "Benchmark.h"
+
+using namespace spine;
+
+/// Makes attachments be found by name, as before attachment handles.
+static void clearAttachmentHandles(SkeletonData *skeletonData) {
+	for (size_t i = 0; i < skeletonData->getSlots().size(); i++) {
+		SlotData *slot = skeletonData->getSlots()[i];
+		slot->setAttachmentName(String(slot->getAttachmentName()));
+	}
+	for (size_t i = 0; i < skeletonData->getAnimations().size(); i++) {
+		Vector<Timeline *> &timelines = skeletonData->getAnimations()[i]->getTimelines();
+		for (size_t ii = 0; ii < timelines.size(); ii++) {
+			if (!timelines[ii]->getRTTI().isExactly(AttachmentTimeline::rtti)) continue;
+			Vector<int> &handles = static_cast<AttachmentTimeline *>(timelines[ii])->getAttachmentHandles();
+			for (size_t iii = 0; iii < handles.size(); iii++)
+				handles[iii] = -1;
+		}
+	}
+}
+
+/// AnimationState::apply() of 100 skeletons cycling through the animations and swapping skins every 30 frames,
+/// finding attachments by handle and by name.
+void spine::attachmentBenchmark() {
+	const char *names[] = {"mix-and-match", "goblins", "spineboy"};
+	const int numSkeletons = 100, numFrames = 600;
+
+	for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+		for (int byName = 0; byName < 2; byName++) {
+			Atlas *atlas;
+			SkeletonData *skeletonData = loadBenchmarkSkeleton(names[i], true, atlas);
+			if (!skeletonData) continue;
+			if (byName) clearAttachmentHandles(skeletonData);
+			Vector<Animation *> &animations = skeletonData->getAnimations();
+			Vector<Skin *> &skins = skeletonData->getSkins();
+			AnimationStateData stateData(skeletonData);
+			stateData.setDefaultMix(0.2f);
+
+			Vector<Skeleton *> skeletons;
+			Vector<AnimationState *> states;
+			for (int ii = 0; ii < numSkeletons; ii++) {
+				Skeleton *skeleton = new(__FILE__, __LINE__) Skeleton(skeletonData);
+				AnimationState *state = new(__FILE__, __LINE__) AnimationState(&stateData);
+				skeleton->setSkin(skins[ii % skins.size()]);
+				skeleton->setSlotsToSetupPose();
+				state->setAnimation(0, animations[ii % animations.size()], true);
+				skeletons.add(skeleton);
+				states.add(state);
+			}
+
+			double start = benchmarkTime();
+			for (int frame = 0; frame < numFrames; frame++) {
+				for (int ii = 0; ii < numSkeletons; ii++) {
+					if (frame % 30 == 29) skeletons[ii]->setSkin(skins[(ii + frame) % skins.size()]);
+					states[ii]->update(1 / 60.0f);
+					states[ii]->apply(*skeletons[ii]);
+				}
+			}
+			double elapsed = benchmarkTime() - start;
+
+			char name[96];
+			sprintf(name, "%s/%s", names[i], byName ? "names" : "handles");
+			benchmarkReport("attachments", name, elapsed * 1000 / numFrames, "ms/frame");
+
+			for (int ii = 0; ii < numSkeletons; ii++) {
+				delete states[ii];
+				delete skeletons[ii];
+			}
+			delete skeletonData;
+			delete atlas;
+		}
+	}
+}
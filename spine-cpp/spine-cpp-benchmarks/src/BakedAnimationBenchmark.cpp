@@ -0,0 +1,73 @@
+#include <spine/spine.h>
+
+#include "Benchmark.h"
+
+using namespace spine;
+
+/// AnimationState::apply() playing each skeleton's longest animation forward, and applying it at random times, with and
+/// without baking the animations.
+void spine::bakedAnimationBenchmark() {
+	const char *names[] = {"spineboy", "raptor", "dragon", "hero", "tank", "owl"};
+	const int numSkeletons = 100, numFrames = 300;
+
+	for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+		Atlas *atlas;
+		SkeletonData *skeletonData = loadBenchmarkSkeleton(names[i], true, atlas);
+		if (!skeletonData) continue;
+		Vector<Animation *> &animations = skeletonData->getAnimations();
+		Animation *animation = animations[0];
+		for (size_t ii = 1; ii < animations.size(); ii++)
+			if (animations[ii]->getDuration() > animation->getDuration()) animation = animations[ii];
+		AnimationStateData stateData(skeletonData);
+
+		for (int baked = 0; baked < 2; baked++) {
+			if (baked) {
+				for (size_t ii = 0; ii < animations.size(); ii++)
+					animations[ii]->bake();
+			}
+
+			Vector<Skeleton *> skeletons;
+			Vector<AnimationState *> states;
+			for (int ii = 0; ii < numSkeletons; ii++) {
+				skeletons.add(new(__FILE__, __LINE__) Skeleton(skeletonData));
+				states.add(new(__FILE__, __LINE__) AnimationState(&stateData));
+				states[ii]->setAnimation(0, animation, true)->setTrackTime(ii * 0.01f);
+			}
+
+			double start = benchmarkTime();
+			for (int frame = 0; frame < numFrames; frame++) {
+				for (int ii = 0; ii < numSkeletons; ii++) {
+					states[ii]->update(1 / 60.0f);
+					states[ii]->apply(*skeletons[ii]);
+				}
+			}
+			double play = benchmarkTime() - start;
+
+			Vector<int> cursors;
+			unsigned int seed = 1;
+			start = benchmarkTime();
+			for (int frame = 0; frame < numFrames; frame++) {
+				for (int ii = 0; ii < numSkeletons; ii++) {
+					seed = seed * 1103515245 + 12345;
+					float time = (seed >> 8) / 16777216.0f * animation->getDuration();
+					if (baked)
+						animation->getBaked()->apply(*skeletons[ii], time, time, false, NULL, 1, MixBlend_Setup, MixDirection_In, cursors);
+					else
+						animation->apply(*skeletons[ii], time, time, false, NULL, 1, MixBlend_Setup, MixDirection_In);
+				}
+			}
+			double scrub = benchmarkTime() - start;
+
+			char name[64];
+			sprintf(name, "%s/%s/play", names[i], baked ? "baked" : "timelines");
+			benchmarkReport("baked", name, play * 1e6 / ((double) numSkeletons * numFrames), "us/skeleton");
+			sprintf(name, "%s/%s/scrub", names[i], baked ? "baked" : "timelines");
+			benchmarkReport("baked", name, scrub * 1e6 / ((double) numSkeletons * numFrames), "us/skeleton");
+			ContainerUtil::cleanUpVectorOfPointers(states);
+			ContainerUtil::cleanUpVectorOfPointers(skeletons);
+		}
+
+		delete skeletonData;
+		delete atlas;
+	}
+}
@@ -0,0 +1,49 @@
+#include <spine/spine.h>
+
+#include "Benchmark.h"
+
+using namespace spine;
+
+/// A crowd of skeletons updated by SkeletonBatchUpdater with different numbers of worker threads.
+void spine::batchUpdaterBenchmark() {
+	const int numSkeletons = 5000, numFrames = 30;
+	int workerCounts[] = {0, 1, 3, Thread::getProcessorCount() - 1};
+
+	Atlas *atlas;
+	SkeletonData *skeletonData = loadBenchmarkSkeleton("spineboy", true, atlas);
+	if (!skeletonData) return;
+	AnimationStateData stateData(skeletonData);
+	stateData.setDefaultMix(0.2f);
+	Vector<Animation *> &animations = skeletonData->getAnimations();
+
+	Vector<Skeleton *> skeletons;
+	Vector<AnimationState *> states;
+	for (int i = 0; i < numSkeletons; i++) {
+		Skeleton *skeleton = new(__FILE__, __LINE__) Skeleton(skeletonData);
+		AnimationState *state = new(__FILE__, __LINE__) AnimationState(&stateData);
+		state->setAnimation(0, animations[i % animations.size()], true);
+		skeletons.add(skeleton);
+		states.add(state);
+	}
+
+	for (size_t i = 0; i < sizeof(workerCounts) / sizeof(workerCounts[0]); i++) {
+		if (i > 0 && workerCounts[i] <= workerCounts[i - 1]) continue;
+		SkeletonBatchUpdater updater(workerCounts[i]);
+		for (int ii = 0; ii < numSkeletons; ii++)
+			updater.add(skeletons[ii], states[ii]);
+
+		updater.update(1 / 60.0f);
+		double start = benchmarkTime();
+		for (int frame = 0; frame < numFrames; frame++)
+			updater.update(1 / 60.0f);
+
+		char name[64];
+		sprintf(name, "spineboy-%d/workers-%d", numSkeletons, updater.getWorkerCount());
+		benchmarkReport("batchupdater", name, (benchmarkTime() - start) * 1e3 / numFrames, "ms/frame");
+	}
+
+	ContainerUtil::cleanUpVectorOfPointers(states);
+	ContainerUtil::cleanUpVectorOfPointers(skeletons);
+	delete skeletonData;
+	delete atlas;
+}
@@ -0,0 +1,161 @@
+#include <spine/spine.h>
+
+#include "Benchmark.h"
+
+#ifndef _WIN32
+#include <dirent.h>
+#endif
+
+using namespace spine;
+
+static bool fileExists(const String &path) {
+	FILE *file = fopen(path.buffer(), "rb");
+	if (!file) return false;
+	fclose(file);
+	return true;
+}
+
+bool spine::findBenchmarkSkeleton(const char *name, bool binary, String &outSkeletonFile, String &outAtlasFile) {
+	String base(SPINE_EXAMPLES_DIR "/");
+	base.append(name).append("/export/").append(name);
+
+	outAtlasFile = base;
+	outAtlasFile.append(".atlas");
+	outSkeletonFile = base;
+	outSkeletonFile.append("-pro").append(binary ? ".skel" : ".json");
+	if (!fileExists(outSkeletonFile)) {
+		outSkeletonFile = base;
+		outSkeletonFile.append("-ess").append(binary ? ".skel" : ".json");
+	}
+	return fileExists(outAtlasFile) && fileExists(outSkeletonFile);
+}
+
+/// Lists the names of the entries in a directory, sorted, without "." and "..".
+static void listDirectory(const String &path, Vector<String> &outNames) {
+	outNames.clear();
+#ifdef _WIN32
+	String pattern(path);
+	pattern.append("/*");
+	WIN32_FIND_DATAA data;
+	HANDLE find = FindFirstFileA(pattern.buffer(), &data);
+	if (find == INVALID_HANDLE_VALUE) return;
+	do {
+		if (strcmp(data.cFileName, ".") != 0 && strcmp(data.cFileName, "..") != 0) outNames.add(String(data.cFileName));
+	} while (FindNextFileA(find, &data));
+	FindClose(find);
+#else
+	DIR *dir = opendir(path.buffer());
+	if (!dir) return;
+	while (dirent *entry = readdir(dir))
+		if (strcmp(entry->d_name, ".") != 0 && strcmp(entry->d_name, "..") != 0) outNames.add(String(entry->d_name));
+	closedir(dir);
+#endif
+	for (size_t i = 1; i < outNames.size(); i++) {
+		for (size_t ii = i; ii > 0 && strcmp(outNames[ii - 1].buffer(), outNames[ii].buffer()) > 0; ii--) {
+			String swap(outNames[ii]);
+			outNames[ii] = outNames[ii - 1];
+			outNames[ii - 1] = swap;
+		}
+	}
+}
+
+static bool endsWith(const String &value, const char *suffix) {
+	size_t length = strlen(suffix);
+	return value.length() >= length && strcmp(value.buffer() + value.length() - length, suffix) == 0;
+}
+
+void spine::listBenchmarkSkeletons(Vector<String> &outSkeletonFiles, Vector<String> &outAtlasFiles) {
+	outSkeletonFiles.clear();
+	outAtlasFiles.clear();
+	Vector<String> directories, files;
+	listDirectory(String(SPINE_EXAMPLES_DIR), directories);
+	for (size_t i = 0; i < directories.size(); i++) {
+		String exportDir(SPINE_EXAMPLES_DIR "/");
+		exportDir.append(directories[i]).append("/export");
+		String atlasFile(exportDir);
+		atlasFile.append("/").append(directories[i]).append(".atlas");
+		listDirectory(exportDir, files);
+		for (size_t ii = 0; ii < files.size(); ii++) {
+			if (!endsWith(files[ii], ".json") && !endsWith(files[ii], ".skel")) continue;
+			String skeletonFile(exportDir);
+			skeletonFile.append("/").append(files[ii]);
+			outSkeletonFiles.add(skeletonFile);
+			outAtlasFiles.add(atlasFile);
+		}
+	}
+}
+
+SkeletonData *spine::loadBenchmarkSkeleton(const char *name, bool binary, Atlas *&outAtlas) {
+	String skeletonFile, atlasFile;
+	if (!findBenchmarkSkeleton(name, binary, skeletonFile, atlasFile)) {
+		outAtlas = NULL;
+		return NULL;
+	}
+
+	outAtlas = new(__FILE__, __LINE__) Atlas(atlasFile, NULL);
+	SkeletonData *skeletonData;
+	if (binary) {
+		SkeletonBinary loader(outAtlas);
+		skeletonData = loader.readSkeletonDataFile(skeletonFile);
+	} else {
+		SkeletonJson loader(outAtlas);
+		skeletonData = loader.readSkeletonDataFile(skeletonFile);
+	}
+	if (!skeletonData) {
+		delete outAtlas;
+		outAtlas = NULL;
+	}
+	return skeletonData;
+}
+
+size_t spine::clipBenchmarkSkeleton(Skeleton &skeleton, SkeletonClipping &clipper, Vector<float> &worldVertices, Vector<float> *tints) {
+	static unsigned short quadTriangles[] = {0, 1, 2, 2, 3, 0};
+	size_t triangleCount = 0;
+	Vector<Slot *> &drawOrder = skeleton.getDrawOrder();
+	for (size_t i = 0, n = drawOrder.size(); i < n; i++) {
+		Slot &slot = *drawOrder[i];
+		Attachment *attachment = slot.getAttachment();
+		if (!attachment) {
+			clipper.clipEnd(slot);
+			continue;
+		}
+		if (attachment->getRTTI().isExactly(ClippingAttachment::rtti)) {
+			clipper.clipStart(slot, static_cast<ClippingAttachment *>(attachment));
+			continue;
+		}
+		if (clipper.isClipping()) {
+			float *uvs = NULL;
+			unsigned short *triangles = NULL;
+			size_t trianglesLength = 0;
+			if (attachment->getRTTI().isExactly(RegionAttachment::rtti)) {
+				RegionAttachment *region = static_cast<RegionAttachment *>(attachment);
+				worldVertices.setSize(8, 0);
+				region->computeWorldVertices(slot.getBone(), worldVertices, 0, 2);
+				uvs = region->getUVs().buffer();
+				triangles = quadTriangles;
+				trianglesLength = 6;
+			} else if (attachment->getRTTI().isExactly(MeshAttachment::rtti)) {
+				MeshAttachment *mesh = static_cast<MeshAttachment *>(attachment);
+				worldVertices.setSize(mesh->getWorldVerticesLength(), 0);
+				mesh->computeWorldVertices(slot, 0, mesh->getWorldVerticesLength(), worldVertices, 0, 2);
+				uvs = mesh->getUVs().buffer();
+				triangles = mesh->getTriangles().buffer();
+				trianglesLength = mesh->getTriangles().size();
+			}
+			if (tints) {
+				Color &light = slot.getColor(), &dark = slot.getDarkColor();
+				float tint[] = {light.r, light.g, light.b, light.a, dark.r, dark.g, dark.b, dark.a};
+				size_t vertexCount = worldVertices.size() >> 1;
+				tints->setSize(vertexCount * 8, 0);
+				for (size_t ii = 0; ii < vertexCount; ii++)
+					memcpy(tints->buffer() + ii * 8, tint, sizeof(tint));
+				clipper.clipTriangles(worldVertices.buffer(), triangles, trianglesLength, uvs, 2, tints->buffer(), 8);
+			} else
+				clipper.clipTriangles(worldVertices.buffer(), triangles, trianglesLength, uvs, 2);
+			triangleCount += clipper.getClippedTriangles().size() / 3;
+		}
+		clipper.clipEnd(slot);
+	}
+	clipper.clipEnd();
+	return triangleCount;
+}
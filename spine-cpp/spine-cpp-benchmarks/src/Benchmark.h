@@ -0,0 +1,100 @@
+#ifndef Spine_Benchmark_h
+#define Spine_Benchmark_h
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+namespace spine {
+	class Atlas;
+
+	class Skeleton;
+
+	class SkeletonClipping;
+
+	class SkeletonData;
+
+	class String;
+
+	template<typename T>
+	class Vector;
+
+	/// Monotonic wall clock in seconds.
+	inline double benchmarkTime() {
+#ifdef _WIN32
+		LARGE_INTEGER frequency, counter;
+		QueryPerformanceFrequency(&frequency);
+		QueryPerformanceCounter(&counter);
+		return (double) counter.QuadPart / (double) frequency.QuadPart;
+#else
+		timespec now;
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		return (double) now.tv_sec + (double) now.tv_nsec * 1e-9;
+#endif
+	}
+
+	/// Prints one result line as "<benchmark> <case> <value> <unit>", so output can be diffed and parsed.
+	inline void benchmarkReport(const char *benchmark, const char *name, double value, const char *unit) {
+		printf("%s %s %.3f %s\n", benchmark, name, value, unit);
+		fflush(stdout);
+	}
+
+	/// Finds examples/<name>/export/<name>-pro (or -ess) as binary or JSON and its atlas.
+	/// @return false if either file does not exist.
+	bool findBenchmarkSkeleton(const char *name, bool binary, String &outSkeletonFile, String &outAtlasFile);
+
+	/// Loads examples/<name>/export/<name>-pro (or -ess) as binary or JSON together with its atlas.
+	/// @return NULL if the skeleton could not be loaded.
+	SkeletonData *loadBenchmarkSkeleton(const char *name, bool binary, Atlas *&outAtlas);
+
+	/// Finds every skeleton in examples/*/export, as JSON and binary, with the atlas of its directory, sorted by path.
+	void listBenchmarkSkeletons(Vector<String> &outSkeletonFiles, Vector<String> &outAtlasFiles);
+
+	/// Clips the region and mesh attachments of a skeleton like a renderer does. If tints is given, the slot's light and
+	/// dark colors are interpolated for each vertex, as a two color tint renderer does.
+	/// @return The number of clipped triangles.
+	size_t clipBenchmarkSkeleton(Skeleton &skeleton, SkeletonClipping &clipper, Vector<float> &worldVertices, Vector<float> *tints);
+
+	void arenaBenchmark();
+
+	void attachmentBenchmark();
+
+	void bakedAnimationBenchmark();
+
+	void batchUpdaterBenchmark();
+
+	void clippingBenchmark();
+
+	void compressionBenchmark();
+
+	void curvesBenchmark();
+
+	void hashMapBenchmark();
+
+	void instancingBenchmark();
+
+	void nameIndexBenchmark();
+
+	void pathConstraintBenchmark();
+
+	void poseBufferBenchmark();
+
+	void renderBenchmark();
+
+	void skeletonsBenchmark();
+
+	void skinSwapBenchmark();
+
+	void snapshotBenchmark();
+
+	void trigBenchmark();
+
+	void worldVerticesBenchmark();
+}
+
+#endif /* Spine_Benchmark_h */
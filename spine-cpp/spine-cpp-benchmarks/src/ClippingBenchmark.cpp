@@ -0,0 +1,73 @@
+#include <spine/spine.h>
+
+#include "Benchmark.h"
+
+using namespace spine;
+
+/// Renders the clipped parts of the example skeletons that use clipping: SkeletonClipping::clipStart() and
+/// SkeletonClipping::clipTriangles() for every frame of an animation, with world vertices precomputed. Unweighted
+/// clipping attachments are measured with and without their cached convex decomposition, and with light and dark colors
+/// interpolated for two color tinting.
+void spine::clippingBenchmark() {
+	const char *names[] = {"spineboy", "tank", "coin"};
+	const char *animationNames[] = {"portal", "shoot", "animation"};
+	const int numFrames = 300, numRepeats = 20;
+
+	for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+		Atlas *atlas;
+		SkeletonData *skeletonData = loadBenchmarkSkeleton(names[i], true, atlas);
+		if (!skeletonData) continue;
+		Animation *animation = skeletonData->findAnimation(animationNames[i]);
+		if (!animation) {
+			delete skeletonData;
+			delete atlas;
+			continue;
+		}
+
+		Vector<ClippingAttachment *> clips;
+		for (size_t ii = 0; ii < skeletonData->getSkins().size(); ii++) {
+			Skin::AttachmentMap::Entries entries = skeletonData->getSkins()[ii]->getAttachments();
+			while (entries.hasNext()) {
+				Attachment *attachment = entries.next()._attachment;
+				if (attachment->getRTTI().isExactly(ClippingAttachment::rtti))
+					clips.add(static_cast<ClippingAttachment *>(attachment));
+			}
+		}
+		bool cached = false;
+		for (size_t ii = 0; ii < clips.size(); ii++)
+			cached |= clips[ii]->getConvexPolygonSizes().size() > 0;
+
+		Skeleton skeleton(skeletonData);
+		SkeletonClipping clipper;
+		Vector<float> worldVertices, tints;
+		const char *modeNames[] = {"cached", "tinted", "decomposed"};
+		for (int mode = cached ? 0 : 1; mode < 3; mode++) {
+			if (mode == 2) {
+				for (size_t ii = 0; ii < clips.size(); ii++)
+					clips[ii]->getConvexPolygonSizes().clear();
+			}
+			double elapsed = 0;
+			size_t triangles = 0;
+			for (int frame = 0; frame < numFrames; frame++) {
+				float time = animation->getDuration() * frame / numFrames;
+				skeleton.setToSetupPose();
+				animation->apply(skeleton, time, time, false, NULL, 1, MixBlend_Setup, MixDirection_In);
+				skeleton.updateWorldTransform();
+				double start = benchmarkTime();
+				for (int repeat = 0; repeat < numRepeats; repeat++)
+					triangles += clipBenchmarkSkeleton(skeleton, clipper, worldVertices, mode == 1 ? &tints : NULL);
+				elapsed += benchmarkTime() - start;
+			}
+			char name[96];
+			sprintf(name, "%s/%s", names[i], modeNames[mode]);
+			benchmarkReport("clipping", name, elapsed * 1e6 / (numFrames * numRepeats), "us/frame");
+			sprintf(name, "%s/%s/triangles", names[i], modeNames[mode]);
+			benchmarkReport("clipping", name, (double) triangles / (numFrames * numRepeats), "count");
+		}
+		for (size_t ii = 0; ii < clips.size(); ii++)
+			clips[ii]->updateConvexPolygons();
+
+		delete skeletonData;
+		delete atlas;
+	}
+}
@@ -0,0 +1,127 @@
+#include <spine/spine.h>
+
+#include "Benchmark.h"
+
+using namespace spine;
+
+static bool isBinary(const String &skeletonFile) {
+	return strcmp(skeletonFile.buffer() + skeletonFile.length() - 5, ".skel") == 0;
+}
+
+/// Returns the largest difference of the local bone values and the deform vertices of the skeletons.
+static void poseError(Skeleton &expected, Skeleton &actual, float &boneError, float &deformError) {
+	Vector<Bone *> &expectedBones = expected.getBones(), &actualBones = actual.getBones();
+	for (size_t i = 0; i < expectedBones.size(); i++) {
+		Bone *a = expectedBones[i], *b = actualBones[i];
+		float values[] = {a->getX() - b->getX(), a->getY() - b->getY(), a->getRotation() - b->getRotation(),
+			a->getScaleX() - b->getScaleX(), a->getScaleY() - b->getScaleY(), a->getShearX() - b->getShearX(),
+			a->getShearY() - b->getShearY()};
+		for (int ii = 0; ii < 7; ii++)
+			boneError = MathUtil::max(boneError, MathUtil::abs(values[ii]));
+	}
+	Vector<Slot *> &expectedSlots = expected.getSlots(), &actualSlots = actual.getSlots();
+	for (size_t i = 0; i < expectedSlots.size(); i++) {
+		Vector<float> &a = expectedSlots[i]->getDeform(), &b = actualSlots[i]->getDeform();
+		for (size_t ii = 0, n = MathUtil::min(a.size(), b.size()); ii < n; ii++)
+			deformError = MathUtil::max(deformError, MathUtil::abs(a[ii] - b[ii]));
+	}
+}
+
+/// Loads every binary skeleton in examples/*/export and compresses its animations, see Animation::compress(). Reports the
+/// memory of the skeleton data before and after, the largest quantization error, the largest difference of the bone values
+/// and deform vertices when every animation is applied at 60 frames per second, and the time to apply the animations.
+void spine::compressionBenchmark() {
+	Vector<String> skeletonFiles, atlasFiles;
+	listBenchmarkSkeletons(skeletonFiles, atlasFiles);
+	size_t bytesAll = 0, compressedBytesAll = 0;
+	for (size_t i = 0; i < skeletonFiles.size(); i++) {
+		const String &skeletonFile = skeletonFiles[i];
+		if (!isBinary(skeletonFile)) continue;
+		const char *fileName = strrchr(skeletonFile.buffer(), '/') + 1;
+		char skeletonName[96];
+		sprintf(skeletonName, "%.*s", (int) (strlen(fileName) - 5), fileName);
+		FILE *file = fopen(atlasFiles[i].buffer(), "rb");
+		if (!file) continue;
+		fclose(file);
+
+		Atlas *atlas = new(__FILE__, __LINE__) Atlas(atlasFiles[i], NULL);
+		SpineExtension *extension = SpineExtension::getInstance();
+		ProfilingSpineExtension profiler(extension);
+		SpineExtension::setInstance(&profiler);
+		SkeletonData *skeletonData[2];
+		size_t bytes = profiler.getLiveBytes(), compressedBytes = 0;
+		for (int compressed = 0; compressed < 2; compressed++) {
+			SkeletonBinary binary(atlas);
+			skeletonData[compressed] = binary.readSkeletonDataFile(skeletonFile);
+		}
+		bytes = (profiler.getLiveBytes() - bytes) / 2;
+		if (skeletonData[0] && skeletonData[1]) {
+			compressedBytes = profiler.getLiveBytes();
+			Vector<Animation *> &animations = skeletonData[1]->getAnimations();
+			for (size_t ii = 0; ii < animations.size(); ii++)
+				animations[ii]->compress();
+			compressedBytes = bytes + profiler.getLiveBytes() - compressedBytes;
+		}
+		SpineExtension::setInstance(extension);
+		if (!skeletonData[0] || !skeletonData[1]) {
+			printf("# %s: could not be loaded\n", skeletonName);
+			delete skeletonData[0];
+			delete skeletonData[1];
+			delete atlas;
+			continue;
+		}
+
+		char name[128];
+		sprintf(name, "%s/memory", skeletonName);
+		benchmarkReport("compression", name, bytes / 1024.0, "KB");
+		sprintf(name, "%s/compressedMemory", skeletonName);
+		benchmarkReport("compression", name, compressedBytes / 1024.0, "KB");
+		bytesAll += bytes;
+		compressedBytesAll += compressedBytes;
+
+		Vector<Animation *> &animations = skeletonData[0]->getAnimations();
+		Vector<Animation *> &compressedAnimations = skeletonData[1]->getAnimations();
+		float quantizationError = 0, boneError = 0, deformError = 0;
+		Skeleton skeleton(skeletonData[0]), compressedSkeleton(skeletonData[1]);
+		size_t applies = 0;
+		for (size_t ii = 0; ii < animations.size(); ii++) {
+			quantizationError = MathUtil::max(quantizationError, compressedAnimations[ii]->getCompressionError());
+			for (float time = 0, duration = animations[ii]->getDuration(); time <= duration; time += 1 / 60.0f) {
+				skeleton.setToSetupPose();
+				compressedSkeleton.setToSetupPose();
+				animations[ii]->apply(skeleton, 0, time, false, NULL, 1, MixBlend_Setup, MixDirection_In);
+				compressedAnimations[ii]->apply(compressedSkeleton, 0, time, false, NULL, 1, MixBlend_Setup, MixDirection_In);
+				poseError(skeleton, compressedSkeleton, boneError, deformError);
+				applies++;
+			}
+		}
+		sprintf(name, "%s/quantizationError", skeletonName);
+		benchmarkReport("compression", name, quantizationError * 1000, "1/1000");
+		sprintf(name, "%s/boneError", skeletonName);
+		benchmarkReport("compression", name, boneError * 1000, "1/1000");
+		sprintf(name, "%s/deformError", skeletonName);
+		benchmarkReport("compression", name, deformError * 1000, "1/1000");
+
+		for (int compressed = 0; compressed < 2; compressed++) {
+			Vector<Animation *> &applied = compressed ? compressedAnimations : animations;
+			Skeleton &target = compressed ? compressedSkeleton : skeleton;
+			const int numRepeats = 20;
+			double start = benchmarkTime();
+			for (int repeat = 0; repeat < numRepeats; repeat++) {
+				for (size_t ii = 0; ii < applied.size(); ii++) {
+					for (float time = 0, duration = applied[ii]->getDuration(); time <= duration; time += 1 / 60.0f)
+						applied[ii]->apply(target, 0, time, false, NULL, 1, MixBlend_Setup, MixDirection_In);
+				}
+			}
+			double elapsed = benchmarkTime() - start;
+			sprintf(name, "%s/apply/%s", skeletonName, compressed ? "compressed" : "uncompressed");
+			benchmarkReport("compression", name, applies ? elapsed * 1e6 / ((double) numRepeats * applies) : 0, "us/apply");
+		}
+
+		delete skeletonData[0];
+		delete skeletonData[1];
+		delete atlas;
+	}
+	benchmarkReport("compression", "all/memory", bytesAll / 1024.0, "KB");
+	benchmarkReport("compression", "all/compressedMemory", compressedBytesAll / 1024.0, "KB");
+}
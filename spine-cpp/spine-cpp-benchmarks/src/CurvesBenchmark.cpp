@@ -0,0 +1,133 @@
+#include <spine/spine.h>
+
+#include "Benchmark.h"
+
+using namespace spine;
+
+static bool isBinary(const String &skeletonFile) {
+	return strcmp(skeletonFile.buffer() + skeletonFile.length() - 5, ".skel") == 0;
+}
+
+/// Collects the curve timelines with at least one bezier curve.
+static void collectCurveTimelines(SkeletonData *skeletonData, Vector<CurveTimeline *> &timelines) {
+	Vector<Animation *> &animations = skeletonData->getAnimations();
+	for (size_t i = 0; i < animations.size(); i++) {
+		Vector<Timeline *> &animationTimelines = animations[i]->getTimelines();
+		for (size_t ii = 0; ii < animationTimelines.size(); ii++) {
+			if (!animationTimelines[ii]->getRTTI().instanceOf(CurveTimeline::rtti)) continue;
+			timelines.add(static_cast<CurveTimeline *>(animationTimelines[ii]));
+		}
+	}
+}
+
+static bool isBezier(CurveTimeline *timeline, size_t frameIndex) {
+	float type = timeline->getCurveType(frameIndex);
+	return type != 0 && type != 1; // Not linear or stepped.
+}
+
+/// Evaluates every bezier curve of every timeline at 64 percents.
+static float evaluateCurves(Vector<CurveTimeline *> &timelines) {
+	float sum = 0;
+	for (size_t i = 0; i < timelines.size(); i++) {
+		CurveTimeline *timeline = timelines[i];
+		for (size_t frame = 0, n = timeline->getFrameCount() - 1; frame < n; frame++) {
+			if (!isBezier(timeline, frame)) continue;
+			for (int p = 0; p < 64; p++)
+				sum += timeline->getCurvePercent(frame, (p + 0.5f) / 64);
+		}
+	}
+	return sum;
+}
+
+/// Loads every binary skeleton in examples/*/export with CurveMode_Sampled and CurveMode_Uniform. Reports how much the
+/// uniform curves differ from the sampled ones, as the maximum and mean difference of the curve percent at 1001 points of
+/// each bezier curve, and the time of getCurvePercent() in both modes.
+void spine::curvesBenchmark() {
+	const int numEvaluations = 20;
+
+	Vector<String> skeletonFiles, atlasFiles;
+	listBenchmarkSkeletons(skeletonFiles, atlasFiles);
+	float maxErrorAll = 0;
+	double errorSumAll = 0;
+	size_t samplesAll = 0;
+	for (size_t i = 0; i < skeletonFiles.size(); i++) {
+		const String &skeletonFile = skeletonFiles[i];
+		if (!isBinary(skeletonFile)) continue;
+		const char *fileName = strrchr(skeletonFile.buffer(), '/') + 1;
+		char skeletonName[96];
+		sprintf(skeletonName, "%.*s", (int) (strlen(fileName) - 5), fileName);
+		FILE *file = fopen(atlasFiles[i].buffer(), "rb");
+		if (!file) continue;
+		fclose(file);
+
+		Atlas *atlas = new(__FILE__, __LINE__) Atlas(atlasFiles[i], NULL);
+		SkeletonData *skeletonData[2];
+		for (int mode = 0; mode < 2; mode++) {
+			SkeletonBinary binary(atlas);
+			binary.setCurveMode(mode ? CurveMode_Uniform : CurveMode_Sampled);
+			skeletonData[mode] = binary.readSkeletonDataFile(skeletonFile);
+		}
+		if (!skeletonData[0] || !skeletonData[1]) {
+			printf("# %s: could not be loaded\n", skeletonName);
+			delete skeletonData[0];
+			delete skeletonData[1];
+			delete atlas;
+			continue;
+		}
+
+		Vector<CurveTimeline *> sampled, uniform;
+		collectCurveTimelines(skeletonData[0], sampled);
+		collectCurveTimelines(skeletonData[1], uniform);
+		size_t curves = 0, uniformCurves = 0, samples = 0;
+		float maxError = 0;
+		double errorSum = 0;
+		for (size_t ii = 0; ii < sampled.size(); ii++) {
+			for (size_t frame = 0, n = sampled[ii]->getFrameCount() - 1; frame < n; frame++) {
+				if (!isBezier(sampled[ii], frame)) continue;
+				curves++;
+				if (uniform[ii]->getCurveType(frame) != sampled[ii]->getCurveType(frame)) uniformCurves++;
+				for (int p = 0; p <= 1000; p++) {
+					float percent = p / 1000.0f;
+					float error = MathUtil::abs(
+						uniform[ii]->getCurvePercent(frame, percent) - sampled[ii]->getCurvePercent(frame, percent));
+					maxError = MathUtil::max(maxError, error);
+					errorSum += error;
+					samples++;
+				}
+			}
+		}
+
+		char name[128];
+		sprintf(name, "%s/curves", skeletonName);
+		benchmarkReport("curves", name, (double) curves, "count");
+		if (curves > 0) {
+			sprintf(name, "%s/uniformCurves", skeletonName);
+			benchmarkReport("curves", name, (double) uniformCurves, "count");
+			sprintf(name, "%s/maxError", skeletonName);
+			benchmarkReport("curves", name, maxError * 1000, "1/1000");
+			sprintf(name, "%s/meanError", skeletonName);
+			benchmarkReport("curves", name, errorSum / samples * 1000, "1/1000");
+
+			float sum = 0;
+			for (int mode = 0; mode < 2; mode++) {
+				Vector<CurveTimeline *> &timelines = mode ? uniform : sampled;
+				double start = benchmarkTime();
+				for (int ii = 0; ii < numEvaluations; ii++)
+					sum += evaluateCurves(timelines);
+				double elapsed = benchmarkTime() - start;
+				sprintf(name, "%s/getCurvePercent/%s", skeletonName, mode ? "uniform" : "sampled");
+				benchmarkReport("curves", name, elapsed * 1e9 / ((double) numEvaluations * curves * 64), "ns/call");
+			}
+			if (sum == 0) printf("# %s: no curves evaluated\n", skeletonName);
+		}
+		maxErrorAll = MathUtil::max(maxErrorAll, maxError);
+		errorSumAll += errorSum;
+		samplesAll += samples;
+
+		delete skeletonData[0];
+		delete skeletonData[1];
+		delete atlas;
+	}
+	benchmarkReport("curves", "all/maxError", maxErrorAll * 1000, "1/1000");
+	if (samplesAll > 0) benchmarkReport("curves", "all/meanError", errorSumAll / samplesAll * 1000, "1/1000");
+}
@@ -0,0 +1,151 @@
+#include <spine/HashMap.h>
+
+#include "Benchmark.h"
+
+using namespace spine;
+
+namespace {
+	/// The linked list map spine::HashMap used to be, kept as the baseline to compare against.
+	template<typename K, typename V>
+	class LinkedListHashMap : public SpineObject {
+	public:
+		LinkedListHashMap() : _head(NULL), _size(0) {
+		}
+
+		~LinkedListHashMap() {
+			clear();
+		}
+
+		void clear() {
+			for (Entry *entry = _head; entry != NULL;) {
+				Entry *next = entry->next;
+				delete entry;
+				entry = next;
+			}
+			_head = NULL;
+			_size = 0;
+		}
+
+		void put(const K &key, const V &value) {
+			Entry *entry = find(key);
+			if (entry) {
+				entry->_value = value;
+			} else {
+				entry = new(__FILE__, __LINE__) Entry();
+				entry->_key = key;
+				entry->_value = value;
+				if (_head) {
+					_head->prev = entry;
+					entry->next = _head;
+				}
+				_head = entry;
+				_size++;
+			}
+		}
+
+		bool containsKey(const K &key) {
+			return find(key) != NULL;
+		}
+
+		bool remove(const K &key) {
+			Entry *entry = find(key);
+			if (!entry) return false;
+			if (entry->prev) entry->prev->next = entry->next;
+			else _head = entry->next;
+			if (entry->next) entry->next->prev = entry->prev;
+			delete entry;
+			_size--;
+			return true;
+		}
+
+		V operator[](const K &key) {
+			Entry *entry = find(key);
+			return entry ? entry->_value : V();
+		}
+
+	private:
+		class Entry : public SpineObject {
+		public:
+			K _key;
+			V _value;
+			Entry *next;
+			Entry *prev;
+
+			Entry() : next(NULL), prev(NULL) {}
+		};
+
+		Entry *find(const K &key) {
+			for (Entry *entry = _head; entry != NULL; entry = entry->next)
+				if (entry->_key == key) return entry;
+			return NULL;
+		}
+
+		Entry *_head;
+		size_t _size;
+	};
+
+	volatile int sink;
+
+	/// Property id shaped keys, as used by AnimationState::_propertyIDs.
+	int key(int i) {
+		return ((i % 13) << 24) + i;
+	}
+
+	template<typename M>
+	void run(const char *container, int n) {
+		int reps = 100000 / n;
+		if (reps < 1) reps = 1;
+		char name[64];
+		M map;
+		int hits = 0;
+
+		double start = benchmarkTime();
+		for (int r = 0; r < reps; r++) {
+			map.clear();
+			for (int i = 0; i < n; i++)
+				map.put(key(i), i);
+		}
+		sprintf(name, "%s/put/%d", container, n);
+		benchmarkReport("hashmap", name, (benchmarkTime() - start) * 1e9 / ((double) reps * n), "ns/op");
+
+		start = benchmarkTime();
+		for (int r = 0; r < reps; r++)
+			for (int i = 0; i < n; i++)
+				if (map.containsKey(key(i))) hits += map[key(i)];
+		sprintf(name, "%s/get/%d", container, n);
+		benchmarkReport("hashmap", name, (benchmarkTime() - start) * 1e9 / ((double) reps * n), "ns/op");
+
+		start = benchmarkTime();
+		for (int r = 0; r < reps; r++)
+			for (int i = 0; i < n; i++)
+				hits += map.containsKey(-1 - i);
+		sprintf(name, "%s/miss/%d", container, n);
+		benchmarkReport("hashmap", name, (benchmarkTime() - start) * 1e9 / ((double) reps * n), "ns/op");
+
+		// AnimationState::computeHold: clear, then test-and-insert every timeline's property id.
+		start = benchmarkTime();
+		for (int r = 0; r < reps; r++) {
+			map.clear();
+			for (int i = 0; i < n; i++)
+				if (!map.containsKey(key(i))) map.put(key(i), 1);
+		}
+		sprintf(name, "%s/computeHold/%d", container, n);
+		benchmarkReport("hashmap", name, (benchmarkTime() - start) * 1e9 / ((double) reps * n), "ns/op");
+
+		start = benchmarkTime();
+		for (int i = 0; i < n; i++)
+			hits += map.remove(key(i));
+		sprintf(name, "%s/remove/%d", container, n);
+		benchmarkReport("hashmap", name, (benchmarkTime() - start) * 1e9 / n, "ns/op");
+
+		sink = hits;
+	}
+}
+
+void spine::hashMapBenchmark() {
+	int sizes[] = {10, 100, 10000};
+	for (size_t i = 0; i < sizeof(sizes) / sizeof(int); i++) {
+		run<LinkedListHashMap<int, int> >("linkedlist", sizes[i]);
+		run<HashMap<int, int> >("openaddressing", sizes[i]);
+	}
+}
@@ -0,0 +1,157 @@
+#include <spine/spine.h>
+
+#include "Benchmark.h"
+
+using namespace spine;
+
+/// Counts the bytes requested from the SpineExtension.
+class ByteCountingExtension : public DefaultSpineExtension {
+public:
+	ByteCountingExtension(SpineExtension *extension) : _extension(extension), _bytes(0) {
+	}
+
+	size_t getBytes() { return _bytes; }
+
+protected:
+	virtual void *_alloc(size_t size, const char *file, int line) {
+		_bytes += size;
+		return _extension->_alloc(size, file, line);
+	}
+
+	virtual void *_calloc(size_t size, const char *file, int line) {
+		_bytes += size;
+		return _extension->_calloc(size, file, line);
+	}
+
+	virtual void *_realloc(void *ptr, size_t size, const char *file, int line) {
+		_bytes += size;
+		return _extension->_realloc(ptr, size, file, line);
+	}
+
+	virtual void _free(void *mem, const char *file, int line) {
+		_extension->_free(mem, file, line);
+	}
+
+private:
+	SpineExtension *_extension;
+	size_t _bytes;
+};
+
+/// Transforms the world vertices of every visible region and mesh attachment, so both modes do the same output work.
+static float drawSkeleton(Skeleton &skeleton, Vector<float> &worldVertices) {
+	float checksum = 0;
+	Vector<Slot *> &drawOrder = skeleton.getDrawOrder();
+	for (size_t i = 0; i < drawOrder.size(); i++) {
+		Slot &slot = *drawOrder[i];
+		Attachment *attachment = slot.getAttachment();
+		if (!attachment) continue;
+		if (attachment->getRTTI().isExactly(RegionAttachment::rtti)) {
+			worldVertices.setSize(8, 0);
+			static_cast<RegionAttachment *>(attachment)->computeWorldVertices(slot.getBone(), worldVertices, 0, 2);
+		} else if (attachment->getRTTI().isExactly(MeshAttachment::rtti)) {
+			MeshAttachment *mesh = static_cast<MeshAttachment *>(attachment);
+			worldVertices.setSize(mesh->getWorldVerticesLength(), 0);
+			mesh->computeWorldVertices(slot, 0, mesh->getWorldVerticesLength(), worldVertices, 0, 2);
+		} else
+			continue;
+		checksum += worldVertices[0];
+	}
+	return checksum;
+}
+
+static float drawInstance(SkeletonInstance &instance, Vector<float> &worldVertices) {
+	float checksum = 0;
+	SkeletonPose &pose = *instance.getPose();
+	Vector<int> &drawOrder = pose.getDrawOrder();
+	for (size_t i = 0; i < drawOrder.size(); i++) {
+		Attachment *attachment = pose.getAttachment(drawOrder[i]);
+		if (!attachment) continue;
+		if (!attachment->getRTTI().isExactly(RegionAttachment::rtti) && !attachment->getRTTI().isExactly(MeshAttachment::rtti))
+			continue;
+		worldVertices.setSize(pose.getVerticesLength(drawOrder[i]), 0);
+		instance.computeWorldVertices(pose, drawOrder[i], worldVertices.buffer(), 0, 2);
+		checksum += worldVertices[0];
+	}
+	return checksum;
+}
+
+/// 10,000 characters playing a few animations, as full Skeleton objects and as SkeletonInstance objects sharing a
+/// SkeletonPoseCache. Reports the time per frame and the bytes allocated to create the characters, including the poses
+/// cached by the end.
+void spine::instancingBenchmark() {
+	const char *names[] = {"spineboy", "raptor", "goblins"};
+	const int numCharacters = 10000, numFrames = 30, numAnimations = 4;
+
+	for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+		Atlas *atlas;
+		SkeletonData *skeletonData = loadBenchmarkSkeleton(names[i], true, atlas);
+		if (!skeletonData) continue;
+		Vector<Animation *> &animations = skeletonData->getAnimations();
+		Vector<float> worldVertices;
+		float checksum = 0;
+
+		for (int instanced = 0; instanced < 2; instanced++) {
+			SpineExtension *extension = SpineExtension::getInstance();
+			ByteCountingExtension counter(extension);
+			SpineExtension::setInstance(&counter);
+
+			SkeletonPoseCache *cache = NULL;
+			Vector<Skeleton *> skeletons;
+			Vector<SkeletonInstance *> instances;
+			if (instanced) {
+				cache = new(__FILE__, __LINE__) SkeletonPoseCache(skeletonData, 30);
+				for (int ii = 0; ii < numCharacters; ii++) {
+					SkeletonInstance *instance = new(__FILE__, __LINE__) SkeletonInstance(cache);
+					instance->setAnimation(animations[ii % numAnimations % animations.size()], true);
+					instance->setTime(ii * 0.01f);
+					instance->setPosition((float) (ii % 100), (float) (ii / 100));
+					instances.add(instance);
+				}
+			} else {
+				for (int ii = 0; ii < numCharacters; ii++) {
+					Skeleton *skeleton = new(__FILE__, __LINE__) Skeleton(skeletonData);
+					skeleton->setPosition((float) (ii % 100), (float) (ii / 100));
+					skeletons.add(skeleton);
+				}
+			}
+
+			double start = benchmarkTime();
+			for (int frame = 0; frame < numFrames; frame++) {
+				for (int ii = 0; ii < numCharacters; ii++) {
+					if (instanced) {
+						instances[ii]->update(1 / 60.0f);
+						checksum += drawInstance(*instances[ii], worldVertices);
+					} else {
+						Skeleton &skeleton = *skeletons[ii];
+						float time = ii * 0.01f + frame / 60.0f;
+						animations[ii % numAnimations % animations.size()]->apply(skeleton, time, time, true, NULL, 1, MixBlend_Setup, MixDirection_In);
+						skeleton.updateWorldTransform();
+						checksum += drawSkeleton(skeleton, worldVertices);
+					}
+				}
+			}
+			double elapsed = benchmarkTime() - start;
+			size_t bytes = counter.getBytes();
+			SpineExtension::setInstance(extension);
+
+			char name[64];
+			const char *mode = instanced ? "instances" : "skeletons";
+			sprintf(name, "%s/%s/frame", names[i], mode);
+			benchmarkReport("instancing", name, elapsed * 1000 / numFrames, "ms");
+			sprintf(name, "%s/%s/memory", names[i], mode);
+			benchmarkReport("instancing", name, bytes / 1024.0, "KB");
+			if (instanced) {
+				sprintf(name, "%s/instances/poses", names[i]);
+				benchmarkReport("instancing", name, (double) cache->size(), "count");
+			}
+
+			ContainerUtil::cleanUpVectorOfPointers(instances);
+			ContainerUtil::cleanUpVectorOfPointers(skeletons);
+			delete cache;
+		}
+		if (checksum != checksum) printf("# invalid vertices\n");
+
+		delete skeletonData;
+		delete atlas;
+	}
+}
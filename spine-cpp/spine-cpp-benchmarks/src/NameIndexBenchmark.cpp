@@ -0,0 +1,80 @@
+#include <spine/spine.h>
+
+#include "Benchmark.h"
+
+using namespace spine;
+
+template<typename T>
+static double findAll(Vector<T *> &items, NameIndex *index, int repeats, int &found) {
+	double start = benchmarkTime();
+	for (int i = 0; i < repeats; i++) {
+		for (size_t ii = 0, n = items.size(); ii < n; ii++) {
+			const String &name = NameOf<T>::get(items[ii]);
+			found += (index ? index->find(items, name) : ContainerUtil::findIndexWithName(items, name)) != -1;
+		}
+	}
+	return benchmarkTime() - start;
+}
+
+template<typename T>
+static double findAllRegions(Vector<T *> &items, NameIndex *index, int repeats, int &found) {
+	double start = benchmarkTime();
+	for (int i = 0; i < repeats; i++) {
+		for (size_t ii = 0, n = items.size(); ii < n; ii++) {
+			const String &name = items[ii]->name;
+			if (index) {
+				found += index->find(items, name) != -1;
+				continue;
+			}
+			for (size_t iii = 0; iii < n; iii++) {
+				if (items[iii]->name == name) {
+					found++;
+					break;
+				}
+			}
+		}
+	}
+	return benchmarkTime() - start;
+}
+
+/// Finding every bone, slot and animation of a few example skeletons and every region of their atlases by name, with a
+/// NameIndex and with a linear search. Reports the average time per lookup.
+void spine::nameIndexBenchmark() {
+	const char *names[] = {"spineboy", "raptor", "dragon", "mix-and-match"};
+	const int repeats = 200;
+	int found = 0;
+
+	for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+		Atlas *atlas;
+		SkeletonData *skeletonData = loadBenchmarkSkeleton(names[i], true, atlas);
+		if (!skeletonData) continue;
+
+		for (int indexed = 0; indexed < 2; indexed++) {
+			NameIndex bones, slots, animations, regions;
+			bones.update(skeletonData->getBones());
+			slots.update(skeletonData->getSlots());
+			animations.update(skeletonData->getAnimations());
+			regions.update(atlas->getRegions());
+
+			const char *kinds[] = {"bones", "slots", "animations", "regions"};
+			size_t counts[] = {skeletonData->getBones().size(), skeletonData->getSlots().size(),
+							   skeletonData->getAnimations().size(), atlas->getRegions().size()};
+			double times[4];
+			times[0] = findAll(skeletonData->getBones(), indexed ? &bones : NULL, repeats, found);
+			times[1] = findAll(skeletonData->getSlots(), indexed ? &slots : NULL, repeats, found);
+			times[2] = findAll(skeletonData->getAnimations(), indexed ? &animations : NULL, repeats, found);
+			times[3] = findAllRegions(atlas->getRegions(), indexed ? &regions : NULL, repeats, found);
+
+			for (int ii = 0; ii < 4; ii++) {
+				if (counts[ii] == 0) continue;
+				char name[96];
+				sprintf(name, "%s/%s/%s", names[i], kinds[ii], indexed ? "index" : "linear");
+				benchmarkReport("names", name, times[ii] * 1e9 / (repeats * counts[ii]), "ns");
+			}
+		}
+
+		delete skeletonData;
+		delete atlas;
+	}
+	if (found == 0) printf("nothing found\n");
+}
@@ -0,0 +1,70 @@
+#include <spine/spine.h>
+
+#include "Benchmark.h"
+
+using namespace spine;
+
+/// Skeleton::updateWorldTransform() of skeletons with path constraints, with and without the path geometry cache, while
+/// playing an animation and holding the setup pose, and updating only the path constraints again with unchanged paths.
+/// Build with SPINE_NO_SIMD defined to measure the scalar curve length kernel.
+void spine::pathConstraintBenchmark() {
+	const char *names[] = {"vine", "windmill", "stretchyman", "tank"};
+	const int numSkeletons = 100, numFrames = 200;
+
+	for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+		Atlas *atlas;
+		SkeletonData *skeletonData = loadBenchmarkSkeleton(names[i], true, atlas);
+		if (!skeletonData) continue;
+		char name[64];
+		sprintf(name, "%s/pathConstraints", names[i]);
+		benchmarkReport("paths", name, (double) skeletonData->getPathConstraints().size(), "count");
+		Animation *animation = skeletonData->getAnimations()[0];
+
+		for (int animated = 1; animated >= 0; animated--) {
+			for (int cached = 0; cached < 2; cached++) {
+				Vector<Skeleton *> skeletons;
+				for (int ii = 0; ii < numSkeletons; ii++) {
+					Skeleton *skeleton = new(__FILE__, __LINE__) Skeleton(skeletonData);
+					Vector<PathConstraint *> &constraints = skeleton->getPathConstraints();
+					for (size_t iii = 0; iii < constraints.size(); iii++)
+						constraints[iii]->setGeometryCacheEnabled(cached != 0);
+					skeletons.add(skeleton);
+				}
+
+				double elapsed = 0, constraintsElapsed = 0;
+				for (int frame = 0; frame < numFrames; frame++) {
+					float time = animated ? frame / 60.0f : 0;
+					for (int ii = 0; ii < numSkeletons; ii++)
+						animation->apply(*skeletons[ii], time, time, true, NULL, animated ? 1.0f : 0.0f, MixBlend_Setup,
+							MixDirection_In);
+					double start = benchmarkTime();
+					for (int ii = 0; ii < numSkeletons; ii++)
+						skeletons[ii]->updateWorldTransform();
+					double end = benchmarkTime();
+					elapsed += end - start;
+
+					// Update the path constraints again, as the last updateWorldTransform() did, to measure them alone.
+					// Only the bones they constrain change, so a cached path is reused.
+					for (int ii = 0; ii < numSkeletons; ii++) {
+						Vector<PathConstraint *> &constraints = skeletons[ii]->getPathConstraints();
+						for (size_t iii = 0; iii < constraints.size(); iii++)
+							constraints[iii]->update();
+					}
+					constraintsElapsed += benchmarkTime() - end;
+				}
+
+				sprintf(name, "%s/%s/%s", names[i], animated ? "animated" : "setup", cached ? "cached" : "uncached");
+				benchmarkReport("paths", name, elapsed * 1e6 / ((double) numSkeletons * numFrames), "us/skeleton");
+				if (animated && skeletonData->getPathConstraints().size() > 0) {
+					sprintf(name, "%s/constraints/%s", names[i], cached ? "cached" : "uncached");
+					benchmarkReport("paths", name, constraintsElapsed * 1e6 / ((double) numSkeletons * numFrames),
+						"us/skeleton");
+				}
+				ContainerUtil::cleanUpVectorOfPointers(skeletons);
+			}
+		}
+
+		delete skeletonData;
+		delete atlas;
+	}
+}
@@ -0,0 +1,46 @@
+#include <spine/spine.h>
+
+#include "Benchmark.h"
+
+using namespace spine;
+
+/// Skeleton::updateWorldTransform() with and without the structure-of-arrays pose buffer.
+void spine::poseBufferBenchmark() {
+	const char *names[] = {"spineboy", "raptor", "stretchyman", "tank", "dragon"};
+	const int numSkeletons = 100, numFrames = 200;
+
+	for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+		Atlas *atlas;
+		SkeletonData *skeletonData = loadBenchmarkSkeleton(names[i], true, atlas);
+		if (!skeletonData) continue;
+		Animation *animation = skeletonData->getAnimations()[0];
+
+		for (int enabled = 0; enabled < 2; enabled++) {
+			Vector<Skeleton *> skeletons;
+			for (int ii = 0; ii < numSkeletons; ii++) {
+				Skeleton *skeleton = new(__FILE__, __LINE__) Skeleton(skeletonData);
+				skeleton->setPoseBufferEnabled(enabled != 0);
+				skeletons.add(skeleton);
+			}
+
+			double elapsed = 0;
+			for (int frame = 0; frame < numFrames; frame++) {
+				float time = frame / 60.0f;
+				for (int ii = 0; ii < numSkeletons; ii++)
+					animation->apply(*skeletons[ii], time, time, true, NULL, 1, MixBlend_Setup, MixDirection_In);
+				double start = benchmarkTime();
+				for (int ii = 0; ii < numSkeletons; ii++)
+					skeletons[ii]->updateWorldTransform();
+				elapsed += benchmarkTime() - start;
+			}
+
+			char name[64];
+			sprintf(name, "%s/%s", names[i], enabled ? "poseBuffer" : "updateCache");
+			benchmarkReport("posebuffer", name, elapsed * 1e6 / ((double) numSkeletons * numFrames), "us/skeleton");
+			ContainerUtil::cleanUpVectorOfPointers(skeletons);
+		}
+
+		delete skeletonData;
+		delete atlas;
+	}
+}
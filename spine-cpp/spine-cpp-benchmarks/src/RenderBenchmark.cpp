@@ -0,0 +1,95 @@
+#include <float.h>
+#include <spine/spine.h>
+#include <spine/spine-raster.h>
+
+#include "Benchmark.h"
+
+using namespace spine;
+
+/// Renders the spineboy portal, tank shoot and coin animations with the SkeletonRasterizer, with white textures. Reports
+/// the draw commands a GPU renderer would issue, the vertices and triangles, the time to build the vertex stream
+/// and to rasterize it with 0 workers and one worker per additional processor.
+void spine::renderBenchmark() {
+	const char *names[] = {"spineboy", "tank", "coin"};
+	const char *animationNames[] = {"portal", "shoot", "animation"};
+	const int numFrames = 60;
+	const int imageWidth = 512, imageHeight = 512;
+	const float delta = 1 / 30.0f;
+
+	for (int i = 0; i < 3; i++) {
+		String skeletonFile, atlasFile;
+		if (!findBenchmarkSkeleton(names[i], true, skeletonFile, atlasFile)) continue;
+		RasterTextureLoader textureLoader;
+		Atlas *atlas = new(__FILE__, __LINE__) Atlas(atlasFile, &textureLoader);
+		SkeletonBinary binary(atlas);
+		SkeletonData *skeletonData = binary.readSkeletonDataFile(skeletonFile);
+		Animation *animation = skeletonData ? skeletonData->findAnimation(animationNames[i]) : NULL;
+		if (!animation) {
+			delete skeletonData;
+			delete atlas;
+			continue;
+		}
+
+		Skeleton skeleton(skeletonData);
+		RasterImage image(imageWidth, imageHeight);
+		const int workerCounts[] = {0, -1};
+		for (int w = 0; w < 2; w++) {
+			SkeletonRasterizer rasterizer(workerCounts[w]);
+			if (w == 1 && rasterizer.getWorkerCount() == 0) continue;
+
+			// Fit the image to the bounds of the whole animation, so every frame uses the same transform.
+			float minX = FLT_MAX, minY = FLT_MAX, maxX = -FLT_MAX, maxY = -FLT_MAX;
+			Vector<float> boundsVertices;
+			for (int frame = 0; frame < numFrames; frame++) {
+				skeleton.setToSetupPose();
+				animation->apply(skeleton, 0, frame * delta, true, NULL, 1, MixBlend_Setup, MixDirection_In);
+				skeleton.updateWorldTransform();
+				float x, y, width, height;
+				skeleton.getBounds(x, y, width, height, boundsVertices);
+				minX = MathUtil::min(minX, x);
+				minY = MathUtil::min(minY, y);
+				maxX = MathUtil::max(maxX, x + width);
+				maxY = MathUtil::max(maxY, y + height);
+			}
+			rasterizer.fit(minX, minY, maxX - minX, maxY - minY, imageWidth, imageHeight, 8);
+
+			double buildTime = 0, rasterizeTime = 0;
+			size_t commands = 0, vertices = 0, triangles = 0;
+			for (int frame = 0; frame < numFrames; frame++) {
+				skeleton.setToSetupPose();
+				animation->apply(skeleton, 0, frame * delta, true, NULL, 1, MixBlend_Setup, MixDirection_In);
+				skeleton.updateWorldTransform();
+				image.clear(Color(0, 0, 0, 1));
+
+				double start = benchmarkTime();
+				rasterizer.clear();
+				rasterizer.add(skeleton);
+				double end = benchmarkTime();
+				buildTime += end - start;
+				rasterizer.rasterize(image);
+				rasterizeTime += benchmarkTime() - end;
+
+				commands += rasterizer.getBuilder().getCommands().size();
+				vertices += rasterizer.getBuilder().getVertexCount();
+				triangles += rasterizer.getBuilder().getTriangleCount();
+			}
+
+			char name[96];
+			if (w == 0) {
+				sprintf(name, "%s/%s/commands", names[i], animationNames[i]);
+				benchmarkReport("render", name, (double) commands / numFrames, "count/frame");
+				sprintf(name, "%s/%s/vertices", names[i], animationNames[i]);
+				benchmarkReport("render", name, (double) vertices / numFrames, "count/frame");
+				sprintf(name, "%s/%s/triangles", names[i], animationNames[i]);
+				benchmarkReport("render", name, (double) triangles / numFrames, "count/frame");
+				sprintf(name, "%s/%s/build", names[i], animationNames[i]);
+				benchmarkReport("render", name, buildTime * 1e6 / numFrames, "us/frame");
+			}
+			sprintf(name, "%s/%s/rasterize/%d", names[i], animationNames[i], rasterizer.getWorkerCount());
+			benchmarkReport("render", name, rasterizeTime * 1e3 / numFrames, "ms/frame");
+		}
+
+		delete skeletonData;
+		delete atlas;
+	}
+}
@@ -0,0 +1,200 @@
+#include <spine/spine.h>
+
+#include "Benchmark.h"
+
+using namespace spine;
+
+static bool isBinary(const String &skeletonFile) {
+	return strcmp(skeletonFile.buffer() + skeletonFile.length() - 5, ".skel") == 0;
+}
+
+static SkeletonData *loadSkeletonData(Atlas *atlas, const String &skeletonFile) {
+	if (isBinary(skeletonFile)) {
+		SkeletonBinary loader(atlas);
+		return loader.readSkeletonDataFile(skeletonFile);
+	}
+	SkeletonJson loader(atlas);
+	return loader.readSkeletonDataFile(skeletonFile);
+}
+
+static void report(const char *skeletonCase, const char *name, double value, const char *unit) {
+	char fullName[192];
+	sprintf(fullName, "%s/%s", skeletonCase, name);
+	benchmarkReport("skeletons", fullName, value, unit);
+}
+
+/// Transforms the world vertices of every visible region and mesh attachment.
+static size_t computeWorldVertices(Skeleton &skeleton, Vector<float> &worldVertices) {
+	size_t vertexCount = 0;
+	Vector<Slot *> &drawOrder = skeleton.getDrawOrder();
+	for (size_t i = 0, n = drawOrder.size(); i < n; i++) {
+		Slot &slot = *drawOrder[i];
+		Attachment *attachment = slot.getAttachment();
+		if (!attachment || !slot.getBone().isActive()) continue;
+		if (attachment->getRTTI().isExactly(RegionAttachment::rtti)) {
+			worldVertices.setSize(8, 0);
+			static_cast<RegionAttachment *>(attachment)->computeWorldVertices(slot.getBone(), worldVertices, 0, 2);
+			vertexCount += 4;
+		} else if (attachment->getRTTI().isExactly(MeshAttachment::rtti)) {
+			MeshAttachment *mesh = static_cast<MeshAttachment *>(attachment);
+			worldVertices.setSize(mesh->getWorldVerticesLength(), 0);
+			mesh->computeWorldVertices(slot, 0, mesh->getWorldVerticesLength(), worldVertices, 0, 2);
+			vertexCount += mesh->getWorldVerticesLength() >> 1;
+		}
+	}
+	return vertexCount;
+}
+
+/// Plays the animations of 1, 100 and 10,000 instances, reporting the time per frame of each stage a game runs every frame
+/// and the bytes allocated per instance.
+static void measureInstances(const char *skeletonCase, SkeletonData *skeletonData, ProfilingSpineExtension &profiler) {
+	const int instanceCounts[] = {1, 100, 10000};
+	const int frameCounts[] = {300, 30, 3};
+	const float delta = 1 / 60.0f;
+
+	Vector<Animation *> &animations = skeletonData->getAnimations();
+	AnimationStateData stateData(skeletonData);
+	for (size_t c = 0; c < sizeof(instanceCounts) / sizeof(instanceCounts[0]); c++) {
+		int numInstances = instanceCounts[c], numFrames = frameCounts[c];
+		size_t liveBytes = profiler.getLiveBytes();
+		Vector<Skeleton *> skeletons;
+		Vector<AnimationState *> states;
+		for (int i = 0; i < numInstances; i++) {
+			Skeleton *skeleton = new(__FILE__, __LINE__) Skeleton(skeletonData);
+			AnimationState *state = new(__FILE__, __LINE__) AnimationState(&stateData);
+			// Spread the instances over the animations and their durations, so they do not all pose the same.
+			state->setAnimation(0, animations[i % animations.size()], true);
+			state->update(i * 0.0123f);
+			skeletons.add(skeleton);
+			states.add(state);
+		}
+
+		SkeletonClipping clipper;
+		SkeletonBounds bounds;
+		Vector<float> worldVertices;
+		double applyTime = 0, worldTime = 0, verticesTime = 0, clippingTime = 0, boundsTime = 0;
+		size_t vertexCount = 0, triangleCount = 0;
+		// The first frame grows the buffers and is not measured.
+		for (int frame = -1; frame < numFrames; frame++) {
+			double start = benchmarkTime();
+			for (int i = 0; i < numInstances; i++) {
+				states[i]->update(delta);
+				states[i]->apply(*skeletons[i]);
+			}
+			double end = benchmarkTime();
+			if (frame >= 0) applyTime += end - start;
+
+			start = end;
+			for (int i = 0; i < numInstances; i++)
+				skeletons[i]->updateWorldTransform();
+			end = benchmarkTime();
+			if (frame >= 0) worldTime += end - start;
+
+			start = end;
+			for (int i = 0; i < numInstances; i++)
+				vertexCount += computeWorldVertices(*skeletons[i], worldVertices);
+			end = benchmarkTime();
+			if (frame >= 0) verticesTime += end - start;
+
+			start = end;
+			for (int i = 0; i < numInstances; i++)
+				triangleCount += clipBenchmarkSkeleton(*skeletons[i], clipper, worldVertices, NULL);
+			end = benchmarkTime();
+			if (frame >= 0) clippingTime += end - start;
+
+			start = end;
+			for (int i = 0; i < numInstances; i++)
+				bounds.update(*skeletons[i], true);
+			end = benchmarkTime();
+			if (frame >= 0) boundsTime += end - start;
+
+			if (frame == -1) {
+				liveBytes = profiler.getLiveBytes() - liveBytes;
+				vertexCount = triangleCount = 0;
+			}
+		}
+
+		char name[64];
+		sprintf(name, "x%d/update+apply", numInstances);
+		report(skeletonCase, name, applyTime * 1e6 / numFrames, "us/frame");
+		sprintf(name, "x%d/updateWorldTransform", numInstances);
+		report(skeletonCase, name, worldTime * 1e6 / numFrames, "us/frame");
+		sprintf(name, "x%d/computeWorldVertices", numInstances);
+		report(skeletonCase, name, verticesTime * 1e6 / numFrames, "us/frame");
+		sprintf(name, "x%d/clipping", numInstances);
+		report(skeletonCase, name, clippingTime * 1e6 / numFrames, "us/frame");
+		sprintf(name, "x%d/SkeletonBounds::update", numInstances);
+		report(skeletonCase, name, boundsTime * 1e6 / numFrames, "us/frame");
+		sprintf(name, "x%d/memory", numInstances);
+		report(skeletonCase, name, liveBytes / 1024.0 / numInstances, "KB/instance");
+		if (c == 0) {
+			report(skeletonCase, "vertices", (double) vertexCount / numFrames, "count/frame");
+			report(skeletonCase, "clippedTriangles", (double) triangleCount / numFrames, "count/frame");
+		}
+
+		for (int i = 0; i < numInstances; i++) {
+			delete states[i];
+			delete skeletons[i];
+		}
+	}
+}
+
+/// Loads every skeleton in examples/*/export as JSON and binary, reporting the load time and the bytes the SkeletonData
+/// keeps allocated. Then measures the stages of a frame for 1, 100 and 10,000 instances.
+void spine::skeletonsBenchmark() {
+	const int numLoads = 5;
+
+	Vector<String> skeletonFiles, atlasFiles;
+	listBenchmarkSkeletons(skeletonFiles, atlasFiles);
+	for (size_t i = 0; i < skeletonFiles.size(); i++) {
+		// The file name without directory and extension, followed by the format, eg "spineboy-pro/json".
+		const String &skeletonFile = skeletonFiles[i];
+		const char *fileName = strrchr(skeletonFile.buffer(), '/') + 1;
+		char skeletonCase[96];
+		sprintf(skeletonCase, "%.*s/%s", (int) (strlen(fileName) - 5), fileName, isBinary(skeletonFile) ? "binary" : "json");
+		FILE *file = fopen(atlasFiles[i].buffer(), "rb");
+		if (!file) {
+			printf("# %s: no atlas\n", skeletonCase);
+			continue;
+		}
+		fclose(file);
+
+		Atlas *atlas = new(__FILE__, __LINE__) Atlas(atlasFiles[i], NULL);
+		double start = benchmarkTime();
+		int loads = 0;
+		for (; loads < numLoads; loads++) {
+			SkeletonData *skeletonData = loadSkeletonData(atlas, skeletonFile);
+			if (!skeletonData) break;
+			delete skeletonData;
+		}
+		double loadTime = benchmarkTime() - start;
+		if (loads < numLoads) {
+			printf("# %s: could not be loaded\n", skeletonCase);
+			delete atlas;
+			continue;
+		}
+
+		// Measure the memory with a separate load, so tracking the allocations does not add to the load time.
+		SpineExtension *extension = SpineExtension::getInstance();
+		ProfilingSpineExtension profiler(extension);
+		SpineExtension::setInstance(&profiler);
+		SkeletonData *skeletonData = loadSkeletonData(atlas, skeletonFile);
+		report(skeletonCase, "load", loadTime * 1000 / numLoads, "ms");
+		report(skeletonCase, "memory", profiler.getLiveBytes() / 1024.0, "KB");
+
+		// Both formats produce the same SkeletonData, so the stages are measured for the binary file when there is one. It
+		// is listed right after the JSON file.
+		bool measure = skeletonData->getAnimations().size() > 0;
+		if (!isBinary(skeletonFile) && i + 1 < skeletonFiles.size()) {
+			const String &next = skeletonFiles[i + 1];
+			if (isBinary(next) && next.length() == skeletonFile.length() &&
+				strncmp(next.buffer(), skeletonFile.buffer(), next.length() - 5) == 0)
+				measure = false;
+		}
+		if (measure) measureInstances(skeletonCase, skeletonData, profiler);
+
+		delete skeletonData;
+		SpineExtension::setInstance(extension);
+		delete atlas;
+	}
+}
@@ -0,0 +1,57 @@
+#include <spine/spine.h>
+
+#include "Benchmark.h"
+
+using namespace spine;
+
+/// Swaps mix-and-match between its skins and a few combined skins 10,000 times, as a character customizer does, with the
+/// update orders cached by SkeletonData and sorted on every Skeleton::updateCache().
+void spine::skinSwapBenchmark() {
+	const int numSwaps = 10000, numCombined = 16;
+	Atlas *atlas;
+	SkeletonData *skeletonData = loadBenchmarkSkeleton("mix-and-match", true, atlas);
+	if (!skeletonData) return;
+
+	Vector<Skin *> &skins = skeletonData->getSkins();
+	Vector<Skin *> combined;
+	unsigned int random = 1;
+	for (int i = 0; i < numCombined; i++) {
+		Skin *skin = new(__FILE__, __LINE__) Skin("combined");
+		for (int ii = 0; ii < 4; ii++) {
+			random = random * 1103515245 + 12345;
+			skin->addSkin(skins[(random >> 16) % skins.size()]);
+		}
+		combined.add(skin);
+	}
+
+	const char *modeNames[] = {"cached", "sorted"};
+	for (int mode = 0; mode < 2; mode++) {
+		skeletonData->setMaxUpdateOrders(mode == 0 ? 64 : 0);
+		Skeleton skeleton(skeletonData);
+		random = 1;
+		double start = benchmarkTime();
+		for (int i = 0; i < numSwaps; i++) {
+			random = random * 1103515245 + 12345;
+			size_t index = (random >> 16) % (skins.size() + combined.size());
+			skeleton.setSkin(index < skins.size() ? skins[index] : combined[index - skins.size()]);
+		}
+		double elapsed = benchmarkTime() - start;
+
+		start = benchmarkTime();
+		for (int i = 0; i < numSwaps; i++)
+			skeleton.updateCache();
+		double updateCacheElapsed = benchmarkTime() - start;
+
+		char name[64];
+		sprintf(name, "setSkin/%s", modeNames[mode]);
+		benchmarkReport("skins", name, elapsed * 1e6 / numSwaps, "us/swap");
+		sprintf(name, "updateCache/%s", modeNames[mode]);
+		benchmarkReport("skins", name, updateCacheElapsed * 1e6 / numSwaps, "us/call");
+		sprintf(name, "all/%s", modeNames[mode]);
+		benchmarkReport("skins", name, elapsed * 1000, "ms");
+	}
+
+	ContainerUtil::cleanUpVectorOfPointers(combined);
+	delete skeletonData;
+	delete atlas;
+}
@@ -0,0 +1,80 @@
+#include <spine/spine.h>
+
+#include "Benchmark.h"
+
+using namespace spine;
+
+/// SkeletonSnapshot capture and restore of a skeleton with its animation state, and a rollback of 10 frames: restore,
+/// then AnimationState::update(), AnimationState::apply() and Skeleton::updateWorldTransform() for each frame.
+void spine::snapshotBenchmark() {
+	const char *names[] = {"spineboy", "raptor", "dragon", "tank"};
+	const int numSkeletons = 100, numRepeats = 100, numRollbackFrames = 10;
+
+	for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+		Atlas *atlas;
+		SkeletonData *skeletonData = loadBenchmarkSkeleton(names[i], true, atlas);
+		if (!skeletonData) continue;
+		Vector<Animation *> &animations = skeletonData->getAnimations();
+		AnimationStateData stateData(skeletonData);
+		stateData.setDefaultMix(0.4f);
+
+		Vector<Skeleton *> skeletons;
+		Vector<AnimationState *> states;
+		Vector<SkeletonSnapshot *> snapshots;
+		for (int ii = 0; ii < numSkeletons; ii++) {
+			Skeleton *skeleton = new(__FILE__, __LINE__) Skeleton(skeletonData);
+			AnimationState *state = new(__FILE__, __LINE__) AnimationState(&stateData);
+			state->setAnimation(0, animations[ii % animations.size()], true);
+			state->addAnimation(0, animations[(ii + 1) % animations.size()], true, 0.2f);
+			for (int frame = 0; frame < 15 + ii % 10; frame++) {
+				state->update(1 / 60.0f);
+				state->apply(*skeleton);
+			}
+			skeleton->updateWorldTransform();
+			skeletons.add(skeleton);
+			states.add(state);
+			snapshots.add(new(__FILE__, __LINE__) SkeletonSnapshot());
+		}
+
+		double start = benchmarkTime();
+		for (int repeat = 0; repeat < numRepeats; repeat++)
+			for (int ii = 0; ii < numSkeletons; ii++)
+				snapshots[ii]->capture(*skeletons[ii], states[ii]);
+		double capture = benchmarkTime() - start;
+
+		start = benchmarkTime();
+		for (int repeat = 0; repeat < numRepeats; repeat++)
+			for (int ii = 0; ii < numSkeletons; ii++)
+				snapshots[ii]->restore(*skeletons[ii], states[ii]);
+		double restore = benchmarkTime() - start;
+
+		start = benchmarkTime();
+		for (int repeat = 0; repeat < numRepeats / 10; repeat++) {
+			for (int ii = 0; ii < numSkeletons; ii++) {
+				snapshots[ii]->restore(*skeletons[ii], states[ii]);
+				for (int frame = 0; frame < numRollbackFrames; frame++) {
+					states[ii]->update(1 / 60.0f);
+					states[ii]->apply(*skeletons[ii]);
+					skeletons[ii]->updateWorldTransform();
+				}
+			}
+		}
+		double rollback = benchmarkTime() - start;
+
+		char name[64];
+		sprintf(name, "%s/capture", names[i]);
+		benchmarkReport("snapshot", name, capture * 1e6 / ((double) numSkeletons * numRepeats), "us/skeleton");
+		sprintf(name, "%s/restore", names[i]);
+		benchmarkReport("snapshot", name, restore * 1e6 / ((double) numSkeletons * numRepeats), "us/skeleton");
+		sprintf(name, "%s/rollback", names[i]);
+		benchmarkReport("snapshot", name, rollback * 1e6 / ((double) numSkeletons * (numRepeats / 10)), "us/skeleton");
+		sprintf(name, "%s/size", names[i]);
+		benchmarkReport("snapshot", name, snapshots[0]->size() / 1024.0, "KB");
+
+		ContainerUtil::cleanUpVectorOfPointers(snapshots);
+		ContainerUtil::cleanUpVectorOfPointers(states);
+		ContainerUtil::cleanUpVectorOfPointers(skeletons);
+		delete skeletonData;
+		delete atlas;
+	}
+}
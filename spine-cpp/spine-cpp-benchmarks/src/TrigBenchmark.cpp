@@ -0,0 +1,117 @@
+#include <spine/spine.h>
+
+#include <math.h>
+
+#include "Benchmark.h"
+
+using namespace spine;
+
+typedef void (*SinCosFunction)(float angle, float &outSin, float &outCos);
+
+struct SinCosVariant {
+	const char *name;
+	SinCosFunction function;
+	bool degrees;
+};
+
+#if defined(SPINE_TRIG_POLYNOMIAL)
+static const char *trigMode = "polynomial";
+#elif defined(SPINE_TRIG_TABLE)
+static const char *trigMode = "table";
+#else
+static const char *trigMode = "libm";
+#endif
+
+/// Accuracy and speed of the MathUtil sine and cosine implementations, then Skeleton::updateWorldTransform() with the
+/// implementation selected at build time. Build with SPINE_TRIG_POLYNOMIAL or SPINE_TRIG_TABLE to compare skeletons.
+void spine::trigBenchmark() {
+	SinCosVariant variants[] = {
+		{"libm", MathUtil::sinCosLibm, false},
+		{"table", MathUtil::sinCosTable, false},
+		{"polynomial", MathUtil::sinCosPolynomial, false},
+		{"libmDeg", MathUtil::sinCosDegLibm, true},
+		{"tableDeg", MathUtil::sinCosDegTable, true},
+		{"polynomialDeg", MathUtil::sinCosDegPolynomial, true}
+	};
+	const int numVariants = sizeof(variants) / sizeof(variants[0]);
+
+	// Errors against double precision over ten turns in both directions.
+	const int numSamples = 1000000;
+	for (int i = 0; i < numVariants; i++) {
+		SinCosVariant &variant = variants[i];
+		double maxError = 0, sumError = 0;
+		for (int ii = 0; ii <= numSamples; ii++) {
+			double degrees = -3600.0 + 7200.0 * ii / numSamples;
+			float angle = variant.degrees ? (float) degrees : (float) (degrees * 3.14159265358979323846 / 180);
+			double radians = variant.degrees ? angle * 3.14159265358979323846 / 180 : angle;
+			float s, c;
+			variant.function(angle, s, c);
+			double sinError = fabs(s - ::sin(radians)), cosError = fabs(c - ::cos(radians));
+			double error = sinError > cosError ? sinError : cosError;
+			if (error > maxError) maxError = error;
+			sumError += error;
+		}
+		char name[64];
+		sprintf(name, "%s/maxError", variant.name);
+		benchmarkReport("trig", name, maxError * 1e9, "1e-9");
+		sprintf(name, "%s/averageError", variant.name);
+		benchmarkReport("trig", name, sumError / (numSamples + 1) * 1e9, "1e-9");
+	}
+
+	// Angles typical for bones, within a couple of turns.
+	const int numAngles = 4096, numRepeats = 500;
+	Vector<float> angles, sines, cosines;
+	angles.setSize(numAngles, 0);
+	sines.setSize(numAngles, 0);
+	cosines.setSize(numAngles, 0);
+	for (int i = 0; i < numAngles; i++)
+		angles[i] = MathUtil::random() * 1440 - 720;
+	for (int i = 0; i < numVariants; i++) {
+		SinCosVariant &variant = variants[i];
+		double start = benchmarkTime();
+		for (int repeat = 0; repeat < numRepeats; repeat++)
+			for (int ii = 0; ii < numAngles; ii++)
+				variant.function(angles[ii], sines[ii], cosines[ii]);
+		char name[64];
+		sprintf(name, "%s/sinCos", variant.name);
+		benchmarkReport("trig", name, (benchmarkTime() - start) * 1e9 / ((double) numAngles * numRepeats), "ns/call");
+	}
+
+	// The polynomial inlined into a loop, as in the pose buffer's local transform pass.
+	double start = benchmarkTime();
+	for (int repeat = 0; repeat < numRepeats; repeat++)
+		for (int i = 0; i < numAngles; i++)
+			MathUtil::sinCosDegPolynomial(angles[i], sines[i], cosines[i]);
+	benchmarkReport("trig", "polynomialDeg/inlined", (benchmarkTime() - start) * 1e9 / ((double) numAngles * numRepeats), "ns/call");
+
+	const char *names[] = {"spineboy", "raptor", "stretchyman", "tank", "dragon"};
+	const int numSkeletons = 100, numFrames = 200;
+	for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+		Atlas *atlas;
+		SkeletonData *skeletonData = loadBenchmarkSkeleton(names[i], true, atlas);
+		if (!skeletonData) continue;
+		Animation *animation = skeletonData->getAnimations()[0];
+
+		Vector<Skeleton *> skeletons;
+		for (int ii = 0; ii < numSkeletons; ii++)
+			skeletons.add(new(__FILE__, __LINE__) Skeleton(skeletonData));
+
+		double elapsed = 0;
+		for (int frame = 0; frame < numFrames; frame++) {
+			float time = frame / 60.0f;
+			for (int ii = 0; ii < numSkeletons; ii++)
+				animation->apply(*skeletons[ii], time, time, true, NULL, 1, MixBlend_Setup, MixDirection_In);
+			double frameStart = benchmarkTime();
+			for (int ii = 0; ii < numSkeletons; ii++)
+				skeletons[ii]->updateWorldTransform();
+			elapsed += benchmarkTime() - frameStart;
+		}
+
+		char name[64];
+		sprintf(name, "%s/%s", names[i], trigMode);
+		benchmarkReport("trig", name, elapsed * 1e6 / ((double) numSkeletons * numFrames), "us/skeleton");
+		ContainerUtil::cleanUpVectorOfPointers(skeletons);
+		delete skeletonData;
+		delete atlas;
+	}
+}
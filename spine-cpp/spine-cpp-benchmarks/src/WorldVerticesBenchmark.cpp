@@ -0,0 +1,69 @@
+#include <spine/spine.h>
+
+#include "Benchmark.h"
+
+using namespace spine;
+
+/// RegionAttachment and VertexAttachment::computeWorldVertices() for every visible attachment, plus Skeleton::getBounds().
+/// Build with SPINE_NO_SIMD to compare against the scalar path.
+void spine::worldVerticesBenchmark() {
+	const char *names[] = {"dragon", "vine", "stretchyman", "raptor", "spineboy"};
+	const int numFrames = 2000;
+	printf("# instruction set: %s\n", SimdUtil::getInstructionSet());
+
+	for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+		Atlas *atlas;
+		SkeletonData *skeletonData = loadBenchmarkSkeleton(names[i], true, atlas);
+		if (!skeletonData) continue;
+		Skeleton skeleton(skeletonData);
+		Animation *animation = skeletonData->getAnimations()[0];
+		Vector<float> worldVertices;
+		float checksum = 0;
+		size_t vertexCount = 0;
+
+		double elapsed = 0, boundsElapsed = 0;
+		for (int frame = 0; frame < numFrames; frame++) {
+			float time = frame / 60.0f;
+			animation->apply(skeleton, time, time, true, NULL, 1, MixBlend_Setup, MixDirection_In);
+			skeleton.updateWorldTransform();
+
+			double start = benchmarkTime();
+			Vector<Slot *> &drawOrder = skeleton.getDrawOrder();
+			for (size_t ii = 0; ii < drawOrder.size(); ii++) {
+				Slot &slot = *drawOrder[ii];
+				Attachment *attachment = slot.getAttachment();
+				if (!attachment) continue;
+				if (attachment->getRTTI().isExactly(RegionAttachment::rtti)) {
+					worldVertices.setSize(8, 0);
+					static_cast<RegionAttachment *>(attachment)->computeWorldVertices(slot.getBone(), worldVertices, 0, 2);
+					vertexCount += 4;
+				} else if (attachment->getRTTI().isExactly(MeshAttachment::rtti)) {
+					MeshAttachment *mesh = static_cast<MeshAttachment *>(attachment);
+					worldVertices.setSize(mesh->getWorldVerticesLength(), 0);
+					mesh->computeWorldVertices(slot, 0, mesh->getWorldVerticesLength(), worldVertices, 0, 2);
+					vertexCount += mesh->getWorldVerticesLength() >> 1;
+				} else {
+					continue;
+				}
+				checksum += worldVertices[0];
+			}
+			elapsed += benchmarkTime() - start;
+
+			start = benchmarkTime();
+			float x, y, width, height;
+			skeleton.getBounds(x, y, width, height, worldVertices);
+			boundsElapsed += benchmarkTime() - start;
+			checksum += width;
+		}
+
+		char name[64];
+		sprintf(name, "%s/computeWorldVertices", names[i]);
+		benchmarkReport("worldvertices", name, elapsed * 1e9 / vertexCount, "ns/vertex");
+		sprintf(name, "%s/getBounds", names[i]);
+		benchmarkReport("worldvertices", name, boundsElapsed * 1e6 / numFrames, "us/skeleton");
+		if (checksum != checksum) printf("# invalid vertices\n");
+
+		delete skeletonData;
+		delete atlas;
+	}
+}
@@ -0,0 +1,51 @@
+#include <stdio.h>
+#include <string.h>
+#include <spine/spine.h>
+
+#include "Benchmark.h"
+
+using namespace spine;
+
+struct BenchmarkEntry {
+	const char *name;
+	void (*run)();
+};
+
+static BenchmarkEntry benchmarks[] = {
+		{"arena", arenaBenchmark},
+		{"attachments", attachmentBenchmark},
+		{"baked", bakedAnimationBenchmark},
+		{"batchupdater", batchUpdaterBenchmark},
+		{"clipping", clippingBenchmark},
+		{"compression", compressionBenchmark},
+		{"curves", curvesBenchmark},
+		{"hashmap", hashMapBenchmark},
+		{"instancing", instancingBenchmark},
+		{"names", nameIndexBenchmark},
+		{"paths", pathConstraintBenchmark},
+		{"posebuffer", poseBufferBenchmark},
+		{"render", renderBenchmark},
+		{"skeletons", skeletonsBenchmark},
+		{"skins", skinSwapBenchmark},
+		{"snapshot", snapshotBenchmark},
+		{"trig", trigBenchmark},
+		{"worldvertices", worldVerticesBenchmark}
+};
+
+namespace spine {
+	SpineExtension* getDefaultExtension() {
+		return new DefaultSpineExtension();
+	}
+}
+
+/// Runs all benchmarks, or only the ones named on the command line.
+int main(int argc, char **argv) {
+	size_t numBenchmarks = sizeof(benchmarks) / sizeof(BenchmarkEntry);
+	for (size_t i = 0; i < numBenchmarks; i++) {
+		bool selected = argc < 2;
+		for (int j = 1; j < argc; j++)
+			if (strcmp(argv[j], benchmarks[i].name) == 0) selected = true;
+		if (selected) benchmarks[i].run();
+	}
+	return 0;
+}
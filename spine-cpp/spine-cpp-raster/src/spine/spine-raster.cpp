@@ -0,0 +1,451 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#include <spine/spine-raster.h>
+
+#include <math.h>
+#include <string.h>
+
+#if defined(SPINE_SIMD_SSE2)
+#include <emmintrin.h>
+#elif defined(SPINE_SIMD_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace spine {
+
+/// A vertex in pixel space with its texture coordinates and color, as rasterized.
+struct RasterVertex {
+	float x, y, u, v, r, g, b, a;
+};
+
+static unsigned char toByte(float value) {
+	if (value <= 0) return 0;
+	if (value >= 1) return 255;
+	return (unsigned char) (value * 255 + 0.5f);
+}
+
+static int wrap(int value, int size, bool repeat) {
+	if (repeat) {
+		value %= size;
+		return value < 0 ? value + size : value;
+	}
+	return value < 0 ? 0 : (value >= size ? size - 1 : value);
+}
+
+/// Samples the texture at u, v into r, g, b, a from 0 to 1.
+static void sample(RasterTexture &texture, float u, float v, float *rgba) {
+	int width = texture.getWidth(), height = texture.getHeight();
+	const unsigned char *pixels = texture.getPixels();
+	const float scale = 1 / 255.0f;
+	bool repeat = texture.isRepeat();
+	if (!texture.isLinear()) {
+		const unsigned char *texel = pixels + (wrap((int) floorf(u * width), width, repeat) +
+			wrap((int) floorf(v * height), height, repeat) * width) * 4;
+		for (int i = 0; i < 4; i++)
+			rgba[i] = texel[i] * scale;
+		return;
+	}
+	float x = u * width - 0.5f, y = v * height - 0.5f;
+	float floorX = floorf(x), floorY = floorf(y);
+	float fx = x - floorX, fy = y - floorY;
+	int x0 = wrap((int) floorX, width, repeat), x1 = wrap((int) floorX + 1, width, repeat);
+	int y0 = wrap((int) floorY, height, repeat) * width, y1 = wrap((int) floorY + 1, height, repeat) * width;
+	const unsigned char *t00 = pixels + (x0 + y0) * 4, *t10 = pixels + (x1 + y0) * 4;
+	const unsigned char *t01 = pixels + (x0 + y1) * 4, *t11 = pixels + (x1 + y1) * 4;
+	for (int i = 0; i < 4; i++) {
+		float top = t00[i] + (t10[i] - t00[i]) * fx, bottom = t01[i] + (t11[i] - t01[i]) * fx;
+		rgba[i] = (top + (bottom - top) * fy) * scale;
+	}
+}
+
+/// Blends a fragment into a pixel like the blend functions of spine-sfml. Alpha is always composited as source over.
+static void blend(unsigned char *pixel, const float *source, BlendMode blendMode, bool premultipliedAlpha) {
+	const float scale = 1 / 255.0f;
+	float sourceAlpha = source[3];
+	for (int i = 0; i < 3; i++) {
+		float s = source[i], d = pixel[i] * scale, result;
+		switch (blendMode) {
+			case BlendMode_Additive:
+				result = (premultipliedAlpha ? s : s * sourceAlpha) + d;
+				break;
+			case BlendMode_Multiply:
+				result = s * d + d * (1 - sourceAlpha);
+				break;
+			case BlendMode_Screen:
+				result = s + d * (1 - s);
+				break;
+			default:
+				result = (premultipliedAlpha ? s : s * sourceAlpha) + d * (1 - sourceAlpha);
+		}
+		pixel[i] = toByte(result);
+	}
+	pixel[3] = toByte(sourceAlpha + pixel[3] * scale * (1 - sourceAlpha));
+}
+
+/// The edge function of a triangle edge from a to b, w = A * x + B * y + C, positive inside a counter clockwise triangle.
+struct Edge {
+	float a, b, c;
+	/// Pixels exactly on the edge are inside for top-left edges only, so pixels on an edge shared by two triangles are
+	/// drawn once.
+	bool inclusive;
+
+	Edge(const RasterVertex &from, const RasterVertex &to) : a(from.y - to.y), b(to.x - from.x),
+		c((to.y - from.y) * from.x - (to.x - from.x) * from.y), inclusive(a > 0 || (a == 0 && b < 0)) {
+	}
+
+	bool inside(float w) const {
+		return w > 0 || (w == 0 && inclusive);
+	}
+};
+
+struct Triangle {
+	const RasterVertex *v0, *v1, *v2;
+	Edge e0, e1, e2;
+	float inverseArea;
+
+	Triangle(const RasterVertex *p0, const RasterVertex *p1, const RasterVertex *p2, float area) : v0(p0), v1(p1), v2(p2),
+		e0(*p1, *p2), e1(*p2, *p0), e2(*p0, *p1), inverseArea(1 / area) {
+	}
+
+	void shade(unsigned char *pixel, float w0, float w1, float w2, RasterTexture &texture, BlendMode blendMode,
+		bool premultipliedAlpha) const {
+		float l0 = w0 * inverseArea, l1 = w1 * inverseArea, l2 = w2 * inverseArea;
+		float fragment[4];
+		sample(texture, v0->u * l0 + v1->u * l1 + v2->u * l2, v0->v * l0 + v1->v * l1 + v2->v * l2, fragment);
+		fragment[0] *= v0->r * l0 + v1->r * l1 + v2->r * l2;
+		fragment[1] *= v0->g * l0 + v1->g * l1 + v2->g * l2;
+		fragment[2] *= v0->b * l0 + v1->b * l1 + v2->b * l2;
+		fragment[3] *= v0->a * l0 + v1->a * l1 + v2->a * l2;
+		blend(pixel, fragment, blendMode, premultipliedAlpha);
+	}
+};
+
+/// Draws the pixels of a triangle whose centers are inside it, in the rows from minRow to maxRow, exclusive.
+static void drawTriangle(RasterImage &image, int minRow, int maxRow, const RasterVertex *v0, const RasterVertex *v1,
+	const RasterVertex *v2, RasterTexture &texture, BlendMode blendMode, bool premultipliedAlpha) {
+	float area = (v1->x - v0->x) * (v2->y - v0->y) - (v1->y - v0->y) * (v2->x - v0->x);
+	if (!(area != 0)) return;
+	if (area < 0) {
+		const RasterVertex *swap = v1;
+		v1 = v2;
+		v2 = swap;
+		area = -area;
+	}
+
+	int width = image.getWidth();
+	float minX = MathUtil::min(v0->x, MathUtil::min(v1->x, v2->x)), maxX = MathUtil::max(v0->x, MathUtil::max(v1->x, v2->x));
+	float minY = MathUtil::min(v0->y, MathUtil::min(v1->y, v2->y)), maxY = MathUtil::max(v0->y, MathUtil::max(v1->y, v2->y));
+	if (minX >= width || maxX < 0 || minY >= maxRow || maxY < minRow) return;
+	int startX = MathUtil::max(0, (int) floorf(minX)), endX = MathUtil::min(width - 1, (int) ceilf(maxX));
+	int startY = MathUtil::max(minRow, (int) floorf(minY)), endY = MathUtil::min(maxRow - 1, (int) ceilf(maxY));
+
+	Triangle triangle(v0, v1, v2, area);
+	const Edge &e0 = triangle.e0, &e1 = triangle.e1, &e2 = triangle.e2;
+	float centerX = startX + 0.5f;
+	for (int y = startY; y <= endY; y++) {
+		float centerY = y + 0.5f;
+		// The edge functions at the first pixel of the row. Pixel k of the row adds a * k, so every code path computes
+		// the same values.
+		float row0 = e0.a * centerX + e0.b * centerY + e0.c;
+		float row1 = e1.a * centerX + e1.b * centerY + e1.c;
+		float row2 = e2.a * centerX + e2.b * centerY + e2.c;
+		unsigned char *pixels = image.getPixels() + (size_t) y * width * 4;
+		int x = startX;
+#if defined(SPINE_SIMD_SSE2)
+		const __m128 zero = _mm_setzero_ps(), lanes = _mm_set_ps(3, 2, 1, 0);
+		const __m128 a0 = _mm_set1_ps(e0.a), a1 = _mm_set1_ps(e1.a), a2 = _mm_set1_ps(e2.a);
+		const __m128 inclusive0 = _mm_castsi128_ps(_mm_set1_epi32(e0.inclusive ? -1 : 0));
+		const __m128 inclusive1 = _mm_castsi128_ps(_mm_set1_epi32(e1.inclusive ? -1 : 0));
+		const __m128 inclusive2 = _mm_castsi128_ps(_mm_set1_epi32(e2.inclusive ? -1 : 0));
+		for (; x + 3 <= endX; x += 4) {
+			__m128 k = _mm_add_ps(_mm_set1_ps((float) (x - startX)), lanes);
+			__m128 w0 = _mm_add_ps(_mm_set1_ps(row0), _mm_mul_ps(a0, k));
+			__m128 w1 = _mm_add_ps(_mm_set1_ps(row1), _mm_mul_ps(a1, k));
+			__m128 w2 = _mm_add_ps(_mm_set1_ps(row2), _mm_mul_ps(a2, k));
+			__m128 inside = _mm_or_ps(_mm_cmpgt_ps(w0, zero), _mm_and_ps(_mm_cmpeq_ps(w0, zero), inclusive0));
+			inside = _mm_and_ps(inside, _mm_or_ps(_mm_cmpgt_ps(w1, zero), _mm_and_ps(_mm_cmpeq_ps(w1, zero), inclusive1)));
+			inside = _mm_and_ps(inside, _mm_or_ps(_mm_cmpgt_ps(w2, zero), _mm_and_ps(_mm_cmpeq_ps(w2, zero), inclusive2)));
+			int mask = _mm_movemask_ps(inside);
+			if (!mask) continue;
+			float ws0[4], ws1[4], ws2[4];
+			_mm_storeu_ps(ws0, w0);
+			_mm_storeu_ps(ws1, w1);
+			_mm_storeu_ps(ws2, w2);
+			for (int i = 0; i < 4; i++)
+				if (mask & (1 << i))
+					triangle.shade(pixels + (x + i) * 4, ws0[i], ws1[i], ws2[i], texture, blendMode, premultipliedAlpha);
+		}
+#elif defined(SPINE_SIMD_NEON)
+		const float lanesData[] = {0, 1, 2, 3};
+		const float32x4_t zero = vdupq_n_f32(0), lanes = vld1q_f32(lanesData);
+		const float32x4_t a0 = vdupq_n_f32(e0.a), a1 = vdupq_n_f32(e1.a), a2 = vdupq_n_f32(e2.a);
+		const uint32x4_t inclusive0 = vdupq_n_u32(e0.inclusive ? 0xffffffff : 0);
+		const uint32x4_t inclusive1 = vdupq_n_u32(e1.inclusive ? 0xffffffff : 0);
+		const uint32x4_t inclusive2 = vdupq_n_u32(e2.inclusive ? 0xffffffff : 0);
+		for (; x + 3 <= endX; x += 4) {
+			float32x4_t k = vaddq_f32(vdupq_n_f32((float) (x - startX)), lanes);
+			float32x4_t w0 = vaddq_f32(vdupq_n_f32(row0), vmulq_f32(a0, k));
+			float32x4_t w1 = vaddq_f32(vdupq_n_f32(row1), vmulq_f32(a1, k));
+			float32x4_t w2 = vaddq_f32(vdupq_n_f32(row2), vmulq_f32(a2, k));
+			uint32x4_t inside = vorrq_u32(vcgtq_f32(w0, zero), vandq_u32(vceqq_f32(w0, zero), inclusive0));
+			inside = vandq_u32(inside, vorrq_u32(vcgtq_f32(w1, zero), vandq_u32(vceqq_f32(w1, zero), inclusive1)));
+			inside = vandq_u32(inside, vorrq_u32(vcgtq_f32(w2, zero), vandq_u32(vceqq_f32(w2, zero), inclusive2)));
+			unsigned int mask[4];
+			vst1q_u32(mask, inside);
+			if (!(mask[0] | mask[1] | mask[2] | mask[3])) continue;
+			float ws0[4], ws1[4], ws2[4];
+			vst1q_f32(ws0, w0);
+			vst1q_f32(ws1, w1);
+			vst1q_f32(ws2, w2);
+			for (int i = 0; i < 4; i++)
+				if (mask[i])
+					triangle.shade(pixels + (x + i) * 4, ws0[i], ws1[i], ws2[i], texture, blendMode, premultipliedAlpha);
+		}
+#endif
+		for (; x <= endX; x++) {
+			float k = (float) (x - startX);
+			float w0 = row0 + e0.a * k, w1 = row1 + e1.a * k, w2 = row2 + e2.a * k;
+			if (e0.inside(w0) && e1.inside(w1) && e2.inside(w2))
+				triangle.shade(pixels + x * 4, w0, w1, w2, texture, blendMode, premultipliedAlpha);
+		}
+	}
+}
+
+RasterImage::RasterImage(int width, int height) : _width(width), _height(height) {
+	_pixels = SpineExtension::calloc<unsigned char>((size_t) width * height * 4, __FILE__, __LINE__);
+}
+
+RasterImage::~RasterImage() {
+	SpineExtension::free(_pixels, __FILE__, __LINE__);
+}
+
+void RasterImage::clear(const Color &color) {
+	unsigned int packed = RenderCommandBuilder::packColor(color.r, color.g, color.b, color.a);
+	unsigned char rgba[4] = {(unsigned char) packed, (unsigned char) (packed >> 8), (unsigned char) (packed >> 16),
+							 (unsigned char) (packed >> 24)};
+	for (size_t i = 0, n = (size_t) _width * _height * 4; i < n; i += 4)
+		memcpy(_pixels + i, rgba, 4);
+}
+
+bool RasterImage::writeTga(const char *path) {
+	FILE *file = fopen(path, "wb");
+	if (!file) return false;
+	// Uncompressed true color with 8 alpha bits, origin at the top left.
+	unsigned char header[18] = {0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+								(unsigned char) _width, (unsigned char) (_width >> 8),
+								(unsigned char) _height, (unsigned char) (_height >> 8), 32, 0x28};
+	bool success = fwrite(header, 1, 18, file) == 18;
+	unsigned char *row = SpineExtension::alloc<unsigned char>((size_t) _width * 4, __FILE__, __LINE__);
+	for (int y = 0; y < _height && success; y++) {
+		const unsigned char *pixels = _pixels + (size_t) y * _width * 4;
+		for (int x = 0; x < _width; x++) {
+			row[x * 4] = pixels[x * 4 + 2];
+			row[x * 4 + 1] = pixels[x * 4 + 1];
+			row[x * 4 + 2] = pixels[x * 4];
+			row[x * 4 + 3] = pixels[x * 4 + 3];
+		}
+		success = fwrite(row, 4, _width, file) == (size_t) _width;
+	}
+	SpineExtension::free(row, __FILE__, __LINE__);
+	return fclose(file) == 0 && success;
+}
+
+void RasterTextureLoader::load(AtlasPage &page, const String &path) {
+	bool linear = page.magFilter != TextureFilter_Nearest && page.magFilter != TextureFilter_Unknown;
+	bool repeat = page.uWrap == TextureWrap_Repeat && page.vWrap == TextureWrap_Repeat;
+	int width = 0, height = 0;
+	Vector<unsigned char> pixels;
+	RasterTexture *texture;
+	if (_decoder && _decoder(path, width, height, pixels) && width > 0 && height > 0 &&
+		pixels.size() >= (size_t) width * height * 4) {
+		texture = new(__FILE__, __LINE__) RasterTexture(width, height, linear, repeat);
+		memcpy(texture->getPixels(), pixels.buffer(), (size_t) width * height * 4);
+		if (page.width == 0 || page.height == 0) {
+			page.width = width;
+			page.height = height;
+		}
+	} else {
+		texture = new(__FILE__, __LINE__) RasterTexture(1, 1, false, true);
+		texture->clear(Color(1, 1, 1, 1));
+	}
+	page.setRendererObject(texture);
+}
+
+void RasterTextureLoader::unload(void *texture) {
+	delete (RasterTexture *) texture;
+}
+
+SkeletonRasterizer::SkeletonRasterizer(int workerCount) : _scaleX(1), _scaleY(1), _translateX(0), _translateY(0),
+	_generation(0),
+	_busyWorkers(0),
+	_shutdown(false),
+	_image(NULL) {
+	if (workerCount < 0) workerCount = Thread::getProcessorCount() - 1;
+	for (int i = 0; i < workerCount; i++) {
+		Worker *worker = new(__FILE__, __LINE__) Worker();
+		worker->rasterizer = this;
+		worker->band = i + 1;
+		if (!worker->thread.start(runWorker, worker)) {
+			delete worker;
+			break;
+		}
+		_workers.add(worker);
+	}
+}
+
+SkeletonRasterizer::~SkeletonRasterizer() {
+	_mutex.lock();
+	_shutdown = true;
+	_workAvailable.broadcast();
+	_mutex.unlock();
+	for (size_t i = 0; i < _workers.size(); i++) {
+		_workers[i]->thread.join();
+		delete _workers[i];
+	}
+}
+
+void SkeletonRasterizer::setTransform(float scaleX, float scaleY, float translateX, float translateY) {
+	_scaleX = scaleX;
+	_scaleY = scaleY;
+	_translateX = translateX;
+	_translateY = translateY;
+}
+
+void SkeletonRasterizer::fit(float x, float y, float width, float height, int imageWidth, int imageHeight, float margin) {
+	float scale = MathUtil::min((imageWidth - margin * 2) / MathUtil::max(width, 0.0001f),
+		(imageHeight - margin * 2) / MathUtil::max(height, 0.0001f));
+	float scaleY = Bone::isYDown() ? scale : -scale;
+	setTransform(scale, scaleY, imageWidth * 0.5f - (x + width * 0.5f) * scale,
+		imageHeight * 0.5f - (y + height * 0.5f) * scaleY);
+}
+
+void SkeletonRasterizer::clear() {
+	_builder.clear();
+}
+
+void SkeletonRasterizer::add(Skeleton &skeleton) {
+	_builder.add(skeleton);
+}
+
+void SkeletonRasterizer::rasterize(RasterImage &image) {
+	// Transform the positions to pixels once, for all bands.
+	size_t vertexCount = _builder.getVertexCount();
+	_pixelPositions.setSize(vertexCount << 1, 0);
+	float *positions = _builder.getPositions().buffer(), *pixelPositions = _pixelPositions.buffer();
+	for (size_t i = 0; i < vertexCount; i++) {
+		pixelPositions[i << 1] = positions[i << 1] * _scaleX + _translateX;
+		pixelPositions[(i << 1) + 1] = positions[(i << 1) + 1] * _scaleY + _translateY;
+	}
+
+	_image = &image;
+	if (_workers.size() == 0) {
+		rasterizeBand(0, 1);
+		return;
+	}
+	_mutex.lock();
+	_generation++;
+	_busyWorkers = (int) _workers.size();
+	_workAvailable.broadcast();
+	_mutex.unlock();
+
+	rasterizeBand(0, (int) _workers.size() + 1);
+
+	_mutex.lock();
+	while (_busyWorkers > 0)
+		_workDone.wait(_mutex);
+	_mutex.unlock();
+}
+
+void SkeletonRasterizer::draw(Skeleton &skeleton, RasterImage &image) {
+	clear();
+	add(skeleton);
+	rasterize(image);
+}
+
+void SkeletonRasterizer::runWorker(void *argument) {
+	Worker *worker = (Worker *) argument;
+	SkeletonRasterizer *rasterizer = worker->rasterizer;
+	int generation = 0;
+	for (;;) {
+		rasterizer->_mutex.lock();
+		while (rasterizer->_generation == generation && !rasterizer->_shutdown)
+			rasterizer->_workAvailable.wait(rasterizer->_mutex);
+		if (rasterizer->_shutdown) {
+			rasterizer->_mutex.unlock();
+			return;
+		}
+		generation = rasterizer->_generation;
+		rasterizer->_mutex.unlock();
+
+		rasterizer->rasterizeBand(worker->band, (int) rasterizer->_workers.size() + 1);
+
+		rasterizer->_mutex.lock();
+		if (--rasterizer->_busyWorkers == 0) rasterizer->_workDone.signal();
+		rasterizer->_mutex.unlock();
+	}
+}
+
+void SkeletonRasterizer::rasterizeBand(int band, int bandCount) {
+	RasterImage &image = *_image;
+	int minRow = image.getHeight() * band / bandCount, maxRow = image.getHeight() * (band + 1) / bandCount;
+	if (minRow == maxRow) return;
+
+	const float scale = 1 / 255.0f;
+	bool premultipliedAlpha = _builder.getUsePremultipliedAlpha();
+	const float *positions = _pixelPositions.buffer(), *uvs = _builder.getUVs().buffer();
+	const unsigned int *colors = _builder.getColors().buffer();
+	const unsigned short *indices = _builder.getIndices().buffer();
+	Vector<DrawCommand> &commands = _builder.getCommands();
+	RasterVertex triangle[3];
+	for (size_t i = 0, n = commands.size(); i < n; i++) {
+		DrawCommand &command = commands[i];
+		if (!command.texture) continue;
+		for (size_t ii = command.firstIndex, end = command.firstIndex + command.indexCount; ii < end; ii += 3) {
+			for (int v = 0; v < 3; v++) {
+				size_t index = command.firstVertex + indices[ii + v];
+				unsigned int color = colors[index];
+				RasterVertex &vertex = triangle[v];
+				vertex.x = positions[index << 1];
+				vertex.y = positions[(index << 1) + 1];
+				vertex.u = uvs[index << 1];
+				vertex.v = uvs[(index << 1) + 1];
+				vertex.r = (color & 0xff) * scale;
+				vertex.g = ((color >> 8) & 0xff) * scale;
+				vertex.b = ((color >> 16) & 0xff) * scale;
+				vertex.a = (color >> 24) * scale;
+			}
+			drawTriangle(image, minRow, maxRow, triangle, triangle + 1, triangle + 2, *(RasterTexture *) command.texture,
+				command.blendMode, premultipliedAlpha);
+		}
+	}
+}
+
+} /* namespace spine */
@@ -0,0 +1,170 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifndef SPINE_RASTER_H_
+#define SPINE_RASTER_H_
+
+#include <spine/spine.h>
+
+namespace spine {
+
+/// An image with 8 bit red, green, blue and alpha channels per pixel, rows from top to bottom.
+class RasterImage : public SpineObject {
+public:
+	RasterImage(int width, int height);
+
+	virtual ~RasterImage();
+
+	int getWidth() { return _width; }
+
+	int getHeight() { return _height; }
+
+	/// 4 bytes per pixel: red, green, blue, alpha.
+	unsigned char *getPixels() { return _pixels; }
+
+	void clear(const Color &color);
+
+	/// Writes the image as an uncompressed 32 bit TGA file.
+	/// @return false if the file could not be written.
+	bool writeTga(const char *path);
+
+protected:
+	int _width, _height;
+	unsigned char *_pixels;
+};
+
+/// An atlas page image, sampled with the page's filter and wrap modes.
+class RasterTexture : public RasterImage {
+public:
+	RasterTexture(int width, int height, bool linear, bool repeat) : RasterImage(width, height), _linear(linear),
+		_repeat(repeat) {}
+
+	bool isLinear() { return _linear; }
+
+	bool isRepeat() { return _repeat; }
+
+private:
+	bool _linear, _repeat;
+};
+
+/// Decodes an image file into 4 bytes per pixel: red, green, blue, alpha, rows from top to bottom.
+/// @return false if the file could not be decoded.
+typedef bool (*RasterImageDecoder)(const String &path, int &outWidth, int &outHeight, Vector<unsigned char> &outPixels);
+
+/// Loads atlas pages as RasterTextures. Without a decoder, or if decoding fails, each page is a single white pixel, so
+/// skeletons render as their tinted coverage. That is enough to compare renderings and benchmark without image files.
+class RasterTextureLoader : public TextureLoader {
+public:
+	explicit RasterTextureLoader(RasterImageDecoder decoder = NULL) : _decoder(decoder) {}
+
+	virtual void load(AtlasPage &page, const String &path);
+
+	virtual void unload(void *texture);
+
+private:
+	RasterImageDecoder _decoder;
+};
+
+/// Renders skeletons into a RasterImage without a GPU or a window, e.g. for thumbnails on a server and to benchmark the
+/// whole pipeline from world vertices to pixels.
+///
+/// add() builds the draw commands with a RenderCommandBuilder, like a GPU renderer would. rasterize() draws the commands
+/// in order. The image is split into horizontal bands, each rasterized by one thread, so the output does not depend on the
+/// number of threads. With SSE2 or NEON the coverage of 4 pixels is tested at once.
+class SkeletonRasterizer : public SpineObject {
+public:
+	/// @param workerCount Threads created in addition to the calling thread, which rasterizes too. -1 creates one thread
+	/// for each processor beyond the first, 0 rasterizes on the calling thread.
+	explicit SkeletonRasterizer(int workerCount = 0);
+
+	~SkeletonRasterizer();
+
+	/// If true, textures and vertex colors are premultiplied by alpha. Default is false.
+	void setUsePremultipliedAlpha(bool usePremultipliedAlpha) { _builder.setUsePremultipliedAlpha(usePremultipliedAlpha); }
+
+	bool getUsePremultipliedAlpha() { return _builder.getUsePremultipliedAlpha(); }
+
+	void setVertexEffect(VertexEffect *vertexEffect) { _builder.setVertexEffect(vertexEffect); }
+
+	VertexEffect *getVertexEffect() { return _builder.getVertexEffect(); }
+
+	/// Sets how world positions map to pixels: pixelX = x * scaleX + translateX, pixelY = y * scaleY + translateY.
+	void setTransform(float scaleX, float scaleY, float translateX, float translateY);
+
+	/// Sets the transform so the world rectangle fits into the image, centered, leaving margin pixels on each side. y is
+	/// flipped unless Bone::isYDown().
+	void fit(float x, float y, float width, float height, int imageWidth, int imageHeight, float margin);
+
+	/// Removes all draw commands and vertices.
+	void clear();
+
+	/// Appends the attachments of the skeleton to the draw commands.
+	void add(Skeleton &skeleton);
+
+	/// Draws all commands into the image, blending with its pixels. Commands without a texture are skipped.
+	void rasterize(RasterImage &image);
+
+	/// Clears, adds the skeleton and rasterizes it.
+	void draw(Skeleton &skeleton, RasterImage &image);
+
+	/// The draw commands and vertices added since the last clear(). Textures are RasterTextures.
+	RenderCommandBuilder &getBuilder() { return _builder; }
+
+	/// The number of threads created in addition to the calling thread.
+	int getWorkerCount() { return (int) _workers.size(); }
+
+private:
+	struct Worker : public SpineObject {
+		SkeletonRasterizer *rasterizer;
+		int band;
+		Thread thread;
+	};
+
+	float _scaleX, _scaleY, _translateX, _translateY;
+	RenderCommandBuilder _builder;
+	Vector<float> _pixelPositions;
+
+	Vector<Worker *> _workers;
+	Mutex _mutex;
+	Condition _workAvailable;
+	Condition _workDone;
+	int _generation;
+	int _busyWorkers;
+	bool _shutdown;
+	RasterImage *_image;
+
+	static void runWorker(void *worker);
+
+	/// Rasterizes all batches into the rows of one band of the image.
+	void rasterizeBand(int band, int bandCount);
+};
+
+} /* namespace spine */
+#endif /* SPINE_RASTER_H_ */
@@ -1,6 +1,8 @@
 #include <stdio.h>
+#include <math.h>
 #include <spine/spine.h>
 #include <spine/Debug.h>
+#include <spine/spine-raster.h>
 
 #pragma warning ( disable : 4710 )
 
@@ -93,6 +95,1974 @@ void testLoading() {
 	}
 }
 
+void testHashMap() {
+	HashMap<int, int> map;
+	Vector<int> values;
+	values.setSize(1000, -1);
+
+	// Interleave inserts, overwrites and removals and check the map against a plain array.
+	unsigned int seed = 1;
+	for (int i = 0; i < 20000; i++) {
+		seed = seed * 1103515245 + 12345;
+		int key = (int) ((seed >> 8) % 1000);
+		if ((seed >> 4) % 3 == 0) {
+			assert(map.remove(key) == (values[key] != -1));
+			values[key] = -1;
+		} else {
+			map.put(key, i);
+			values[key] = i;
+		}
+	}
+
+	size_t size = 0;
+	for (int key = 0; key < 1000; key++) {
+		assert(map.containsKey(key) == (values[key] != -1));
+		if (values[key] != -1) {
+			assert(map[key] == values[key]);
+			size++;
+		}
+	}
+	assert(map.size() == size);
+
+	size_t iterated = 0;
+	HashMap<int, int>::Entries entries = map.getEntries();
+	while (entries.hasNext()) {
+		HashMap<int, int>::Pair pair = entries.next();
+		SP_UNUSED(pair);
+		assert(values[pair.key] == pair.value);
+		iterated++;
+	}
+	assert(iterated == size);
+
+	map.clear();
+	assert(map.size() == 0);
+	assert(!map.containsKey(0));
+}
+
+void testTrig() {
+	// Every implementation against double precision, for angles of a few turns in both directions.
+	for (int i = -720000; i <= 720000; i += 7) {
+		float degrees = i * 0.001f, radians = degrees * MathUtil::Deg_Rad;
+		double sinDegrees = ::sin(degrees * 3.14159265358979323846 / 180), cosDegrees = ::cos(degrees * 3.14159265358979323846 / 180);
+		double sinRadians = ::sin(radians), cosRadians = ::cos(radians);
+		SP_UNUSED(sinDegrees);
+		SP_UNUSED(cosDegrees);
+		SP_UNUSED(sinRadians);
+		SP_UNUSED(cosRadians);
+		float s, c;
+		MathUtil::sinCosDegPolynomial(degrees, s, c);
+		assert(fabs(s - sinDegrees) < 2e-7 && fabs(c - cosDegrees) < 2e-7);
+		MathUtil::sinCosPolynomial(radians, s, c);
+		assert(fabs(s - sinRadians) < 2e-7 && fabs(c - cosRadians) < 2e-7);
+		MathUtil::sinCosDegTable(degrees, s, c);
+		assert(fabs(s - sinDegrees) < 1e-6 && fabs(c - cosDegrees) < 1e-6);
+		MathUtil::sinCosTable(radians, s, c);
+		assert(fabs(s - sinRadians) < 1e-6 && fabs(c - cosRadians) < 1e-6);
+
+		// The joint evaluation matches the separate functions exactly.
+		MathUtil::sinCosDeg(degrees, s, c);
+		assert(s == MathUtil::sinDeg(degrees) && c == MathUtil::cosDeg(degrees));
+		MathUtil::sinCos(radians, s, c);
+		assert(s == MathUtil::sin(radians) && c == MathUtil::cos(radians));
+	}
+}
+
+bool nearlyEqual(float a, float b) {
+	return MathUtil::abs(a - b) <= 0.0001f * MathUtil::max(1.0f, MathUtil::max(MathUtil::abs(a), MathUtil::abs(b)));
+}
+
+void testPoseBuffer() {
+	const char *skeletons[][2] = {
+			{"testdata/spineboy/spineboy-pro.skel", "testdata/spineboy/spineboy.atlas"},
+			{"testdata/raptor/raptor-pro.skel", "testdata/raptor/raptor.atlas"},
+			{"testdata/tank/tank-pro.skel", "testdata/tank/tank.atlas"},
+			{"testdata/stretchyman/stretchyman-pro.skel", "testdata/stretchyman/stretchyman.atlas"}
+	};
+
+	for (size_t i = 0; i < sizeof(skeletons) / sizeof(skeletons[0]); i++) {
+		Atlas *atlas = NULL;
+		SkeletonData *skeletonData = NULL;
+		AnimationStateData *stateData = NULL;
+		Skeleton *skeleton = NULL;
+		AnimationState *state = NULL;
+		loadBinary(skeletons[i][0], skeletons[i][1], atlas, skeletonData, stateData, skeleton, state);
+
+		Skeleton *batched = new(__FILE__, __LINE__) Skeleton(skeletonData);
+		batched->setPoseBufferEnabled(true);
+		assert(batched->getPoseBuffer()->size() > 0);
+
+		Vector<Animation *> &animations = skeletonData->getAnimations();
+		for (size_t ii = 0; ii < animations.size(); ii++) {
+			Animation *animation = animations[ii];
+			for (float time = 0; time < animation->getDuration(); time += 0.1f) {
+				Skeleton *targets[] = {skeleton, batched};
+				for (int t = 0; t < 2; t++) {
+					targets[t]->setToSetupPose();
+					targets[t]->setPosition(10, -20);
+					targets[t]->setScaleX(-1.5f);
+					animation->apply(*targets[t], time, time, true, NULL, 1, MixBlend_Setup, MixDirection_In);
+					targets[t]->updateWorldTransform();
+				}
+
+				for (size_t b = 0; b < skeleton->getBones().size(); b++) {
+					Bone *expected = skeleton->getBones()[b];
+					SP_UNUSED(expected);
+					Bone *actual = batched->getBones()[b];
+					SP_UNUSED(actual);
+					assert(nearlyEqual(expected->getA(), actual->getA()));
+					assert(nearlyEqual(expected->getB(), actual->getB()));
+					assert(nearlyEqual(expected->getC(), actual->getC()));
+					assert(nearlyEqual(expected->getD(), actual->getD()));
+					assert(nearlyEqual(expected->getWorldX(), actual->getWorldX()));
+					assert(nearlyEqual(expected->getWorldY(), actual->getWorldY()));
+					assert(nearlyEqual(expected->getAppliedRotation(), actual->getAppliedRotation()));
+				}
+			}
+		}
+
+		delete batched;
+		dispose(atlas, skeletonData, stateData, skeleton, state);
+	}
+}
+
+class RecordingListener : public AnimationStateListenerObject, public SpineObject {
+public:
+	Vector<int> events;
+
+	void callback(AnimationState *state, EventType type, TrackEntry *entry, Event *event) {
+		(void) state;
+		(void) event;
+		events.add((int) type * 1000 + entry->getTrackIndex());
+	}
+};
+
+void testBatchUpdater() {
+	Atlas *atlas = NULL;
+	SkeletonData *skeletonData = NULL;
+	AnimationStateData *stateData = NULL;
+	Skeleton *skeleton = NULL;
+	AnimationState *state = NULL;
+	loadBinary("testdata/spineboy/spineboy-pro.skel", "testdata/spineboy/spineboy.atlas", atlas, skeletonData, stateData, skeleton, state);
+
+	// The same pairs updated one after another on this thread and by the batch updater must end up identical.
+	const int numPairs = 32;
+	Vector<Animation *> &animations = skeletonData->getAnimations();
+	Vector<Skeleton *> skeletons[2];
+	Vector<AnimationState *> states[2];
+	Vector<RecordingListener *> listeners[2];
+	for (int i = 0; i < 2; i++) {
+		for (int ii = 0; ii < numPairs; ii++) {
+			Skeleton *pairSkeleton = new(__FILE__, __LINE__) Skeleton(skeletonData);
+			AnimationState *pairState = new(__FILE__, __LINE__) AnimationState(stateData);
+			RecordingListener *listener = new(__FILE__, __LINE__) RecordingListener();
+			pairState->setListener(listener);
+			pairState->setAnimation(0, animations[ii % animations.size()], ii % 3 != 0);
+			pairState->addAnimation(0, animations[(ii + 1) % animations.size()], true, 0.5f);
+			pairState->setAnimation(1, animations[(ii + 2) % animations.size()], false)->setAlpha(0.5f);
+			skeletons[i].add(pairSkeleton);
+			states[i].add(pairState);
+			listeners[i].add(listener);
+		}
+	}
+
+	SkeletonBatchUpdater updater(4);
+	for (int i = 0; i < numPairs; i++)
+		updater.add(skeletons[1][i], states[1][i]);
+	assert(updater.size() == (size_t) numPairs);
+
+	for (int frame = 0; frame < 200; frame++) {
+		float delta = 1 / 60.0f;
+		for (int i = 0; i < numPairs; i++) {
+			skeletons[0][i]->update(delta);
+			states[0][i]->update(delta);
+			states[0][i]->apply(*skeletons[0][i]);
+			skeletons[0][i]->updateWorldTransform();
+		}
+		updater.update(delta);
+
+		for (int i = 0; i < numPairs; i++) {
+			Vector<Bone *> &expected = skeletons[0][i]->getBones(), &actual = skeletons[1][i]->getBones();
+			SP_UNUSED(actual);
+			for (size_t ii = 0; ii < expected.size(); ii++) {
+				assert(expected[ii]->getA() == actual[ii]->getA() && expected[ii]->getB() == actual[ii]->getB());
+				assert(expected[ii]->getC() == actual[ii]->getC() && expected[ii]->getD() == actual[ii]->getD());
+				assert(expected[ii]->getWorldX() == actual[ii]->getWorldX());
+				assert(expected[ii]->getWorldY() == actual[ii]->getWorldY());
+			}
+			// Callbacks have all been delivered once update() returns.
+			Vector<int> &expectedEvents = listeners[0][i]->events, &actualEvents = listeners[1][i]->events;
+			SP_UNUSED(actualEvents);
+			assert(expectedEvents.size() == actualEvents.size());
+			for (size_t ii = 0; ii < expectedEvents.size(); ii++)
+				assert(expectedEvents[ii] == actualEvents[ii]);
+		}
+	}
+	assert(listeners[1][0]->events.size() > 0);
+
+	assert(updater.remove(skeletons[1][0]));
+	assert(!updater.remove(skeletons[1][0]));
+	assert(updater.size() == (size_t) numPairs - 1);
+
+	for (int i = 0; i < 2; i++) {
+		ContainerUtil::cleanUpVectorOfPointers(states[i]);
+		ContainerUtil::cleanUpVectorOfPointers(skeletons[i]);
+		ContainerUtil::cleanUpVectorOfPointers(listeners[i]);
+	}
+	dispose(atlas, skeletonData, stateData, skeleton, state);
+}
+
+/// The scalar VertexAttachment::computeWorldVertices the SIMD kernels must match.
+void referenceWorldVertices(VertexAttachment *attachment, Slot &slot, Vector<float> &worldVertices) {
+	Vector<float> &deform = slot.getDeform();
+	Vector<float> &vertices = deform.size() > 0 && attachment->getBones().size() == 0 ? deform : attachment->getVertices();
+	Vector<size_t> &bones = attachment->getBones();
+	worldVertices.setSize(attachment->getWorldVerticesLength(), 0);
+	if (bones.size() == 0) {
+		Bone &bone = slot.getBone();
+		for (size_t i = 0; i < worldVertices.size(); i += 2) {
+			worldVertices[i] = vertices[i] * bone.getA() + vertices[i + 1] * bone.getB() + bone.getWorldX();
+			worldVertices[i + 1] = vertices[i] * bone.getC() + vertices[i + 1] * bone.getD() + bone.getWorldY();
+		}
+		return;
+	}
+	Vector<Bone *> &skeletonBones = slot.getBone().getSkeleton().getBones();
+	for (size_t w = 0, v = 0, b = 0, f = 0; w < worldVertices.size(); w += 2) {
+		float wx = 0, wy = 0;
+		for (size_t n = v + 1 + bones[v], ii = v + 1; ii < n; ii++, b += 3, f += 2) {
+			Bone *bone = skeletonBones[bones[ii]];
+			float vx = vertices[b], vy = vertices[b + 1], weight = vertices[b + 2];
+			if (deform.size() > 0) {
+				vx += deform[f];
+				vy += deform[f + 1];
+			}
+			wx += (vx * bone->getA() + vy * bone->getB() + bone->getWorldX()) * weight;
+			wy += (vx * bone->getC() + vy * bone->getD() + bone->getWorldY()) * weight;
+		}
+		v += 1 + bones[v];
+		worldVertices[w] = wx;
+		worldVertices[w + 1] = wy;
+	}
+}
+
+void testComputeWorldVertices() {
+	const char *skeletons[][2] = {
+			{"testdata/spineboy/spineboy-pro.skel", "testdata/spineboy/spineboy.atlas"},
+			{"testdata/raptor/raptor-pro.skel", "testdata/raptor/raptor.atlas"},
+			{"testdata/goblins/goblins-pro.skel", "testdata/goblins/goblins.atlas"},
+			{"testdata/stretchyman/stretchyman-pro.skel", "testdata/stretchyman/stretchyman.atlas"}
+	};
+
+	Vector<float> expected, actual;
+	for (size_t i = 0; i < sizeof(skeletons) / sizeof(skeletons[0]); i++) {
+		Atlas *atlas = NULL;
+		SkeletonData *skeletonData = NULL;
+		AnimationStateData *stateData = NULL;
+		Skeleton *skeleton = NULL;
+		AnimationState *state = NULL;
+		loadBinary(skeletons[i][0], skeletons[i][1], atlas, skeletonData, stateData, skeleton, state);
+		if (skeletonData->getSkins().size() > 1) skeleton->setSkin(skeletonData->getSkins()[1]);
+
+		Vector<Animation *> &animations = skeletonData->getAnimations();
+		for (size_t ii = 0; ii < animations.size(); ii++) {
+			skeleton->setToSetupPose();
+			animations[ii]->apply(*skeleton, 0.3f, 0.3f, true, NULL, 1, MixBlend_Setup, MixDirection_In);
+			skeleton->updateWorldTransform();
+
+			for (size_t s = 0; s < skeleton->getSlots().size(); s++) {
+				Slot &slot = *skeleton->getSlots()[s];
+				Attachment *attachment = slot.getAttachment();
+				if (attachment == NULL || !attachment->getRTTI().instanceOf(VertexAttachment::rtti)) continue;
+				VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(attachment);
+				size_t length = vertexAttachment->getWorldVerticesLength();
+				referenceWorldVertices(vertexAttachment, slot, expected);
+
+				// Contiguous output and a strided output at an offset, as used by vertex formats with interleaved attributes.
+				size_t strides[] = {2, 5};
+				for (size_t st = 0; st < 2; st++) {
+					size_t stride = strides[st], offset = 3;
+					actual.setSize(offset + (length >> 1) * stride, 0);
+					vertexAttachment->computeWorldVertices(slot, 0, length, actual, offset, stride);
+					for (size_t v = 0; v < length; v += 2) {
+						assert(actual[offset + (v >> 1) * stride] == expected[v]);
+						assert(actual[offset + (v >> 1) * stride + 1] == expected[v + 1]);
+					}
+				}
+			}
+		}
+
+		dispose(atlas, skeletonData, stateData, skeleton, state);
+	}
+}
+
+static SkeletonData *loadArenaTestData(const String &file, Atlas *atlas, bool binary, bool useArena) {
+	if (binary) {
+		SkeletonBinary loader(atlas);
+		loader.setUseArena(useArena);
+		return loader.readSkeletonDataFile(file);
+	}
+	SkeletonJson loader(atlas);
+	loader.setUseArena(useArena);
+	return loader.readSkeletonDataFile(file);
+}
+
+void testArena() {
+	const char *skeletons[][3] = {
+		{"testdata/goblins/goblins-pro.skel", "testdata/goblins/goblins-pro.json", "testdata/goblins/goblins.atlas"},
+		{"testdata/raptor/raptor-pro.skel", "testdata/raptor/raptor-pro.json", "testdata/raptor/raptor.atlas"}
+	};
+
+	for (int i = 0; i < 2; i++) {
+		Atlas *atlas = new(__FILE__, __LINE__) Atlas(skeletons[i][2], NULL);
+		for (int binary = 0; binary < 2; binary++) {
+			const char *file = binary ? skeletons[i][0] : skeletons[i][1];
+			SkeletonData *heapData = loadArenaTestData(file, atlas, binary != 0, false);
+			SkeletonData *arenaData = loadArenaTestData(file, atlas, binary != 0, true);
+			assert(heapData->getArena() == NULL);
+			assert(arenaData->getArena() != NULL);
+			assert(arenaData->getArena()->getUsedBytes() > 0);
+			assert(arenaData->getArena()->getUsedBytes() <= arenaData->getArena()->getReservedBytes());
+
+			// Posing a skeleton from either data must give the same result.
+			Skeleton *expected = new(__FILE__, __LINE__) Skeleton(heapData);
+			Skeleton *actual = new(__FILE__, __LINE__) Skeleton(arenaData);
+			Vector<Animation *> &animations = heapData->getAnimations();
+			assert(animations.size() == arenaData->getAnimations().size());
+			for (size_t ii = 0; ii < animations.size(); ii++) {
+				expected->setSkin(heapData->getSkins()[heapData->getSkins().size() - 1]);
+				actual->setSkin(arenaData->getSkins()[arenaData->getSkins().size() - 1]);
+				expected->setToSetupPose();
+				actual->setToSetupPose();
+				animations[ii]->apply(*expected, 0.5f, 0.5f, false, NULL, 1, MixBlend_Setup, MixDirection_In);
+				arenaData->getAnimations()[ii]->apply(*actual, 0.5f, 0.5f, false, NULL, 1, MixBlend_Setup, MixDirection_In);
+				expected->updateWorldTransform();
+				actual->updateWorldTransform();
+				for (size_t b = 0; b < expected->getBones().size(); b++) {
+					assert(expected->getBones()[b]->getWorldX() == actual->getBones()[b]->getWorldX());
+					assert(expected->getBones()[b]->getWorldY() == actual->getBones()[b]->getWorldY());
+				}
+				for (size_t s = 0; s < expected->getSlots().size(); s++) {
+					Attachment *expectedAttachment = expected->getSlots()[s]->getAttachment();
+					Attachment *actualAttachment = actual->getSlots()[s]->getAttachment();
+					SP_UNUSED(actualAttachment);
+					assert((expectedAttachment == NULL) == (actualAttachment == NULL));
+					if (expectedAttachment) assert(expectedAttachment->getName() == actualAttachment->getName());
+				}
+			}
+
+			delete expected;
+			delete actual;
+			delete heapData;
+			delete arenaData;
+		}
+		delete atlas;
+	}
+
+	// Failing to load must release the arena.
+	Atlas *atlas = new(__FILE__, __LINE__) Atlas(skeletons[0][2], NULL);
+	SkeletonJson json(atlas);
+	json.setUseArena(true);
+	SkeletonData *skeletonData = json.readSkeletonData("{\"bones\":[{\"name\":\"root\"}],\"slots\":[{\"name\":\"a\",\"bone\":\"b\"}]}");
+	SP_UNUSED(skeletonData);
+	assert(skeletonData == NULL);
+	assert(json.getError() == "Slot bone not found: b");
+	assert(Arena::getCurrent() == NULL);
+	delete atlas;
+}
+
+static void assertSameData(SkeletonData *expected, SkeletonData *actual) {
+	assert(expected->getHash() == actual->getHash());
+	assert(expected->getBones().size() == actual->getBones().size());
+	for (size_t i = 0; i < expected->getBones().size(); i++)
+		assert(expected->getBones()[i]->getName() == actual->getBones()[i]->getName());
+	assert(expected->getSlots().size() == actual->getSlots().size());
+	for (size_t i = 0; i < expected->getSlots().size(); i++) {
+		assert(expected->getSlots()[i]->getName() == actual->getSlots()[i]->getName());
+		assert(expected->getSlots()[i]->getAttachmentName() == actual->getSlots()[i]->getAttachmentName());
+	}
+	assert(expected->getEvents().size() == actual->getEvents().size());
+	for (size_t i = 0; i < expected->getEvents().size(); i++) {
+		assert(expected->getEvents()[i]->getName() == actual->getEvents()[i]->getName());
+		assert(expected->getEvents()[i]->getStringValue() == actual->getEvents()[i]->getStringValue());
+	}
+	assert(expected->getAnimations().size() == actual->getAnimations().size());
+
+	Skeleton expectedSkeleton(expected);
+	Skeleton actualSkeleton(actual);
+	for (size_t i = 0; i < expected->getAnimations().size(); i++) {
+		Animation *animation = expected->getAnimations()[i];
+		assert(animation->getName() == actual->getAnimations()[i]->getName());
+		for (float time = 0; time < animation->getDuration(); time += 0.2f) {
+			expectedSkeleton.setToSetupPose();
+			actualSkeleton.setToSetupPose();
+			animation->apply(expectedSkeleton, time, time, false, NULL, 1, MixBlend_Setup, MixDirection_In);
+			actual->getAnimations()[i]->apply(actualSkeleton, time, time, false, NULL, 1, MixBlend_Setup, MixDirection_In);
+			expectedSkeleton.updateWorldTransform();
+			actualSkeleton.updateWorldTransform();
+			for (size_t b = 0; b < expectedSkeleton.getBones().size(); b++) {
+				assert(expectedSkeleton.getBones()[b]->getWorldX() == actualSkeleton.getBones()[b]->getWorldX());
+				assert(expectedSkeleton.getBones()[b]->getWorldY() == actualSkeleton.getBones()[b]->getWorldY());
+			}
+			for (size_t s = 0; s < expectedSkeleton.getSlots().size(); s++) {
+				Slot *expectedSlot = expectedSkeleton.getSlots()[s];
+				Slot *actualSlot = actualSkeleton.getSlots()[s];
+				SP_UNUSED(actualSlot);
+				assert(expectedSlot->getDeform().size() == actualSlot->getDeform().size());
+				for (size_t v = 0; v < expectedSlot->getDeform().size(); v++)
+					assert(expectedSlot->getDeform()[v] == actualSlot->getDeform()[v]);
+			}
+		}
+	}
+}
+
+void testLoadInPlace() {
+	const char *skeletons[][2] = {
+		{"testdata/spineboy/spineboy-pro.skel", "testdata/spineboy/spineboy.atlas"},
+		{"testdata/goblins/goblins-pro.skel", "testdata/goblins/goblins.atlas"},
+		{"testdata/tank/tank-pro.skel", "testdata/tank/tank.atlas"}
+	};
+
+	for (int i = 0; i < 3; i++) {
+		Atlas *atlas = new(__FILE__, __LINE__) Atlas(skeletons[i][1], NULL);
+		SkeletonBinary binary(atlas);
+		binary.setScale(0.5f);
+		SkeletonData *expected = binary.readSkeletonDataFile(skeletons[i][0]);
+
+		// A buffer handed over to the skeleton data.
+		int length;
+		char *file = SpineExtension::readFile(skeletons[i][0], &length);
+		SkeletonData *owning = binary.readSkeletonDataInPlace((unsigned char *) file, length, true);
+		assert(owning->getArena() != NULL);
+		assertSameData(expected, owning);
+		delete owning;
+
+		// A buffer that outlives the skeleton data.
+		file = SpineExtension::readFile(skeletons[i][0], &length);
+		SkeletonData *borrowing = binary.readSkeletonDataInPlace((unsigned char *) file, length);
+		assert(borrowing->getBones()[0]->getName().buffer() > file);
+		assert(borrowing->getBones()[0]->getName().buffer() < file + length);
+		assertSameData(expected, borrowing);
+		delete borrowing;
+		SpineExtension::free(file, __FILE__, __LINE__);
+
+		delete expected;
+		delete atlas;
+	}
+}
+
+static void assertSameLocalPose(Skeleton &expected, Skeleton &actual) {
+	Vector<Bone *> &expectedBones = expected.getBones(), &actualBones = actual.getBones();
+	for (size_t i = 0; i < expectedBones.size(); i++) {
+		Bone *a = expectedBones[i], *b = actualBones[i];
+		SP_UNUSED(a);
+		SP_UNUSED(b);
+		assert(a->getX() == b->getX() && a->getY() == b->getY() && a->getRotation() == b->getRotation());
+		assert(a->getScaleX() == b->getScaleX() && a->getScaleY() == b->getScaleY());
+		assert(a->getShearX() == b->getShearX() && a->getShearY() == b->getShearY());
+	}
+}
+
+void testBakedAnimation() {
+	Atlas *atlas = NULL;
+	SkeletonData *skeletonData = NULL, *bakedData = NULL;
+	AnimationStateData *stateData = NULL, *bakedStateData = NULL;
+	Skeleton *skeleton = NULL, *bakedSkeleton = NULL;
+	AnimationState *state = NULL, *bakedState = NULL;
+	Atlas *bakedAtlas = NULL;
+	loadBinary("testdata/spineboy/spineboy-pro.skel", "testdata/spineboy/spineboy.atlas", atlas, skeletonData, stateData, skeleton, state);
+	loadBinary("testdata/spineboy/spineboy-pro.skel", "testdata/spineboy/spineboy.atlas", bakedAtlas, bakedData, bakedStateData,
+		bakedSkeleton, bakedState);
+
+	Vector<Animation *> &animations = skeletonData->getAnimations(), &bakedAnimations = bakedData->getAnimations();
+	for (size_t i = 0; i < bakedAnimations.size(); i++) {
+		bakedAnimations[i]->bake();
+		assert(bakedAnimations[i]->getBaked()->getBakedTimelineCount() > 0);
+	}
+
+	// Applying baked animations must match applying their timelines, for every blend and direction, played forward and scrubbed
+	// backward.
+	Vector<int> cursors;
+	const MixBlend blends[] = {MixBlend_Setup, MixBlend_First, MixBlend_Replace, MixBlend_Add};
+	for (size_t i = 0; i < animations.size(); i++) {
+		Animation *animation = animations[i];
+		BakedAnimation *baked = bakedAnimations[i]->getBaked();
+		cursors.clear();
+		for (int blend = 0; blend < 4; blend++) {
+			for (int direction = MixDirection_In; direction <= MixDirection_Out; direction++) {
+				for (int frame = -5; frame < 200; frame++) {
+					float time = frame < 150 ? frame / 60.0f : (200 - frame) / 30.0f, alpha = frame % 3 ? 0.5f : 1;
+					animation->apply(*skeleton, 0, time, true, NULL, alpha, blends[blend], (MixDirection) direction);
+					baked->apply(*bakedSkeleton, 0, time, true, NULL, alpha, blends[blend], (MixDirection) direction, cursors);
+					assertSameLocalPose(*skeleton, *bakedSkeleton);
+				}
+			}
+		}
+	}
+
+	// Mixing and layering through AnimationState, with a jump back in time.
+	AnimationState *states[] = {state, bakedState};
+	Skeleton *skeletons[] = {skeleton, bakedSkeleton};
+	Vector<Animation *> *stateAnimations[] = {&animations, &bakedAnimations};
+	for (int i = 0; i < 2; i++) {
+		skeletons[i]->setToSetupPose();
+		states[i]->setAnimation(0, stateAnimations[i]->buffer()[0], true);
+		states[i]->addAnimation(0, stateAnimations[i]->buffer()[1], true, 0.5f);
+		states[i]->addAnimation(0, stateAnimations[i]->buffer()[2], false, 1);
+		states[i]->setAnimation(1, stateAnimations[i]->buffer()[3], true)->setAlpha(0.5f);
+	}
+	for (int frame = 0; frame < 300; frame++) {
+		for (int i = 0; i < 2; i++) {
+			if (frame == 150) states[i]->getCurrent(0)->setTrackTime(0.1f);
+			states[i]->update(1 / 60.0f);
+			states[i]->apply(*skeletons[i]);
+		}
+		assertSameLocalPose(*skeleton, *bakedSkeleton);
+	}
+
+	dispose(bakedAtlas, bakedData, bakedStateData, bakedSkeleton, bakedState);
+	dispose(atlas, skeletonData, stateData, skeleton, state);
+}
+
+static void assertNearLocalPose(Skeleton &expected, Skeleton &actual, float tolerance) {
+	SP_UNUSED(tolerance);
+	Vector<Bone *> &expectedBones = expected.getBones(), &actualBones = actual.getBones();
+	for (size_t i = 0; i < expectedBones.size(); i++) {
+		Bone *a = expectedBones[i], *b = actualBones[i];
+		SP_UNUSED(a);
+		SP_UNUSED(b);
+		assert(MathUtil::abs(a->getX() - b->getX()) <= tolerance && MathUtil::abs(a->getY() - b->getY()) <= tolerance);
+		assert(MathUtil::abs(a->getRotation() - b->getRotation()) <= tolerance);
+		assert(MathUtil::abs(a->getScaleX() - b->getScaleX()) <= tolerance);
+		assert(MathUtil::abs(a->getScaleY() - b->getScaleY()) <= tolerance);
+		assert(MathUtil::abs(a->getShearX() - b->getShearX()) <= tolerance);
+		assert(MathUtil::abs(a->getShearY() - b->getShearY()) <= tolerance);
+	}
+}
+
+static void assertSameDeform(Skeleton &expected, Skeleton &actual) {
+	Vector<Slot *> &expectedSlots = expected.getSlots(), &actualSlots = actual.getSlots();
+	for (size_t i = 0; i < expectedSlots.size(); i++) {
+		Vector<float> &a = expectedSlots[i]->getDeform(), &b = actualSlots[i]->getDeform();
+		SP_UNUSED(a);
+		SP_UNUSED(b);
+		assert(a.size() == b.size());
+		for (size_t ii = 0; ii < a.size(); ii++)
+			assert(a[ii] == b[ii]);
+	}
+}
+
+void testAnimationCompression() {
+	Atlas *atlas = NULL, *compressedAtlas = NULL;
+	SkeletonData *skeletonData = NULL, *compressedData = NULL;
+	AnimationStateData *stateData = NULL, *compressedStateData = NULL;
+	Skeleton *skeleton = NULL, *compressedSkeleton = NULL;
+	AnimationState *state = NULL, *compressedState = NULL;
+	loadBinary("testdata/spineboy/spineboy-pro.skel", "testdata/spineboy/spineboy.atlas", atlas, skeletonData, stateData, skeleton, state);
+	loadBinary("testdata/spineboy/spineboy-pro.skel", "testdata/spineboy/spineboy.atlas", compressedAtlas, compressedData,
+		compressedStateData, compressedSkeleton, compressedState);
+
+	Vector<Animation *> &animations = skeletonData->getAnimations(), &compressedAnimations = compressedData->getAnimations();
+	float error = 0;
+	for (size_t i = 0; i < compressedAnimations.size(); i++) {
+		Animation *animation = compressedAnimations[i];
+		animation->compress();
+		animation->compress();
+		assert(animation->isCompressed());
+		error = MathUtil::max(error, animation->getCompressionError());
+		if (i % 2) animation->bake();
+
+		Vector<Timeline *> &timelines = animation->getTimelines(), &original = animations[i]->getTimelines();
+		for (size_t ii = 0; ii < timelines.size(); ii++) {
+			if (!timelines[ii]->getRTTI().instanceOf(CurveTimeline::rtti)) continue;
+			CurveTimeline *timeline = static_cast<CurveTimeline *>(timelines[ii]);
+			CurveTimeline *originalTimeline = static_cast<CurveTimeline *>(original[ii]);
+			SP_UNUSED(originalTimeline);
+			assert(timeline->getFrameCount() == originalTimeline->getFrameCount());
+			for (size_t frame = 0; frame < timeline->getFrameCount() - 1; frame++) {
+				assert(timeline->getCurveType(frame) == originalTimeline->getCurveType(frame));
+				assert(timeline->getCurvePercent(frame, 0.3f) == originalTimeline->getCurvePercent(frame, 0.3f));
+			}
+		}
+	}
+	assert(error > 0 && error < 0.01f);
+
+	// Bone values stay within the quantization error, deform is exact.
+	const MixBlend blends[] = {MixBlend_Setup, MixBlend_First, MixBlend_Replace, MixBlend_Add};
+	for (size_t i = 0; i < animations.size(); i++) {
+		for (int blend = 0; blend < 4; blend++) {
+			skeleton->setToSetupPose();
+			compressedSkeleton->setToSetupPose();
+			for (int frame = -5; frame < 200; frame++) {
+				float time = frame / 60.0f, alpha = frame % 3 ? 0.5f : 1;
+				animations[i]->apply(*skeleton, 0, time, true, NULL, alpha, blends[blend], MixDirection_In);
+				compressedAnimations[i]->apply(*compressedSkeleton, 0, time, true, NULL, alpha, blends[blend], MixDirection_In);
+				assertNearLocalPose(*skeleton, *compressedSkeleton, error * 2);
+				assertSameDeform(*skeleton, *compressedSkeleton);
+				skeleton->setToSetupPose();
+				compressedSkeleton->setToSetupPose();
+			}
+		}
+	}
+
+	// Mixing through AnimationState, which applies rotations itself.
+	AnimationState *states[] = {state, compressedState};
+	Skeleton *skeletons[] = {skeleton, compressedSkeleton};
+	Vector<Animation *> *stateAnimations[] = {&animations, &compressedAnimations};
+	for (int i = 0; i < 2; i++) {
+		skeletons[i]->setToSetupPose();
+		states[i]->setAnimation(0, stateAnimations[i]->buffer()[0], true);
+		states[i]->addAnimation(0, stateAnimations[i]->buffer()[1], true, 0.5f);
+		states[i]->addAnimation(0, stateAnimations[i]->buffer()[2], false, 1);
+		states[i]->setAnimation(1, stateAnimations[i]->buffer()[3], true)->setAlpha(0.5f);
+	}
+	for (int frame = 0; frame < 300; frame++) {
+		for (int i = 0; i < 2; i++) {
+			states[i]->update(1 / 60.0f);
+			states[i]->apply(*skeletons[i]);
+		}
+		assertNearLocalPose(*skeleton, *compressedSkeleton, error * 4);
+	}
+
+	// Data loaded into an arena keeps its original keyframes in the arena.
+	for (int binary = 0; binary < 2; binary++) {
+		const char *file = binary ? "testdata/spineboy/spineboy-pro.skel" : "testdata/spineboy/spineboy-pro.json";
+		SkeletonData *heapData = loadArenaTestData(file, atlas, binary != 0, false);
+		SkeletonData *arenaData = loadArenaTestData(file, atlas, binary != 0, true);
+		assert(arenaData->getArena() != NULL);
+		Skeleton *heapSkeleton = new(__FILE__, __LINE__) Skeleton(heapData);
+		Skeleton *arenaSkeleton = new(__FILE__, __LINE__) Skeleton(arenaData);
+		Vector<Animation *> &heapAnimations = heapData->getAnimations(), &arenaAnimations = arenaData->getAnimations();
+		for (size_t i = 0; i < arenaAnimations.size(); i++) {
+			arenaAnimations[i]->compress();
+			assert(arenaAnimations[i]->isCompressed());
+			float arenaError = arenaAnimations[i]->getCompressionError();
+			for (int frame = 0; frame < 60; frame += 7) {
+				heapSkeleton->setToSetupPose();
+				arenaSkeleton->setToSetupPose();
+				heapAnimations[i]->apply(*heapSkeleton, 0, frame / 30.0f, true, NULL, 1, MixBlend_Setup, MixDirection_In);
+				arenaAnimations[i]->apply(*arenaSkeleton, 0, frame / 30.0f, true, NULL, 1, MixBlend_Setup, MixDirection_In);
+				assertNearLocalPose(*heapSkeleton, *arenaSkeleton, arenaError * 2);
+				assertSameDeform(*heapSkeleton, *arenaSkeleton);
+			}
+		}
+		delete heapSkeleton;
+		delete arenaSkeleton;
+		delete heapData;
+		delete arenaData;
+	}
+
+	dispose(compressedAtlas, compressedData, compressedStateData, compressedSkeleton, compressedState);
+	dispose(atlas, skeletonData, stateData, skeleton, state);
+}
+
+void testDeformAlias() {
+	// The blend kernels give the same floats as the scalar formulas, for counts with and without a scalar tail.
+	float from[37], to[37], base[37], out[37];
+	for (int i = 0; i < 37; i++) {
+		from[i] = i * 0.37f - 3;
+		to[i] = 5 - i * 1.3f;
+		base[i] = i * 0.11f;
+	}
+	for (size_t count = 0; count <= 37; count++) {
+		SimdUtil::lerp(from, to, 0.3f, out, count);
+		for (size_t i = 0; i < count; i++) assert(out[i] == from[i] + (to[i] - from[i]) * 0.3f);
+		memcpy(out, to, sizeof(out));
+		SimdUtil::add(from, base, 0.7f, out, count);
+		for (size_t i = 0; i < count; i++) assert(out[i] == to[i] + (from[i] - base[i]) * 0.7f);
+		memcpy(out, to, sizeof(out));
+		SimdUtil::add(from, NULL, 0.7f, out, count);
+		for (size_t i = 0; i < count; i++) assert(out[i] == to[i] + from[i] * 0.7f);
+		SimdUtil::scale(from, 0.6f, out, count);
+		for (size_t i = 0; i < count; i++) assert(out[i] == from[i] * 0.6f);
+	}
+
+	Atlas *atlas = NULL;
+	SkeletonData *skeletonData = NULL;
+	AnimationStateData *stateData = NULL;
+	Skeleton *skeleton = NULL;
+	AnimationState *state = NULL;
+	loadBinary("testdata/spineboy/spineboy-pro.skel", "testdata/spineboy/spineboy.atlas", atlas, skeletonData, stateData, skeleton, state);
+
+	DeformTimeline *timeline = NULL;
+	Vector<Animation *> &animations = skeletonData->getAnimations();
+	for (size_t i = 0; i < animations.size() && !timeline; i++) {
+		Vector<Timeline *> &timelines = animations[i]->getTimelines();
+		for (size_t ii = 0; ii < timelines.size() && !timeline; ii++)
+			if (timelines[ii]->getRTTI().isExactly(DeformTimeline::rtti)) timeline = static_cast<DeformTimeline *>(timelines[ii]);
+	}
+	assert(timeline);
+	Slot &slot = *skeleton->getSlots()[timeline->getSlotIndex()];
+	slot.setAttachment(timeline->getAttachment());
+	Vector<float> &lastKey = timeline->getVertices()[timeline->getFrames().size() - 1];
+	float lastTime = timeline->getFrames()[timeline->getFrames().size() - 1];
+
+	// A single key at alpha 1 is used without copying it.
+	timeline->apply(*skeleton, 0, lastTime + 1, NULL, 1, MixBlend_Setup, MixDirection_In);
+	assert(slot.getDeformVertices() == lastKey.buffer());
+	assert(slot.getDeformLength() == lastKey.size());
+
+	// Blending copies the aliased key before changing it.
+	timeline->apply(*skeleton, 0, lastTime + 1, NULL, 0.5f, MixBlend_Replace, MixDirection_In);
+	assert(slot.getDeformVertices() == slot.getDeform().buffer());
+	for (size_t i = 0; i < lastKey.size(); i++) assert(slot.getDeform()[i] == lastKey[i]);
+
+	// getDeform() copies the aliased key, so changes to the vector do not change the timeline.
+	timeline->apply(*skeleton, 0, lastTime + 1, NULL, 1, MixBlend_First, MixDirection_In);
+	assert(slot.getDeformVertices() == lastKey.buffer());
+	Vector<float> &deform = slot.getDeform();
+	SP_UNUSED(deform);
+	assert(deform.size() == lastKey.size() && deform.buffer() != lastKey.buffer());
+	for (size_t i = 0; i < lastKey.size(); i++) assert(deform[i] == lastKey[i]);
+	assert(slot.getDeformVertices() == deform.buffer());
+
+	// Before the first key, the setup pose is restored.
+	timeline->apply(*skeleton, 0, timeline->getFrames()[0] - 1, NULL, 1, MixBlend_Setup, MixDirection_In);
+	assert(slot.getDeformLength() == 0 && slot.getDeformVertices() == NULL);
+	timeline->apply(*skeleton, 0, lastTime + 1, NULL, 1, MixBlend_Setup, MixDirection_In);
+	slot.setAttachment(NULL);
+	assert(slot.getDeformLength() == 0);
+
+	dispose(atlas, skeletonData, stateData, skeleton, state);
+}
+
+void testSkeletonInstance() {
+	Atlas *atlas = NULL;
+	SkeletonData *skeletonData = NULL;
+	AnimationStateData *stateData = NULL;
+	Skeleton *skeleton = NULL;
+	AnimationState *state = NULL;
+	loadBinary("testdata/goblins/goblins-pro.skel", "testdata/goblins/goblins.atlas", atlas, skeletonData, stateData, skeleton, state);
+
+	SkeletonPoseCache cache(skeletonData, 30);
+	Animation *animation = skeletonData->getAnimations()[0];
+	Skin *skin = skeletonData->findSkin("goblingirl");
+	SkeletonInstance first(&cache), second(&cache);
+	first.setAnimation(animation, true);
+	first.setSkin(skin);
+	first.setPosition(100, 50);
+	second.setAnimation(animation, true);
+	second.setSkin(skin);
+	second.setTime(animation->getDuration());
+
+	// Instances at the same quantized time share one pose.
+	SkeletonPose *pose = first.getPose();
+	assert(second.getPose() == pose);
+	assert(cache.size() == 1);
+	second.setSkin(NULL);
+	assert(second.getPose() != pose);
+	assert(cache.size() == 2);
+
+	for (int frame = 0; frame < 60; frame++) {
+		first.update(1 / 60.0f);
+		pose = first.getPose();
+		float time = (int) (first.getTime() * 30) / 30.0f;
+		skeleton->setSkin(skin);
+		skeleton->setToSetupPose();
+		skeleton->setPosition(100, 50);
+		animation->apply(*skeleton, time, time, false, NULL, 1, MixBlend_Setup, MixDirection_In);
+		skeleton->updateWorldTransform();
+
+		Vector<Slot *> &drawOrder = skeleton->getDrawOrder();
+		assert(pose->getDrawOrder().size() == drawOrder.size());
+		for (size_t i = 0; i < drawOrder.size(); i++)
+			assert(pose->getDrawOrder()[i] == drawOrder[i]->getData().getIndex());
+
+		Vector<float> expected, actual;
+		Vector<Slot *> &slots = skeleton->getSlots();
+		for (size_t i = 0; i < slots.size(); i++) {
+			Attachment *attachment = slots[i]->getAttachment();
+			assert(pose->getAttachment(i) == attachment);
+			if (attachment == NULL) continue;
+			if (attachment->getRTTI().isExactly(RegionAttachment::rtti)) {
+				expected.setSize(8, 0);
+				static_cast<RegionAttachment *>(attachment)->computeWorldVertices(slots[i]->getBone(), expected, 0, 2);
+			} else if (attachment->getRTTI().instanceOf(VertexAttachment::rtti)) {
+				VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(attachment);
+				expected.setSize(vertexAttachment->getWorldVerticesLength(), 0);
+				vertexAttachment->computeWorldVertices(*slots[i], 0, expected.size(), expected, 0, 2);
+			} else
+				continue;
+			assert(pose->getVerticesLength(i) == expected.size());
+			actual.setSize(expected.size(), 0);
+			first.computeWorldVertices(*pose, i, actual.buffer(), 0, 2);
+			for (size_t ii = 0; ii < expected.size(); ii++)
+				assert(nearlyEqual(expected[ii], actual[ii]));
+		}
+	}
+
+	// Rotation and scale are applied around the origin, before the position.
+	first.setRotation(90);
+	first.setScaleX(2);
+	for (size_t i = 0; i < pose->getSlotCount(); i++) {
+		size_t length = pose->getVerticesLength(i);
+		if (length == 0) continue;
+		Vector<float> actual;
+		actual.setSize(length * 2, 0);
+		first.computeWorldVertices(*pose, i, actual.buffer(), 1, 4);
+		float *vertices = pose->getVertices(i);
+		SP_UNUSED(vertices);
+		for (size_t ii = 0; ii < length; ii += 2) {
+			assert(nearlyEqual(actual[ii * 2 + 1], 100 - vertices[ii + 1]));
+			assert(nearlyEqual(actual[ii * 2 + 2], 50 + vertices[ii] * 2));
+		}
+	}
+
+	cache.clear();
+	assert(cache.size() == 0);
+	dispose(atlas, skeletonData, stateData, skeleton, state);
+}
+
+static void assertSameSkeleton(Skeleton &expected, Skeleton &actual) {
+	assertSameLocalPose(expected, actual);
+	Vector<Bone *> &expectedBones = expected.getBones(), &actualBones = actual.getBones();
+	SP_UNUSED(actualBones);
+	for (size_t i = 0; i < expectedBones.size(); i++) {
+		assert(expectedBones[i]->getWorldX() == actualBones[i]->getWorldX());
+		assert(expectedBones[i]->getWorldY() == actualBones[i]->getWorldY());
+		assert(expectedBones[i]->getA() == actualBones[i]->getA() && expectedBones[i]->getD() == actualBones[i]->getD());
+	}
+	Vector<Slot *> &expectedSlots = expected.getSlots(), &actualSlots = actual.getSlots();
+	for (size_t i = 0; i < expectedSlots.size(); i++) {
+		Slot &a = *expectedSlots[i], &b = *actualSlots[i];
+		SP_UNUSED(b);
+		assert(a.getAttachment() == b.getAttachment());
+		assert(a.getColor().r == b.getColor().r && a.getColor().a == b.getColor().a);
+		assert(a.getDeform().size() == b.getDeform().size());
+		for (size_t ii = 0; ii < a.getDeform().size(); ii++)
+			assert(a.getDeform()[ii] == b.getDeform()[ii]);
+		assert(expected.getDrawOrder()[i]->getData().getIndex() == actual.getDrawOrder()[i]->getData().getIndex());
+	}
+}
+
+static void stepSkeleton(Skeleton &skeleton, AnimationState &state, int frame) {
+	// Input arriving during the frames that are simulated again.
+	if (frame == 70) state.setAnimation(0, "jump", false);
+	if (frame == 80) state.addAnimation(0, "run", true, 0);
+	state.update(1 / 60.0f);
+	state.apply(skeleton);
+	skeleton.updateWorldTransform();
+}
+
+void testSkeletonSnapshot() {
+	Atlas *atlas = NULL;
+	SkeletonData *skeletonData = NULL;
+	AnimationStateData *stateData = NULL;
+	Skeleton *skeleton = NULL;
+	AnimationState *state = NULL;
+	loadBinary("testdata/spineboy/spineboy-pro.skel", "testdata/spineboy/spineboy.atlas", atlas, skeletonData, stateData, skeleton, state);
+	Skeleton reference(skeletonData), clone(skeletonData);
+	AnimationState referenceState(stateData), cloneState(stateData);
+
+	AnimationState *states[] = {state, &referenceState};
+	Skeleton *skeletons[] = {skeleton, &reference};
+	for (int i = 0; i < 2; i++) {
+		states[i]->setAnimation(0, "walk", true);
+		states[i]->addAnimation(0, "run", true, 0.7f);
+		states[i]->setAnimation(1, "aim", true)->setAlpha(0.5f);
+	}
+
+	// Play to a frame in the middle of a mix, snapshot, run ahead, then roll back and simulate the same frames again. The
+	// reference plays straight through.
+	SkeletonSnapshot snapshot;
+	for (int frame = 0; frame < 60; frame++)
+		for (int i = 0; i < 2; i++) stepSkeleton(*skeletons[i], *states[i], frame);
+	snapshot.capture(*skeleton, state);
+	assert(state->getCurrent(0)->getMixingFrom() != NULL);
+	for (int frame = 60; frame < 90; frame++)
+		stepSkeleton(*skeleton, *state, frame);
+
+	for (int rollback = 0; rollback < 3; rollback++) {
+		snapshot.restore(*skeleton, state);
+		for (int frame = 60; frame < 90; frame++)
+			stepSkeleton(*skeleton, *state, frame);
+	}
+	for (int frame = 60; frame < 90; frame++)
+		stepSkeleton(reference, referenceState, frame);
+	assertSameSkeleton(reference, *skeleton);
+
+	// Captures reuse the buffer, and restoring then capturing again gives the same bytes.
+	snapshot.capture(*skeleton, state);
+	const unsigned char *data = snapshot.getData();
+	Vector<unsigned char> bytes;
+	for (size_t i = 0; i < snapshot.size(); i++)
+		bytes.add(data[i]);
+	snapshot.restore(*skeleton, state);
+	snapshot.capture(*skeleton, state);
+	assert(snapshot.getData() == data && snapshot.size() == bytes.size());
+	assert(memcmp(data, bytes.buffer(), bytes.size()) == 0);
+
+	// Restoring into another skeleton and animation state clones them.
+	snapshot.restore(clone, &cloneState);
+	for (int frame = 90; frame < 150; frame++) {
+		stepSkeleton(*skeleton, *state, frame);
+		stepSkeleton(clone, cloneState, frame);
+		assertSameSkeleton(*skeleton, clone);
+	}
+
+	dispose(atlas, skeletonData, stateData, skeleton, state);
+
+	// Restoring a snapshot taken with another skin clears the attachments cached by handle.
+	loadBinary("testdata/goblins/goblins-pro.skel", "testdata/goblins/goblins.atlas", atlas, skeletonData, stateData, skeleton, state);
+	Skeleton expected(skeletonData);
+	expected.setSkin("goblin");
+	expected.setSlotsToSetupPose();
+	skeleton->setSkin("goblin");
+	skeleton->setSlotsToSetupPose();
+	snapshot.capture(*skeleton, state);
+	skeleton->setSkin("goblingirl");
+	skeleton->setSlotsToSetupPose();
+	snapshot.restore(*skeleton, state);
+	skeleton->setSlotsToSetupPose();
+	assert(skeleton->getSkin()->getName() == "goblin");
+	for (size_t i = 0; i < skeleton->getSlots().size(); i++)
+		assert(skeleton->getSlots()[i]->getAttachment() == expected.getSlots()[i]->getAttachment());
+
+	dispose(atlas, skeletonData, stateData, skeleton, state);
+}
+
+static void clearAttachmentHandles(SkeletonData *skeletonData) {
+	for (size_t i = 0; i < skeletonData->getSlots().size(); i++) {
+		SlotData *slot = skeletonData->getSlots()[i];
+		slot->setAttachmentName(String(slot->getAttachmentName()));
+	}
+	for (size_t i = 0; i < skeletonData->getAnimations().size(); i++) {
+		Vector<Timeline *> &timelines = skeletonData->getAnimations()[i]->getTimelines();
+		for (size_t ii = 0; ii < timelines.size(); ii++) {
+			if (!timelines[ii]->getRTTI().isExactly(AttachmentTimeline::rtti)) continue;
+			Vector<int> &handles = static_cast<AttachmentTimeline *>(timelines[ii])->getAttachmentHandles();
+			for (size_t iii = 0; iii < handles.size(); iii++)
+				handles[iii] = -1;
+		}
+	}
+}
+
+void testAttachmentHandles() {
+	Atlas *atlas = NULL, *referenceAtlas = NULL;
+	SkeletonData *skeletonData = NULL, *referenceData = NULL;
+	AnimationStateData *stateData = NULL, *referenceStateData = NULL;
+	Skeleton *skeleton = NULL, *reference = NULL;
+	AnimationState *state = NULL, *referenceState = NULL;
+	loadBinary("testdata/goblins/goblins-pro.skel", "testdata/goblins/goblins.atlas", atlas, skeletonData, stateData, skeleton, state);
+	loadJson("testdata/goblins/goblins-pro.json", "testdata/goblins/goblins.atlas", referenceAtlas, referenceData,
+			 referenceStateData, reference, referenceState);
+
+	// Every named attachment of the skins, setup pose and timelines has a handle for its slot.
+	assert(skeletonData->getAttachmentHandleCount() > 0);
+	for (size_t i = 0; i < skeletonData->getSlots().size(); i++) {
+		SlotData *slot = skeletonData->getSlots()[i];
+		SP_UNUSED(slot);
+		assert(slot->getAttachmentHandle() == skeletonData->findAttachmentHandle((int) i, slot->getAttachmentName()));
+		assert(slot->getAttachmentName().isEmpty() == (slot->getAttachmentHandle() == -1));
+	}
+	for (size_t i = 0; i < skeletonData->getAttachmentHandleCount(); i++) {
+		int slotIndex = skeletonData->getAttachmentHandleSlot((int) i);
+		SP_UNUSED(slotIndex);
+		assert(skeletonData->findAttachmentHandle(slotIndex, skeletonData->getAttachmentHandleName((int) i)) == (int) i);
+	}
+	assert(skeletonData->findAttachmentHandle(0, "no such attachment") == -1);
+
+	// The reference finds attachments by name.
+	clearAttachmentHandles(referenceData);
+	const char *skins[] = {"goblin", "goblingirl"};
+	for (int i = 0; i < 2; i++) {
+		skeleton->setSkin(skins[i]);
+		skeleton->setSlotsToSetupPose();
+		reference->setSkin(skins[i]);
+		reference->setSlotsToSetupPose();
+		state->setAnimation(0, "walk", true);
+		referenceState->setAnimation(0, "walk", true);
+		for (int frame = 0; frame < 120; frame++) {
+			state->update(1 / 60.0f);
+			state->apply(*skeleton);
+			referenceState->update(1 / 60.0f);
+			referenceState->apply(*reference);
+			Vector<Slot *> &slots = skeleton->getSlots(), &referenceSlots = reference->getSlots();
+			for (size_t ii = 0; ii < slots.size(); ii++) {
+				Attachment *attachment = slots[ii]->getAttachment(), *referenceAttachment = referenceSlots[ii]->getAttachment();
+				SP_UNUSED(referenceAttachment);
+				assert((attachment == NULL) == (referenceAttachment == NULL));
+				if (attachment) assert(attachment->getName() == referenceAttachment->getName());
+			}
+		}
+	}
+
+	// Cached attachments are found again after the skin is set.
+	Skin *skin = skeleton->getSkin();
+	Slot *slot = skeleton->findSlot("left-hand-item");
+	int slotIndex = slot->getData().getIndex();
+	int handle = skeletonData->findAttachmentHandle(slotIndex, "dagger");
+	Attachment *dagger = skeleton->getAttachment(slotIndex, handle, "dagger");
+	SP_UNUSED(dagger);
+	assert(dagger != NULL && dagger == skeleton->getAttachment(slotIndex, "dagger"));
+	Attachment *spear = skeleton->getAttachment(slotIndex, "spear");
+	assert(spear != NULL && spear != dagger);
+	skin->setAttachment(slotIndex, "dagger", spear->copy());
+	assert(skeleton->getAttachment(slotIndex, handle, "dagger") == dagger);
+	skeleton->setSkin(skin);
+	Attachment *copy = skeleton->getAttachment(slotIndex, handle, "dagger");
+	SP_UNUSED(copy);
+	assert(copy != dagger && copy == skin->getAttachment(slotIndex, "dagger"));
+
+	dispose(referenceAtlas, referenceData, referenceStateData, reference, referenceState);
+	dispose(atlas, skeletonData, stateData, skeleton, state);
+}
+
+template<typename T>
+static void assertFindsAll(Vector<T *> &items, T *(SkeletonData::*find)(const String &), SkeletonData *skeletonData) {
+	SP_UNUSED(find);
+	SP_UNUSED(skeletonData);
+	for (size_t i = 0; i < items.size(); i++)
+		assert((skeletonData->*find)(items[i]->getName()) == ContainerUtil::findWithName(items, items[i]->getName()));
+	assert((skeletonData->*find)("no such name") == NULL);
+}
+
+void testNameIndex() {
+	const char *files[][2] = {{"testdata/spineboy/spineboy-pro.json", "testdata/spineboy/spineboy.atlas"},
+							  {"testdata/goblins/goblins-pro.skel", "testdata/goblins/goblins.atlas"},
+							  {"testdata/tank/tank-pro.json", "testdata/tank/tank.atlas"}};
+	for (int i = 0; i < 3; i++) {
+		Atlas *atlas = NULL;
+		SkeletonData *skeletonData = NULL;
+		AnimationStateData *stateData = NULL;
+		Skeleton *skeleton = NULL;
+		AnimationState *state = NULL;
+		if (strstr(files[i][0], ".json"))
+			loadJson(files[i][0], files[i][1], atlas, skeletonData, stateData, skeleton, state);
+		else
+			loadBinary(files[i][0], files[i][1], atlas, skeletonData, stateData, skeleton, state);
+
+		assertFindsAll(skeletonData->getBones(), &SkeletonData::findBone, skeletonData);
+		assertFindsAll(skeletonData->getSlots(), &SkeletonData::findSlot, skeletonData);
+		assertFindsAll(skeletonData->getSkins(), &SkeletonData::findSkin, skeletonData);
+		assertFindsAll(skeletonData->getEvents(), &SkeletonData::findEvent, skeletonData);
+		assertFindsAll(skeletonData->getAnimations(), &SkeletonData::findAnimation, skeletonData);
+		assertFindsAll(skeletonData->getIkConstraints(), &SkeletonData::findIkConstraint, skeletonData);
+		assertFindsAll(skeletonData->getTransformConstraints(), &SkeletonData::findTransformConstraint, skeletonData);
+		assertFindsAll(skeletonData->getPathConstraints(), &SkeletonData::findPathConstraint, skeletonData);
+
+		Vector<AtlasRegion *> &regions = atlas->getRegions();
+		for (size_t ii = 0; ii < regions.size(); ii++) {
+			AtlasRegion *region = atlas->findRegion(regions[ii]->name);
+			assert(region != NULL && region->name == regions[ii]->name);
+			for (size_t iii = 0; iii < regions.size() && regions[iii] != region; iii++)
+				assert(regions[iii]->name != region->name);
+		}
+		assert(atlas->findRegion("no such region") == NULL);
+
+		// Handles get the same items as the find methods, from the data and the skeleton.
+		for (size_t ii = 0; ii < skeletonData->getBones().size(); ii++) {
+			const String &name = skeletonData->getBones()[ii]->getName();
+			BoneHandle handle = skeletonData->findBoneHandle(name);
+			SP_UNUSED(handle);
+			assert(handle.isValid() && skeletonData->getBone(handle) == skeletonData->findBone(name));
+			assert(skeleton->getBone(handle) == skeleton->findBone(name) && skeleton->findBoneIndex(name) == handle.getIndex());
+		}
+		for (size_t ii = 0; ii < skeletonData->getSlots().size(); ii++) {
+			const String &name = skeletonData->getSlots()[ii]->getName();
+			SP_UNUSED(name);
+			assert(skeleton->getSlot(skeletonData->findSlotHandle(name)) == skeleton->findSlot(name));
+			assert(skeleton->findSlot(name)->getData().getName() == name);
+		}
+		for (size_t ii = 0; ii < skeletonData->getIkConstraints().size(); ii++) {
+			const String &name = skeletonData->getIkConstraints()[ii]->getName();
+			SP_UNUSED(name);
+			assert(skeleton->findIkConstraint(name)->getData().getName() == name);
+		}
+		for (size_t ii = 0; ii < skeletonData->getPathConstraints().size(); ii++) {
+			const String &name = skeletonData->getPathConstraints()[ii]->getName();
+			SP_UNUSED(name);
+			assert(skeleton->findPathConstraint(name)->getData().getName() == name);
+		}
+		Animation *animation = skeletonData->getAnimations()[0];
+		SP_UNUSED(animation);
+		assert(skeletonData->getAnimation(skeletonData->findAnimationHandle(animation->getName())) == animation);
+		AnimationHandle invalid = skeletonData->findAnimationHandle("no such animation");
+		SP_UNUSED(invalid);
+		assert(!invalid.isValid() && skeletonData->getAnimation(invalid) == NULL && skeleton->getBone(BoneHandle()) == NULL);
+
+		dispose(atlas, skeletonData, stateData, skeleton, state);
+	}
+
+	// Items added after an update are found by name, duplicates find the first item.
+	SkeletonData skeletonData;
+	Vector<EventData *> &events = skeletonData.getEvents();
+	events.add(new(__FILE__, __LINE__) EventData("a"));
+	events.add(new(__FILE__, __LINE__) EventData("b"));
+	events.add(new(__FILE__, __LINE__) EventData("a"));
+	skeletonData.updateNameIndex();
+	events.add(new(__FILE__, __LINE__) EventData("c"));
+	assert(skeletonData.findEvent("a") == events[0]);
+	assert(skeletonData.findEvent("c") == events[3]);
+	skeletonData.updateNameIndex();
+	for (int i = 0; i < 100; i++) {
+		char name[16];
+		sprintf(name, "event%d", i);
+		events.add(new(__FILE__, __LINE__) EventData(name));
+		if (i % 10 == 0) skeletonData.updateNameIndex();
+	}
+	for (size_t i = 0; i < events.size(); i++)
+		assert(skeletonData.findEvent(events[i]->getName()) == ContainerUtil::findWithName(events, events[i]->getName()));
+	delete events[0];
+	events.removeAt(0);
+	skeletonData.clearNameIndex();
+	assert(skeletonData.findEvent("a") == events[1]);
+	skeletonData.updateNameIndex();
+	assert(skeletonData.findEvent("a") == events[1] && skeletonData.findEvent("b") == events[0]);
+
+	// Large JSON objects are indexed, lookups stay case insensitive and find the first item.
+	Json json("{\"a\":1,\"b\":2,\"c\":3,\"d\":4,\"e\":5,\"f\":6,\"g\":7,\"Dup\":8,\"dup\":9,\"h\":{\"x\":10}}");
+	assert(Json::getInt(&json, "a", 0) == 1 && Json::getInt(&json, "G", 0) == 7);
+	assert(Json::getInt(&json, "DUP", 0) == 8 && Json::getInt(&json, "missing", -1) == -1);
+	assert(Json::getInt(Json::getItem(&json, "h"), "X", 0) == 10);
+}
+
+/// Clips all region and mesh attachments like a renderer and returns the total area of the clipped triangles. If a clipping
+/// attachment is given, it replaces the attachments of clipping slots.
+static float clippedArea(Skeleton &skeleton, SkeletonClipping &clipper, ClippingAttachment *replacement, size_t &triangleCount) {
+	unsigned short quadTriangles[] = {0, 1, 2, 2, 3, 0};
+	Vector<float> worldVertices;
+	float area = 0;
+	triangleCount = 0;
+	Vector<Slot *> &drawOrder = skeleton.getDrawOrder();
+	for (size_t i = 0; i < drawOrder.size(); i++) {
+		Slot &slot = *drawOrder[i];
+		Attachment *attachment = slot.getAttachment();
+		if (attachment && attachment->getRTTI().isExactly(ClippingAttachment::rtti)) {
+			clipper.clipStart(slot, replacement ? replacement : static_cast<ClippingAttachment *>(attachment));
+			continue;
+		}
+		float *uvs = NULL;
+		unsigned short *triangles = NULL;
+		size_t trianglesLength = 0;
+		if (attachment && attachment->getRTTI().isExactly(RegionAttachment::rtti)) {
+			RegionAttachment *region = static_cast<RegionAttachment *>(attachment);
+			worldVertices.setSize(8, 0);
+			region->computeWorldVertices(slot.getBone(), worldVertices, 0, 2);
+			uvs = region->getUVs().buffer();
+			triangles = quadTriangles;
+			trianglesLength = 6;
+		} else if (attachment && attachment->getRTTI().isExactly(MeshAttachment::rtti)) {
+			MeshAttachment *mesh = static_cast<MeshAttachment *>(attachment);
+			worldVertices.setSize(mesh->getWorldVerticesLength(), 0);
+			mesh->computeWorldVertices(slot, 0, mesh->getWorldVerticesLength(), worldVertices, 0, 2);
+			uvs = mesh->getUVs().buffer();
+			triangles = mesh->getTriangles().buffer();
+			trianglesLength = mesh->getTriangles().size();
+		}
+		if (trianglesLength > 0) {
+			float *vertices = worldVertices.buffer();
+			if (clipper.isClipping()) {
+				clipper.clipTriangles(worldVertices.buffer(), triangles, trianglesLength, uvs, 2);
+				vertices = clipper.getClippedVertices().buffer();
+				triangles = clipper.getClippedTriangles().buffer();
+				trianglesLength = clipper.getClippedTriangles().size();
+			}
+			for (size_t ii = 0; ii < trianglesLength; ii += 3) {
+				float *a = vertices + triangles[ii] * 2, *b = vertices + triangles[ii + 1] * 2, *c = vertices + triangles[ii + 2] * 2;
+				area += MathUtil::abs((b[0] - a[0]) * (c[1] - a[1]) - (c[0] - a[0]) * (b[1] - a[1])) / 2;
+			}
+			triangleCount += trianglesLength / 3;
+		}
+		clipper.clipEnd(slot);
+	}
+	clipper.clipEnd();
+	return area;
+}
+
+static ClippingAttachment *newSquareClippingAttachment(float x, float y, float size) {
+	ClippingAttachment *clip = new(__FILE__, __LINE__) ClippingAttachment("square");
+	float vertices[] = {x, y, x + size, y, x + size, y + size, x, y + size};
+	for (int i = 0; i < 8; i++)
+		clip->getVertices().add(vertices[i]);
+	clip->setWorldVerticesLength(8);
+	clip->updateConvexPolygons();
+	return clip;
+}
+
+void testClipping() {
+	Atlas *atlas = NULL;
+	SkeletonData *skeletonData = NULL;
+	AnimationStateData *stateData = NULL;
+	Skeleton *skeleton = NULL;
+	AnimationState *state = NULL;
+	loadBinary("testdata/spineboy/spineboy-pro.skel", "testdata/spineboy/spineboy.atlas", atlas, skeletonData, stateData, skeleton, state);
+	SkeletonClipping clipper;
+
+	// The portal animation clips spineboy with an unweighted clipping attachment, which caches its decomposition. The
+	// same polygon decomposed every frame must clip the same area, also when the skeleton is mirrored.
+	ClippingAttachment *clip = static_cast<ClippingAttachment *>(skeleton->getAttachment("clipping", "clipping"));
+	assert(clip != NULL && clip->getConvexPolygonSizes().size() > 0);
+	ClippingAttachment *uncached = static_cast<ClippingAttachment *>(clip->copy());
+	uncached->getConvexPolygonSizes().clear();
+	state->setAnimation(0, "portal", true);
+	Slot *clippingSlot = skeleton->findSlot("clipping");
+	size_t clippedFrames = 0;
+	for (int frame = 0; frame < 200; frame++) {
+		skeleton->setScaleX(frame >= 100 ? -1 : 1);
+		state->update(1 / 60.0f);
+		state->apply(*skeleton);
+		skeleton->updateWorldTransform();
+		if (clippingSlot->getAttachment() != clip) continue;
+		size_t triangles, uncachedTriangles, unclippedTriangles;
+		float area = clippedArea(*skeleton, clipper, NULL, triangles);
+		float uncachedArea = clippedArea(*skeleton, clipper, uncached, uncachedTriangles);
+		SP_UNUSED(uncachedArea);
+		clippingSlot->setAttachment(NULL);
+		float unclippedArea = clippedArea(*skeleton, clipper, NULL, unclippedTriangles);
+		clippingSlot->setAttachment(clip);
+		assert(MathUtil::abs(area - uncachedArea) <= 0.001f * unclippedArea);
+		assert(area <= unclippedArea);
+		if (area < unclippedArea) clippedFrames++;
+	}
+	assert(clippedFrames > 0);
+	delete uncached;
+
+	// A clipping polygon around everything passes triangles through, one far away clips everything.
+	skeleton->setScaleX(1);
+	skeleton->setToSetupPose();
+	skeleton->updateWorldTransform();
+	ClippingAttachment *around = newSquareClippingAttachment(-10000, -10000, 20000);
+	ClippingAttachment *away = newSquareClippingAttachment(50000, 50000, 10);
+	size_t triangles, unclippedTriangles;
+	clippingSlot->setAttachment(NULL);
+	float unclippedArea = clippedArea(*skeleton, clipper, NULL, unclippedTriangles);
+	SP_UNUSED(unclippedArea);
+	clippingSlot->setAttachment(clip);
+	float area = clippedArea(*skeleton, clipper, around, triangles);
+	SP_UNUSED(area);
+	assert(unclippedArea > 0 && area == unclippedArea && triangles == unclippedTriangles);
+	area = clippedArea(*skeleton, clipper, away, triangles);
+	assert(area == 0 && triangles == 0);
+	delete around;
+	delete away;
+
+	// Attributes are interpolated like UVs. With UVs and the first two attributes equal to the positions, every clipped
+	// vertex must reproduce its position, while constant attributes such as tint colors stay constant.
+	Vector<float> grid;
+	Vector<float> attributes;
+	Vector<unsigned short> gridTriangles;
+	for (int y = 0; y < 9; y++) {
+		for (int x = 0; x < 9; x++) {
+			grid.add(x * 250.0f - 1000);
+			grid.add(y * 250.0f - 1000);
+			float vertexAttributes[] = {x * 250.0f - 1000, y * 250.0f - 1000, 1, 0.5f, 0.25f, 1, 0, 0, 0, 1};
+			for (int i = 0; i < 10; i++)
+				attributes.add(vertexAttributes[i]);
+			if (x < 8 && y < 8) {
+				unsigned short corner = (unsigned short) (y * 9 + x);
+				unsigned short quad[] = {corner, (unsigned short) (corner + 1), (unsigned short) (corner + 10), corner,
+										 (unsigned short) (corner + 10), (unsigned short) (corner + 9)};
+				for (int i = 0; i < 6; i++)
+					gridTriangles.add(quad[i]);
+			}
+		}
+	}
+	ClippingAttachment *square = newSquareClippingAttachment(-30, -70, 200);
+	clipper.clipStart(*clippingSlot, square);
+	clipper.clipTriangles(grid.buffer(), gridTriangles.buffer(), gridTriangles.size(), grid.buffer(), 2);
+	Vector<float> clippedVertices;
+	clippedVertices.addAll(clipper.getClippedVertices());
+	clipper.clipTriangles(grid.buffer(), gridTriangles.buffer(), gridTriangles.size(), grid.buffer(), 2, attributes.buffer(), 10);
+	Vector<float> &vertices = clipper.getClippedVertices(), &uvs = clipper.getClippedUVs();
+	Vector<float> &clippedAttributes = clipper.getClippedAttributes();
+	SP_UNUSED(uvs);
+	assert(clipper.getClippedTriangles().size() > 0 && vertices.size() == clippedVertices.size());
+	assert(uvs.size() == vertices.size() && clippedAttributes.size() == vertices.size() / 2 * 10);
+	for (size_t i = 0, n = vertices.size() >> 1; i < n; i++) {
+		float x = vertices[i * 2], y = vertices[i * 2 + 1];
+		float *vertexAttributes = clippedAttributes.buffer() + i * 10;
+		SP_UNUSED(x);
+		SP_UNUSED(y);
+		SP_UNUSED(vertexAttributes);
+		assert(x == clippedVertices[i * 2] && y == clippedVertices[i * 2 + 1]);
+		assert(MathUtil::abs(uvs[i * 2] - x) < 0.01f && MathUtil::abs(uvs[i * 2 + 1] - y) < 0.01f);
+		assert(MathUtil::abs(vertexAttributes[0] - x) < 0.01f && MathUtil::abs(vertexAttributes[1] - y) < 0.01f);
+		assert(nearlyEqual(vertexAttributes[3], 0.5f) && nearlyEqual(vertexAttributes[9], 1));
+	}
+	clipper.clipEnd();
+	delete square;
+
+	dispose(atlas, skeletonData, stateData, skeleton, state);
+}
+
+/// Identifies an updatable independent of the skeleton: a bone index, or a constraint order offset past the bones.
+size_t updatableIndex(Skeleton &skeleton, Updatable *updatable) {
+	if (updatable->getRTTI().isExactly(Bone::rtti)) return ((Bone *) updatable)->getData().getIndex();
+	size_t offset = skeleton.getBones().size();
+	if (updatable->getRTTI().isExactly(IkConstraint::rtti)) return offset + ((IkConstraint *) updatable)->getData().getOrder();
+	if (updatable->getRTTI().isExactly(TransformConstraint::rtti))
+		return offset + ((TransformConstraint *) updatable)->getData().getOrder();
+	return offset + ((PathConstraint *) updatable)->getData().getOrder();
+}
+
+static void assertSameUpdateCache(Skeleton &expected, Skeleton &actual) {
+	Vector<Updatable *> &expectedCache = expected.getUpdateCacheList(), &actualCache = actual.getUpdateCacheList();
+	SP_UNUSED(actualCache);
+	assert(expectedCache.size() == actualCache.size());
+	for (size_t i = 0; i < expectedCache.size(); i++)
+		assert(updatableIndex(expected, expectedCache[i]) == updatableIndex(actual, actualCache[i]));
+	Vector<Bone *> &expectedReset = expected.getUpdateCacheResetList(), &actualReset = actual.getUpdateCacheResetList();
+	SP_UNUSED(actualReset);
+	assert(expectedReset.size() == actualReset.size());
+	for (size_t i = 0; i < expectedReset.size(); i++)
+		assert(expectedReset[i]->getData().getIndex() == actualReset[i]->getData().getIndex());
+	for (size_t i = 0; i < expected.getBones().size(); i++)
+		assert(expected.getBones()[i]->isActive() == actual.getBones()[i]->isActive());
+	for (size_t i = 0; i < expected.getIkConstraints().size(); i++)
+		assert(expected.getIkConstraints()[i]->isActive() == actual.getIkConstraints()[i]->isActive());
+	for (size_t i = 0; i < expected.getTransformConstraints().size(); i++)
+		assert(expected.getTransformConstraints()[i]->isActive() == actual.getTransformConstraints()[i]->isActive());
+	for (size_t i = 0; i < expected.getPathConstraints().size(); i++)
+		assert(expected.getPathConstraints()[i]->isActive() == actual.getPathConstraints()[i]->isActive());
+}
+
+/// Flags the bones of all skins as skin required, as the editor does. SkeletonJson does not read boolean true values.
+static void requireSkinBones(SkeletonData *skeletonData) {
+	Vector<Skin *> &skins = skeletonData->getSkins();
+	for (size_t i = 0; i < skins.size(); i++)
+		for (size_t ii = 0; ii < skins[i]->getBones().size(); ii++)
+			skins[i]->getBones()[ii]->setSkinRequired(true);
+}
+
+void testPathConstraintCache() {
+	Atlas *atlas = new(__FILE__, __LINE__) Atlas("testdata/stretchyman/stretchyman.atlas", NULL);
+	SkeletonBinary binary(atlas);
+	SkeletonData *skeletonData = binary.readSkeletonDataFile("testdata/stretchyman/stretchyman-pro.skel");
+	assert(skeletonData);
+	assert(skeletonData->getPathConstraints().size() > 0);
+	Skeleton *cached = new(__FILE__, __LINE__) Skeleton(skeletonData);
+	Skeleton *uncached = new(__FILE__, __LINE__) Skeleton(skeletonData);
+	for (size_t i = 0; i < uncached->getPathConstraints().size(); i++) {
+		assert(cached->getPathConstraints()[i]->isGeometryCacheEnabled());
+		uncached->getPathConstraints()[i]->setGeometryCacheEnabled(false);
+	}
+
+	// Every animation is played and each frame is held for a second update, which reuses the cached paths. The cached
+	// and uncached poses are identical.
+	Vector<Animation *> &animations = skeletonData->getAnimations();
+	for (size_t i = 0; i < animations.size(); i++) {
+		for (float time = 0; time < animations[i]->getDuration(); time += 1 / 30.0f) {
+			for (int repeat = 0; repeat < 2; repeat++) {
+				animations[i]->apply(*cached, time, time, true, NULL, 1, MixBlend_Setup, MixDirection_In);
+				animations[i]->apply(*uncached, time, time, true, NULL, 1, MixBlend_Setup, MixDirection_In);
+				cached->updateWorldTransform();
+				uncached->updateWorldTransform();
+				for (size_t ii = 0; ii < cached->getBones().size(); ii++) {
+					Bone *expected = uncached->getBones()[ii], *actual = cached->getBones()[ii];
+					SP_UNUSED(expected);
+					SP_UNUSED(actual);
+					assert(actual->getA() == expected->getA() && actual->getB() == expected->getB());
+					assert(actual->getC() == expected->getC() && actual->getD() == expected->getD());
+					assert(actual->getWorldX() == expected->getWorldX() && actual->getWorldY() == expected->getWorldY());
+				}
+			}
+		}
+	}
+
+	// Moving a constraint to another slot with the same unweighted path computes the path for the new slot's bone.
+	PathAttachment *path = new(__FILE__, __LINE__) PathAttachment("path");
+	float pathVertices[] = {-10, 0, 0, 0, 30, 20, 70, -20, 100, 0, 110, 0};
+	for (int i = 0; i < 12; i++) path->getVertices().add(pathVertices[i]);
+	path->setWorldVerticesLength(12);
+	path->getLengths().add(100);
+	path->setConstantSpeed(true);
+	Slot *target = cached->getPathConstraints()[0]->getTarget(), *other = NULL;
+	for (size_t i = 0; i < cached->getSlots().size() && !other; i++)
+		if (&cached->getSlots()[i]->getBone() != &target->getBone()) other = cached->getSlots()[i];
+	size_t targetIndex = target->getData().getIndex(), otherIndex = other->getData().getIndex();
+	for (int i = 0; i < 2; i++) {
+		Skeleton *skeleton = i ? uncached : cached;
+		skeleton->setToSetupPose();
+		skeleton->getSlots()[targetIndex]->setAttachment(path);
+		skeleton->getSlots()[otherIndex]->setAttachment(path);
+		skeleton->updateWorldTransform();
+		skeleton->getPathConstraints()[0]->setTarget(skeleton->getSlots()[otherIndex]);
+		skeleton->updateWorldTransform();
+	}
+	for (size_t i = 0; i < cached->getBones().size(); i++) {
+		Bone *expected = uncached->getBones()[i], *actual = cached->getBones()[i];
+		SP_UNUSED(expected);
+		SP_UNUSED(actual);
+		assert(actual->getWorldX() == expected->getWorldX() && actual->getWorldY() == expected->getWorldY());
+	}
+
+	delete uncached;
+	delete cached;
+	delete path;
+	delete skeletonData;
+	delete atlas;
+}
+
+static size_t countCurves(SkeletonData *skeletonData, float type) {
+	size_t count = 0;
+	Vector<Animation *> &animations = skeletonData->getAnimations();
+	for (size_t i = 0; i < animations.size(); i++) {
+		Vector<Timeline *> &timelines = animations[i]->getTimelines();
+		for (size_t ii = 0; ii < timelines.size(); ii++) {
+			if (!timelines[ii]->getRTTI().instanceOf(CurveTimeline::rtti)) continue;
+			CurveTimeline *timeline = static_cast<CurveTimeline *>(timelines[ii]);
+			for (size_t frame = 0; frame < timeline->getFrameCount() - 1; frame++)
+				if (timeline->getCurveType(frame) == type) count++;
+		}
+	}
+	return count;
+}
+
+void testCurveModes() {
+	// An ease, a steep ease in, handles beyond 0 and 1 in y, and a curve with vertical tangents. The steep curves need more
+	// points than a uniform table has, so they stay sampled.
+	const float handles[][4] = {{0.25f, 0, 0.75f, 1}, {0, 0.5f, 0.05f, 1}, {0.3f, 2, 0.7f, -1}, {0, 1, 0, 1}};
+	const float bezier = 2, bezierUniform = 3;
+	assert(MathUtil::abs(CurveTimeline::getBezierPercent(0.25f, 0, 0.75f, 1, 0.5f) - 0.5f) < 0.00001f);
+	for (int p = 0; p <= 10; p++)
+		assert(MathUtil::abs(CurveTimeline::getBezierPercent(1 / 3.0f, 1 / 3.0f, 2 / 3.0f, 2 / 3.0f, p / 10.0f) - p / 10.0f) < 0.00001f);
+	for (int i = 0; i < 4; i++) {
+		float cx1 = handles[i][0], cy1 = handles[i][1], cx2 = handles[i][2], cy2 = handles[i][3];
+		TranslateTimeline sampled(2), uniform(2);
+		sampled.setCurve(0, cx1, cy1, cx2, cy2);
+		uniform.setCurve(0, cx1, cy1, cx2, cy2, CurveMode_Uniform);
+		assert(sampled.getCurveType(0) == bezier);
+		assert(uniform.getCurveType(0) == (i == 1 || i == 3 ? bezier : bezierUniform));
+
+		// The uniform points follow the curve at least about as closely as the sampled points.
+		float sampledError = 0, uniformError = 0;
+		for (int p = 0; p <= 1000; p++) {
+			float percent = p / 1000.0f, expected = CurveTimeline::getBezierPercent(cx1, cy1, cx2, cy2, percent);
+			sampledError = MathUtil::max(sampledError, MathUtil::abs(sampled.getCurvePercent(0, percent) - expected));
+			uniformError = MathUtil::max(uniformError, MathUtil::abs(uniform.getCurvePercent(0, percent) - expected));
+		}
+		assert(uniformError <= sampledError + 0.001f);
+		assert(uniform.getCurvePercent(0, 0) == 0);
+		assert(MathUtil::abs(uniform.getCurvePercent(0, 1) - 1) < 0.00001f);
+	}
+
+	// Both loaders store the curves of most example animations uniformly.
+	Atlas *atlas = new(__FILE__, __LINE__) Atlas("testdata/spineboy/spineboy.atlas", NULL);
+	for (int binary = 0; binary < 2; binary++) {
+		SkeletonData *skeletonData[2];
+		for (int mode = 0; mode < 2; mode++) {
+			CurveMode curveMode = mode ? CurveMode_Uniform : CurveMode_Sampled;
+			if (binary) {
+				SkeletonBinary loader(atlas);
+				loader.setCurveMode(curveMode);
+				skeletonData[mode] = loader.readSkeletonDataFile("testdata/spineboy/spineboy-pro.skel");
+			} else {
+				SkeletonJson loader(atlas);
+				loader.setCurveMode(curveMode);
+				skeletonData[mode] = loader.readSkeletonDataFile("testdata/spineboy/spineboy-pro.json");
+			}
+			assert(skeletonData[mode]);
+		}
+		size_t curves = countCurves(skeletonData[0], bezier);
+		assert(curves > 0 && countCurves(skeletonData[0], bezierUniform) == 0);
+		size_t uniformCurves = countCurves(skeletonData[1], bezierUniform);
+		SP_UNUSED(curves);
+		SP_UNUSED(uniformCurves);
+		assert(uniformCurves > curves / 2 && uniformCurves + countCurves(skeletonData[1], bezier) == curves);
+		delete skeletonData[0];
+		delete skeletonData[1];
+	}
+	delete atlas;
+}
+
+void testUpdateCache() {
+	const char *skeletons[][2] = {
+			{"testdata/mix-and-match/mix-and-match-pro.skel", "testdata/mix-and-match/mix-and-match.atlas"},
+			{"testdata/hero/hero-pro.json", "testdata/hero/hero.atlas"},
+			{"testdata/tank/tank-pro.skel", "testdata/tank/tank.atlas"},
+			{"testdata/stretchyman/stretchyman-pro.skel", "testdata/stretchyman/stretchyman.atlas"},
+			{"testdata/raptor/raptor-pro.skel", "testdata/raptor/raptor.atlas"}
+	};
+	for (size_t i = 0; i < sizeof(skeletons) / sizeof(skeletons[0]); i++) {
+		// The reference data sorts every time, the other caches update orders and replaces them when full.
+		Atlas *atlas = new(__FILE__, __LINE__) Atlas(skeletons[i][1], NULL);
+		SkeletonBinary binary(atlas);
+		SkeletonJson json(atlas);
+		bool isJson = strstr(skeletons[i][0], ".json") != NULL;
+		SkeletonData *skeletonData = isJson ? json.readSkeletonDataFile(skeletons[i][0]) : binary.readSkeletonDataFile(skeletons[i][0]);
+		SkeletonData *referenceData = isJson ? json.readSkeletonDataFile(skeletons[i][0]) : binary.readSkeletonDataFile(skeletons[i][0]);
+		assert(skeletonData && referenceData);
+		skeletonData->setMaxUpdateOrders(8);
+		referenceData->setMaxUpdateOrders(0);
+		requireSkinBones(skeletonData);
+		requireSkinBones(referenceData);
+		Skeleton *skeleton = new(__FILE__, __LINE__) Skeleton(skeletonData);
+		Skeleton *reference = new(__FILE__, __LINE__) Skeleton(referenceData);
+		assertSameUpdateCache(*reference, *skeleton);
+
+		// Combined skins activate the union of their bones and constraints.
+		Vector<Skin *> &skins = skeletonData->getSkins(), &referenceSkins = referenceData->getSkins();
+		Skin *combined = new(__FILE__, __LINE__) Skin("combined");
+		Skin *referenceCombined = new(__FILE__, __LINE__) Skin("combined");
+		for (size_t ii = 0; ii < skins.size(); ii += 3) {
+			combined->addSkin(skins[ii]);
+			referenceCombined->addSkin(referenceSkins[ii]);
+		}
+
+		unsigned int random = 1;
+		for (int swap = 0; swap < 500; swap++) {
+			random = random * 1103515245 + 12345;
+			size_t index = (random >> 16) % (skins.size() + 2);
+			if (index == skins.size()) {
+				skeleton->setSkin(combined);
+				reference->setSkin(referenceCombined);
+			} else if (index == skins.size() + 1) {
+				skeleton->setSkin((Skin *) NULL);
+				reference->setSkin((Skin *) NULL);
+			} else {
+				skeleton->setSkin(skins[index]);
+				reference->setSkin(referenceSkins[index]);
+			}
+			assertSameUpdateCache(*reference, *skeleton);
+		}
+
+		// Skin constraints are only active with their skin.
+		TransformConstraint *hatControl = skeleton->findTransformConstraint("hat-control");
+		Skin *girl = skeletonData->findSkin("full-skins/girl");
+		if (hatControl && girl) {
+			skeleton->setSkin(girl);
+			assert(hatControl->isActive() && skeleton->getUpdateCacheList().contains(hatControl));
+			skeleton->setSkin((Skin *) NULL);
+			assert(!hatControl->isActive() && !skeleton->getUpdateCacheList().contains(hatControl));
+			skeleton->setSkin(girl);
+			assert(hatControl->isActive() && skeleton->getUpdateCacheList().contains(hatControl));
+		}
+
+		// Skin changes are part of the cache key.
+		if (skins.size() > 1) {
+			skeleton->setSkin(combined);
+			reference->setSkin(referenceCombined);
+			combined->addSkin(skins[1]);
+			referenceCombined->addSkin(referenceSkins[1]);
+			skeleton->updateCache();
+			reference->updateCache();
+			assertSameUpdateCache(*reference, *skeleton);
+		}
+
+		delete skeleton;
+		delete reference;
+		delete combined;
+		delete referenceCombined;
+		delete skeletonData;
+		delete referenceData;
+		delete atlas;
+	}
+
+	// Adding or removing constraints after loading rebuilds the constraint order.
+	Atlas *atlas = new(__FILE__, __LINE__) Atlas("testdata/spineboy/spineboy.atlas", NULL);
+	SkeletonBinary binary(atlas);
+	SkeletonData *skeletonData = binary.readSkeletonDataFile("testdata/spineboy/spineboy-pro.skel");
+	assert(skeletonData);
+	Skeleton *skeleton = new(__FILE__, __LINE__) Skeleton(skeletonData);
+	size_t updateCacheSize = skeleton->getUpdateCacheList().size();
+	SP_UNUSED(updateCacheSize);
+	delete skeleton;
+
+	Vector<IkConstraintData *> &ikConstraints = skeletonData->getIkConstraints();
+	IkConstraintData *removed = ikConstraints[ikConstraints.size() - 1];
+	ikConstraints.removeAt(ikConstraints.size() - 1);
+	skeleton = new(__FILE__, __LINE__) Skeleton(skeletonData);
+	assert(skeleton->getUpdateCacheList().size() == updateCacheSize - 1);
+
+	// A skeleton created before a constraint was added keeps sorting its own constraints.
+	ikConstraints.add(removed);
+	skeleton->updateCache();
+	assert(skeleton->getUpdateCacheList().size() == updateCacheSize - 1);
+	delete skeleton;
+
+	skeleton = new(__FILE__, __LINE__) Skeleton(skeletonData);
+	assert(skeleton->getUpdateCacheList().size() == updateCacheSize);
+	assert(skeleton->getUpdateCacheList().contains(skeleton->getIkConstraints()[ikConstraints.size() - 1]));
+
+	// A retargeted constraint does not get the order cached for another skeleton of the same data.
+	SkeletonData *referenceData = binary.readSkeletonDataFile("testdata/spineboy/spineboy-pro.skel");
+	assert(referenceData);
+	referenceData->setMaxUpdateOrders(0);
+	Skeleton *retargeted = new(__FILE__, __LINE__) Skeleton(skeletonData);
+	Skeleton *reference = new(__FILE__, __LINE__) Skeleton(referenceData);
+	retargeted->findIkConstraint("aim-torso-ik")->setTarget(retargeted->findBone("hair4"));
+	reference->findIkConstraint("aim-torso-ik")->setTarget(reference->findBone("hair4"));
+	retargeted->updateCache();
+	reference->updateCache();
+	assertSameUpdateCache(*reference, *retargeted);
+	skeleton->updateCache();
+	assert(skeleton->getUpdateCacheList().size() == updateCacheSize);
+
+	delete retargeted;
+	delete reference;
+	delete referenceData;
+	delete skeleton;
+	delete skeletonData;
+	delete atlas;
+}
+
+/// Records the events raised by an AnimationState.
+class EventRecorder : public AnimationStateListenerObject {
+public:
+	struct Record {
+		Record(EventType inType = EventType_Start, int inTrackIndex = 0, Animation *inAnimation = NULL, Event *inEvent = NULL)
+			: type(inType), trackIndex(inTrackIndex), animation(inAnimation), event(inEvent) {}
+
+		EventType type;
+		int trackIndex;
+		Animation *animation;
+		Event *event;
+	};
+
+	virtual void callback(AnimationState *state, EventType type, TrackEntry *entry, Event *event) {
+		SP_UNUSED(state);
+		records.add(Record(type, entry->getTrackIndex(), entry->getAnimation(), event));
+	}
+
+	Vector<Record> records;
+};
+
+static void stepEvents(Skeleton *skeleton, AnimationState *state, int frame) {
+	// Switch animations regularly, so track entries are mixed out, disposed and obtained again.
+	SkeletonData *data = skeleton->getData();
+	if (frame % 120 == 0) state->setAnimation(0, data->getAnimations()[frame % 240 == 0 ? 8 : 10], true);
+	if (frame % 300 == 0) state->addAnimation(1, data->getAnimations()[7], false, 0);
+	state->update(1 / 60.0f);
+	state->apply(*skeleton);
+	skeleton->updateWorldTransform();
+}
+
+void testEventQueue() {
+	Atlas *atlas = NULL;
+	SkeletonData *skeletonData = NULL;
+	AnimationStateData *stateData = NULL;
+	Skeleton *skeleton = NULL, *batchSkeleton = NULL;
+	AnimationState *state = NULL, *batchState = NULL;
+	loadBinary("testdata/spineboy/spineboy-pro.skel", "testdata/spineboy/spineboy.atlas", atlas, skeletonData, stateData, skeleton, state);
+	batchSkeleton = new(__FILE__, __LINE__) Skeleton(skeletonData);
+	batchState = new(__FILE__, __LINE__) AnimationState(stateData);
+	batchState->setEventBatching(true);
+
+	EventRecorder recorder, batchRecorder;
+	state->setListener(&recorder);
+	recorder.records.ensureCapacity(20000);
+	batchRecorder.records.ensureCapacity(20000);
+
+	// The batch holds the same events in the same order as the listener receives them.
+	const int warmup = 3600, frames = 10000;
+	for (int frame = 0; frame < warmup; frame++) {
+		stepEvents(skeleton, state, frame);
+		stepEvents(batchSkeleton, batchState, frame);
+		Vector<EventQueueEntry> &batch = batchState->getEventBatch();
+		for (size_t i = 0; i < batch.size(); i++) {
+			EventQueueEntry &entry = batch[i];
+			batchRecorder.callback(batchState, entry._type, entry._entry, entry._event);
+		}
+		batchState->clearEventBatch();
+	}
+	assert(recorder.records.size() == batchRecorder.records.size());
+	size_t ends = 0, events = 0;
+	for (size_t i = 0; i < recorder.records.size(); i++) {
+		EventRecorder::Record &record = recorder.records[i], &batchRecord = batchRecorder.records[i];
+		SP_UNUSED(batchRecord);
+		assert(record.type == batchRecord.type);
+		assert(record.trackIndex == batchRecord.trackIndex);
+		assert(record.animation == batchRecord.animation);
+		assert(record.event == batchRecord.event);
+		if (record.type == EventType_End) ends++;
+		if (record.type == EventType_Event) events++;
+	}
+	assert(ends > 0 && events > 0);
+
+	// Once the pooled track entries and the queue have grown to their largest size, looping and switching animations
+	// does not allocate.
+	SpineExtension *extension = SpineExtension::getInstance();
+	DebugExtension counter(extension);
+	SpineExtension::setInstance(&counter);
+	size_t recorded = recorder.records.size();
+	SP_UNUSED(recorded);
+	for (int frame = warmup; frame < warmup + frames; frame++) {
+		stepEvents(skeleton, state, frame);
+		stepEvents(batchSkeleton, batchState, frame);
+		batchState->clearEventBatch();
+	}
+	SpineExtension::setInstance(extension);
+	assert(counter.getAllocations() == 0);
+	assert(counter.getReallocations() == 0);
+	assert(counter.getFrees() == 0);
+	assert(recorder.records.size() > recorded);
+
+	state->setListener((AnimationStateListenerObject *) NULL);
+	delete batchState;
+	delete batchSkeleton;
+	dispose(atlas, skeletonData, stateData, skeleton, state);
+}
+
+void testProfilingExtension() {
+	SpineExtension *extension = SpineExtension::getInstance();
+	ProfilingSpineExtension profiler(extension);
+	SpineExtension::setInstance(&profiler);
+
+	Atlas *atlas = NULL;
+	SkeletonData *skeletonData = NULL;
+	AnimationStateData *stateData = NULL;
+	Skeleton *skeleton = NULL;
+	AnimationState *state = NULL;
+	loadBinary("testdata/spineboy/spineboy-pro.skel", "testdata/spineboy/spineboy.atlas", atlas, skeletonData, stateData, skeleton, state);
+	assert(profiler.getCallSiteCount() > 0);
+	assert(profiler.getLiveAllocations() > 0);
+	assert(profiler.getPeakLiveBytes() >= profiler.getLiveBytes());
+
+	// Allocations are attributed to their call site.
+	int line = __LINE__ + 1;
+	float *first = SpineExtension::alloc<float>(16, __FILE__, line), *second = SpineExtension::alloc<float>(16, __FILE__, line);
+	SpineExtension::free(first, __FILE__, __LINE__);
+	const ProfilingSpineExtension::CallSite *site = NULL;
+	SP_UNUSED(site);
+	for (size_t i = 0; i < profiler.getCallSiteCount(); i++) {
+		const ProfilingSpineExtension::CallSite &callSite = profiler.getCallSite(i);
+		if (callSite.line == line && strcmp(callSite.file, __FILE__) == 0) site = &callSite;
+	}
+	assert(site && site->allocations == 2 && site->frees == 1);
+	assert(site->liveAllocations == 1 && site->liveBytes == 16 * sizeof(float) && site->peakLiveBytes == 32 * sizeof(float));
+	SpineExtension::free(second, __FILE__, __LINE__);
+
+	// Steady state frames stay within a budget of no allocations.
+	state->setAnimation(0, "run", true);
+	for (int i = 0; i < 60; i++) {
+		state->update(1 / 60.0f);
+		state->apply(*skeleton);
+		skeleton->updateWorldTransform();
+	}
+	profiler.reset();
+	profiler.setFrameAllocationBudget(0);
+	profiler.setTimersEnabled(true);
+	for (int i = 0; i < 100; i++) {
+		profiler.beginFrame();
+		state->update(1 / 60.0f);
+		state->apply(*skeleton);
+		skeleton->updateWorldTransform();
+		profiler.endFrame();
+	}
+	assert(profiler.getFrameCount() == 100);
+	assert(profiler.getMaxFrameAllocations() == 0);
+	assert(profiler.getFramesOverBudget() == 0);
+	profiler.beginFrame();
+	SpineExtension::free(SpineExtension::alloc<float>(4, __FILE__, __LINE__), __FILE__, __LINE__);
+	profiler.endFrame();
+	assert(profiler.getFramesOverBudget() == 1);
+
+	{
+		ProfileScope scope("scope");
+	}
+	const ProfilingSpineExtension::Timer *timer = NULL;
+	SP_UNUSED(timer);
+	for (size_t i = 0; i < profiler.getTimerCount(); i++)
+		if (strcmp(profiler.getTimer(i).name, "scope") == 0) timer = &profiler.getTimer(i);
+	assert(timer && timer->count == 1 && timer->min >= 0 && timer->max == timer->total);
+	FILE *file = tmpfile();
+	profiler.writeJson(file);
+	profiler.writeChromeTrace(file);
+	assert(ftell(file) > 0);
+	fclose(file);
+	profiler.setTimersEnabled(false);
+	assert(ProfilingSpineExtension::getTimerExtension() == NULL);
+
+	dispose(atlas, skeletonData, stateData, skeleton, state);
+	assert(profiler.getLiveAllocations() == 0);
+	assert(profiler.getLiveBytes() == 0);
+	assert(profiler.getUntrackedFrees() == 0);
+	SpineExtension::setInstance(extension);
+}
+
+/// Appends the world vertices of the region and mesh attachments, clipped like a renderer clips them.
+static void collectWorldVertices(Skeleton &skeleton, SkeletonClipping &clipper, Vector<float> &outPositions, size_t &outIndexCount) {
+	Vector<float> worldVertices;
+	Vector<unsigned short> quadIndices;
+	quadIndices.add(0);
+	quadIndices.add(1);
+	quadIndices.add(2);
+	quadIndices.add(2);
+	quadIndices.add(3);
+	quadIndices.add(0);
+	Vector<Slot *> &drawOrder = skeleton.getDrawOrder();
+	for (size_t i = 0; i < drawOrder.size(); i++) {
+		Slot &slot = *drawOrder[i];
+		Attachment *attachment = slot.getAttachment();
+		if (!attachment || slot.getColor().a == 0 || !slot.getBone().isActive()) {
+			clipper.clipEnd(slot);
+			continue;
+		}
+		Vector<float> *uvs;
+		Vector<unsigned short> *indices;
+		if (attachment->getRTTI().isExactly(RegionAttachment::rtti)) {
+			RegionAttachment *region = static_cast<RegionAttachment *>(attachment);
+			worldVertices.setSize(8, 0);
+			region->computeWorldVertices(slot.getBone(), worldVertices, 0, 2);
+			uvs = &region->getUVs();
+			indices = &quadIndices;
+		} else if (attachment->getRTTI().isExactly(MeshAttachment::rtti)) {
+			MeshAttachment *mesh = static_cast<MeshAttachment *>(attachment);
+			worldVertices.setSize(mesh->getWorldVerticesLength(), 0);
+			mesh->computeWorldVertices(slot, 0, mesh->getWorldVerticesLength(), worldVertices, 0, 2);
+			uvs = &mesh->getUVs();
+			indices = &mesh->getTriangles();
+		} else {
+			if (attachment->getRTTI().isExactly(ClippingAttachment::rtti))
+				clipper.clipStart(slot, static_cast<ClippingAttachment *>(attachment));
+			else
+				clipper.clipEnd(slot);
+			continue;
+		}
+		if (clipper.isClipping()) {
+			clipper.clipTriangles(worldVertices, *indices, *uvs, 2);
+			for (size_t ii = 0; ii < clipper.getClippedVertices().size(); ii++)
+				outPositions.add(clipper.getClippedVertices()[ii]);
+			outIndexCount += clipper.getClippedTriangles().size();
+		} else {
+			for (size_t ii = 0; ii < worldVertices.size(); ii++)
+				outPositions.add(worldVertices[ii]);
+			outIndexCount += indices->size();
+		}
+		clipper.clipEnd(slot);
+	}
+	clipper.clipEnd();
+}
+
+void testRenderCommandBuilder() {
+	Atlas *atlas = new(__FILE__, __LINE__) Atlas("testdata/spineboy/spineboy.atlas", NULL);
+	SkeletonBinary binary(atlas);
+	SkeletonData *skeletonData = binary.readSkeletonDataFile("testdata/spineboy/spineboy-pro.skel");
+	assert(skeletonData);
+	Skeleton *skeleton = new(__FILE__, __LINE__) Skeleton(skeletonData);
+	Animation *portal = skeletonData->findAnimation("portal");
+	RenderCommandBuilder builder;
+	builder.setUseTwoColorTint(true);
+	SkeletonClipping clipper;
+
+	// The commands hold the same vertices as computing and clipping each attachment separately, in draw order.
+	for (int frame = 0; frame < 2; frame++) {
+		portal->apply(*skeleton, 0, frame * 1.5f, false, NULL, 1, MixBlend_Setup, MixDirection_In);
+		skeleton->updateWorldTransform();
+		builder.clear();
+		builder.add(*skeleton);
+
+		Vector<float> expectedPositions;
+		size_t expectedIndexCount = 0;
+		collectWorldVertices(*skeleton, clipper, expectedPositions, expectedIndexCount);
+		Vector<float> &positions = builder.getPositions();
+		assert(positions.size() == expectedPositions.size());
+		for (size_t i = 0; i < positions.size(); i++)
+			assert(positions[i] == expectedPositions[i]);
+		assert(builder.getIndices().size() == expectedIndexCount);
+		assert(builder.getUVs().size() == positions.size());
+		assert(builder.getColors().size() == builder.getVertexCount());
+		assert(builder.getDarkColors().size() == builder.getVertexCount());
+
+		// Commands are contiguous, their indices stay inside their vertices, and consecutive commands differ.
+		Vector<DrawCommand> &commands = builder.getCommands();
+		assert(commands.size() > 0);
+		size_t vertex = 0, index = 0;
+		for (size_t i = 0; i < commands.size(); i++) {
+			DrawCommand &command = commands[i];
+			assert(command.firstVertex == vertex && command.firstIndex == index);
+			for (size_t ii = command.firstIndex; ii < command.firstIndex + command.indexCount; ii++)
+				assert(builder.getIndices()[ii] < command.vertexCount);
+			if (i > 0) assert(command.texture != commands[i - 1].texture || command.blendMode != commands[i - 1].blendMode);
+			vertex += command.vertexCount;
+			index += command.indexCount;
+		}
+		assert(vertex == builder.getVertexCount() && index == builder.getIndices().size());
+	}
+
+	// Once the buffers have grown to the largest frame, building commands does not allocate.
+	for (float time = 0; time < portal->getDuration(); time += 1 / 60.0f) {
+		portal->apply(*skeleton, 0, time, false, NULL, 1, MixBlend_Setup, MixDirection_In);
+		skeleton->updateWorldTransform();
+		builder.clear();
+		builder.add(*skeleton);
+	}
+	SpineExtension *extension = SpineExtension::getInstance();
+	DebugExtension counter(extension);
+	SpineExtension::setInstance(&counter);
+	for (float time = 0; time < portal->getDuration(); time += 1 / 60.0f) {
+		portal->apply(*skeleton, 0, time, false, NULL, 1, MixBlend_Setup, MixDirection_In);
+		skeleton->updateWorldTransform();
+		builder.clear();
+		builder.add(*skeleton);
+	}
+	SpineExtension::setInstance(extension);
+	assert(counter.getAllocations() == 0);
+	assert(counter.getReallocations() == 0);
+
+	delete skeleton;
+	delete skeletonData;
+	delete atlas;
+}
+
+size_t countPixels(RasterImage &image, int red) {
+	size_t count = 0;
+	for (int i = 0, n = image.getWidth() * image.getHeight(); i < n; i++)
+		if (image.getPixels()[i * 4] == red) count++;
+	return count;
+}
+
+void testRasterizer() {
+	// A 10x10 region whose quad covers pixels 5 to 14 exactly. Each pixel center is covered by one of its two triangles.
+	const char *atlasData = "\nwhite.png\nsize: 16,16\nformat: RGBA8888\nfilter: Nearest,Nearest\nrepeat: none\n"
+							"white\n  rotate: false\n  xy: 0, 0\n  size: 10, 10\n  orig: 10, 10\n  offset: 0, 0\n  index: -1\n";
+	const char *skeletonJson = "{\"bones\": [{\"name\": \"root\"}], \"slots\": [{\"name\": \"slot\", \"bone\": \"root\", "
+							   "\"attachment\": \"white\", \"color\": \"ffffff80\"}], \"skins\": [{\"name\": \"default\", "
+							   "\"attachments\": {\"slot\": {\"white\": {\"width\": 10, \"height\": 10}}}}]}";
+	RasterTextureLoader textureLoader;
+	Atlas *atlas = new(__FILE__, __LINE__) Atlas(atlasData, (int) strlen(atlasData), "", &textureLoader);
+	SkeletonJson json(atlas);
+	SkeletonData *skeletonData = json.readSkeletonData(skeletonJson);
+	assert(skeletonData);
+	Skeleton *skeleton = new(__FILE__, __LINE__) Skeleton(skeletonData);
+	skeleton->updateWorldTransform();
+
+	RasterImage image(20, 20);
+	image.clear(Color(0, 0, 0, 1));
+	SkeletonRasterizer rasterizer;
+	rasterizer.setTransform(1, 1, 10, 10);
+	rasterizer.draw(*skeleton, image);
+	assert(rasterizer.getBuilder().getCommands().size() == 1);
+	assert(rasterizer.getBuilder().getVertexCount() == 4 && rasterizer.getBuilder().getTriangleCount() == 2);
+	assert(countPixels(image, 128) == 100);
+	assert(countPixels(image, 0) == 300);
+	for (int y = 5; y < 15; y++)
+		for (int x = 5; x < 15; x++)
+			assert(image.getPixels()[(y * 20 + x) * 4] == 128 && image.getPixels()[(y * 20 + x) * 4 + 3] == 255);
+	delete skeleton;
+	delete skeletonData;
+	delete atlas;
+
+	// The output does not depend on the number of threads.
+	atlas = new(__FILE__, __LINE__) Atlas("testdata/spineboy/spineboy.atlas", &textureLoader);
+	SkeletonBinary binary(atlas);
+	skeletonData = binary.readSkeletonDataFile("testdata/spineboy/spineboy-pro.skel");
+	assert(skeletonData);
+	skeleton = new(__FILE__, __LINE__) Skeleton(skeletonData);
+	skeletonData->findAnimation("portal")->apply(*skeleton, 1.5f, 1.5f, false, NULL, 1, MixBlend_Setup, MixDirection_In);
+	skeleton->updateWorldTransform();
+	float x, y, width, height;
+	Vector<float> vertices;
+	skeleton->getBounds(x, y, width, height, vertices);
+
+	RasterImage single(160, 120), threaded(160, 120);
+	SkeletonRasterizer threadedRasterizer(3);
+	rasterizer.fit(x, y, width, height, 160, 120, 4);
+	threadedRasterizer.fit(x, y, width, height, 160, 120, 4);
+	rasterizer.draw(*skeleton, single);
+	threadedRasterizer.draw(*skeleton, threaded);
+	size_t indexCount = 0;
+	for (size_t i = 0; i < rasterizer.getBuilder().getCommands().size(); i++)
+		indexCount += rasterizer.getBuilder().getCommands()[i].indexCount;
+	assert(indexCount == rasterizer.getBuilder().getIndices().size());
+	assert(rasterizer.getBuilder().getVertexCount() > 0);
+	assert(memcmp(single.getPixels(), threaded.getPixels(), 160 * 120 * 4) == 0);
+	assert(countPixels(single, 0) < 160 * 120);
+
+	delete skeleton;
+	delete skeletonData;
+	delete atlas;
+}
+
 namespace spine {
 	SpineExtension* getDefaultExtension() {
 		return new DefaultSpineExtension();
@@ -100,10 +2070,39 @@ namespace spine {
 }
 
 int main(int argc, char **argv) {
-	DebugExtension debug(SpineExtension::getInstance());
+	SP_UNUSED(argc);
+	SP_UNUSED(argv);
+	SpineExtension *previous = SpineExtension::getInstance();
+	DebugExtension debug(previous);
 	SpineExtension::setInstance(&debug);
 
+	testHashMap();
+	testTrig();
+	testPoseBuffer();
+	testComputeWorldVertices();
+	testBatchUpdater();
+	testArena();
+	testLoadInPlace();
+	testBakedAnimation();
+	testAnimationCompression();
+	testDeformAlias();
+	testSkeletonInstance();
+	testSkeletonSnapshot();
+	testAttachmentHandles();
+	testNameIndex();
+	testClipping();
+	testPathConstraintCache();
+	testCurveModes();
+	testUpdateCache();
+	testEventQueue();
+	testProfilingExtension();
+	testRenderCommandBuilder();
+	testRasterizer();
 	testLoading();
 
 	debug.reportLeaks();
+
+	// Static destructors run after main() returns and still free through the extension.
+	SpineExtension::setInstance(previous);
+	return 0;
 }
@@ -40,10 +40,14 @@
 namespace spine {
 class Timeline;
 
+class BakedAnimation;
+
 class Skeleton;
 
 class Event;
 
+class Arena;
+
 class SP_API Animation : public SpineObject {
 	friend class AnimationState;
 
@@ -53,6 +57,8 @@ class SP_API Animation : public SpineObject {
 
 	friend class AttachmentTimeline;
 
+	friend class BakedAnimation;
+
 	friend class ColorTimeline;
 
 	friend class DeformTimeline;
@@ -101,17 +107,53 @@ public:
 
 	void setDuration(float inValue);
 
+	/// Packs the bone timelines into contiguous streams and enables per track entry keyframe cursors in AnimationState, so
+	/// playback moving forward finds keyframes without a binary search. Timeline keyframes are copied, call again after
+	/// changing them. Not thread safe, bake after loading and before the animation is applied.
+	void bake();
+
+	/// Returns the baked form of this animation, or NULL if bake() was not called.
+	BakedAnimation *getBaked();
+
+	/// Stores the curve timelines in less memory, decoding keyframes as they are applied. Curves are stored once for the
+	/// animation and referenced by a 16 bit index per keyframe. Keyframe times are shared by timelines with the same times.
+	/// The values of rotate, translate, scale and shear timelines are quantized to 16 bits, see QuantizedFrames, so a value
+	/// differs from the original by at most 1/131068 of the range the value has in its timeline, see
+	/// getCompressionError(). Deform keyframes store only the vertices that differ from the setup pose and are exact.
+	///
+	/// Timelines can't be changed afterward and their getFrames(), getVertices() and getCurves() are empty. Compressed
+	/// timelines are not baked, see bake(). Not thread safe, compress after loading and before the animation is applied.
+	/// If the animation was loaded into an Arena, the memory of the original keyframes is reclaimed only with the arena.
+	void compress();
 
+	bool isCompressed();
+
+	/// The largest difference of a quantized value from its original value, or 0 if compress() was not called.
+	float getCompressionError();
 
 private:
 	Vector<Timeline *> _timelines;
 	HashMap<int, bool> _timelineIds;
 	float _duration;
 	String _name;
+	BakedAnimation *_baked;
+	bool _compressed;
+	float _compressionError;
+	Vector<float> _compressedTimes;
+	Vector<float> _compressedCurves;
+	Arena *_arena; // The arena current when the animation was created, which owns its keyframes, or NULL.
 
 	/// @param target After the first and before the last entry.
 	static int binarySearch(Vector<float> &values, float target, int step);
 
+	/// @param target After the first and before the last entry.
+	static int binarySearch(const float *values, int size, float target, int step);
+
+	/// Returns the same entry as binarySearch. If cursor is not NULL it holds the entry returned by the previous search
+	/// and is checked first, followed by the next few entries, before falling back to a binary search.
+	/// @param target After the first and before the last entry.
+	static int search(const float *values, int size, float target, int step, int *cursor);
+
 	/// @param target After the first and before the last entry.
 	static int binarySearch(Vector<float> &values, float target);
 
@@ -56,6 +56,7 @@ namespace spine {
 	class TrackEntry;
 
 	class Animation;
+	class BakedAnimation;
 	class Event;
 	class AnimationStateData;
 	class Skeleton;
@@ -82,6 +83,7 @@ namespace spine {
 	class SP_API TrackEntry : public SpineObject, public HasRendererObject {
 		friend class EventQueue;
 		friend class AnimationState;
+		friend class SkeletonSnapshot;
 
 	public:
 		TrackEntry();
@@ -249,10 +251,14 @@ namespace spine {
 		Vector<int> _timelineMode;
 		Vector<TrackEntry*> _timelineHoldMix;
 		Vector<float> _timelinesRotation;
+		Vector<int> _timelineCursors;
 		AnimationStateListener _listener;
 		AnimationStateListenerObject* _listenerObject;
 
 		void reset();
+
+		/// Returns the baked form of the animation with the keyframe cursors sized for it, or NULL if it isn't baked.
+		BakedAnimation* getBaked();
 	};
 
 	class SP_API EventQueueEntry : public SpineObject {
@@ -263,17 +269,22 @@ namespace spine {
 		TrackEntry* _entry;
 		Event* _event;
 
-		EventQueueEntry(EventType eventType, TrackEntry* trackEntry, Event* event = NULL);
+		EventQueueEntry(EventType eventType = EventType_Start, TrackEntry* trackEntry = NULL, Event* event = NULL);
 	};
 
 	class SP_API EventQueue : public SpineObject {
 		friend class AnimationState;
+		friend class SkeletonBatchUpdater;
 
 	private:
-		Vector<EventQueueEntry> _eventQueueEntries;
+		Vector<EventQueueEntry> _eventQueueEntries; // A ring buffer, its size is a power of 2.
+		size_t _head;
+		size_t _count;
 		AnimationState& _state;
 		Pool<TrackEntry>& _trackEntryPool;
 		bool _drainDisabled;
+		bool _batching;
+		Vector<EventQueueEntry> _batch;
 
 		static EventQueue* newEventQueue(AnimationState& state, Pool<TrackEntry>& trackEntryPool);
 
@@ -295,13 +306,19 @@ namespace spine {
 
 		void event(TrackEntry* entry, Event* event);
 
+		void add(EventType eventType, TrackEntry* entry, Event* event = NULL);
+
 		/// Raises all events in the queue and drains the queue.
 		void drain();
+
+		void clearBatch();
 	};
 
 	class SP_API AnimationState : public SpineObject, public HasRendererObject {
 		friend class TrackEntry;
 		friend class EventQueue;
+		friend class SkeletonBatchUpdater;
+		friend class SkeletonSnapshot;
 
 	public:
 		explicit AnimationState(AnimationStateData* data);
@@ -386,6 +403,20 @@ namespace spine {
 		void disableQueue();
 		void enableQueue();
 
+		/// When enabled, draining the event queue does not call the listeners. The events are appended to getEventBatch()
+		/// instead, so all events of a frame can be processed from one array after update() and apply(). An end event is
+		/// followed by a dispose event, as listeners receive them. Track entries that were disposed stay valid until
+		/// clearEventBatch() returns them to the pool. Disabling clears the batch.
+		void setEventBatching(bool enabled);
+
+		bool isEventBatching();
+
+		/// The events collected since the last clearEventBatch() while event batching is enabled.
+		Vector<EventQueueEntry>& getEventBatch();
+
+		/// Empties the event batch and returns the track entries disposed in it to the pool.
+		void clearEventBatch();
+
 	private:
 
 		AnimationStateData* _data;
@@ -407,7 +438,7 @@ namespace spine {
 
 		static Animation* getEmptyAnimation();
 
-		static void applyRotateTimeline(RotateTimeline* rotateTimeline, Skeleton& skeleton, float time, float alpha, MixBlend pose, Vector<float>& timelinesRotation, size_t i, bool firstFrame);
+		static void applyRotateTimeline(RotateTimeline* rotateTimeline, Skeleton& skeleton, float time, float alpha, MixBlend pose, Vector<float>& timelinesRotation, size_t i, bool firstFrame, int* cursor);
         void applyAttachmentTimeline(AttachmentTimeline* attachmentTimeline, Skeleton& skeleton, float animationTime, MixBlend pose, bool firstFrame);
 
 		/// Returns true when all mixing from entries are complete.
@@ -433,7 +464,7 @@ namespace spine {
 
 		void computeHold(TrackEntry *entry);
 
-        void setAttachment(Skeleton &skeleton, spine::Slot &slot, const String &attachmentName, bool attachments);
+        void setAttachment(Skeleton &skeleton, spine::Slot &slot, int attachmentHandle, const String &attachmentName, bool attachments);
     };
 }
 
@@ -0,0 +1,166 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifndef Spine_Arena_h
+#define Spine_Arena_h
+
+#include <spine/SpineObject.h>
+
+namespace spine {
+/// A linear allocator that hands out memory from large chunks and releases all of it at once when destroyed.
+///
+/// While an arena is current on a thread, all SpineExtension allocations and SpineObject instances created on that
+/// thread come from the arena. Freeing or reallocating memory the arena does not own is forwarded to the
+/// SpineExtension, so data allocated before the arena became current can still be used. Freeing arena memory only
+/// reclaims it if it was the most recent allocation, everything else is reclaimed when the arena is destroyed.
+///
+/// SkeletonBinary and SkeletonJson can load a SkeletonData into an arena, see SkeletonData::getArena().
+class SP_API Arena : public SpineObject {
+public:
+	/// @param chunkSize The size of the first chunk in bytes. Following chunks double in size up to 256 KB.
+	explicit Arena(size_t chunkSize = 16 * 1024);
+
+	~Arena();
+
+	void *alloc(size_t size);
+
+	void *calloc(size_t size);
+
+	void *realloc(void *ptr, size_t size);
+
+	void free(void *ptr);
+
+	/// Makes memory allocated elsewhere, e.g. a file buffer that loaded data points into, count as owned by this arena,
+	/// so freeing pointers into it is a no-op.
+	/// @param owned If true, the memory must have been allocated through the SpineExtension and is freed with the arena.
+	void addRegion(void *ptr, size_t size, bool owned);
+
+	/// Returns true if the memory was allocated from this arena or lies in one of its regions.
+	bool owns(const void *ptr) const;
+
+	/// The number of bytes handed out by this arena, including alignment padding and memory that was freed but not
+	/// reclaimed.
+	size_t getUsedBytes() const { return _usedBytes; }
+
+	/// The number of bytes allocated for chunks, including chunk headers.
+	size_t getReservedBytes() const { return _reservedBytes; }
+
+	/// The number of allocations served by this arena.
+	size_t getAllocationCount() const { return _allocationCount; }
+
+	/// The arena current on the calling thread, or NULL.
+	static Arena *getCurrent();
+
+	/// Sets the arena current on the calling thread. NULL makes allocations use the SpineExtension again.
+	static void setCurrent(Arena *arena);
+
+private:
+	struct Chunk {
+		Chunk *next;
+		size_t size;
+		size_t used;
+		size_t padding;
+
+		char *data() { return (char *) (this + 1); }
+	};
+
+	struct Region {
+		Region *next;
+		char *data;
+		size_t size;
+		bool owned;
+	};
+
+	Chunk *_chunks;
+	Region *_regions;
+	size_t _chunkSize;
+	void *_last;
+	size_t _usedBytes;
+	size_t _reservedBytes;
+	size_t _allocationCount;
+
+	Chunk *findChunk(const void *ptr) const;
+
+	Region *findRegion(const void *ptr) const;
+
+	Chunk *addChunk(size_t size);
+
+	Arena(const Arena &);
+
+	Arena &operator=(const Arena &);
+};
+
+/// Makes an arena current on the calling thread for the lifetime of the scope. A NULL arena makes allocations in
+/// the scope use the SpineExtension.
+class SP_API ArenaScope {
+public:
+	explicit ArenaScope(Arena *arena) : _previous(Arena::getCurrent()) {
+		Arena::setCurrent(arena);
+	}
+
+	~ArenaScope() {
+		Arena::setCurrent(_previous);
+	}
+
+private:
+	Arena *_previous;
+
+	ArenaScope(const ArenaScope &);
+
+	ArenaScope &operator=(const ArenaScope &);
+};
+
+/// Owns the arena an object's members were allocated from. Declared as the object's first member, it is destroyed
+/// after all other members, so the owner's destructor calls beginDestruction() to have its members freed into the
+/// arena, which is then released in one shot.
+class SP_API ArenaHolder {
+public:
+	ArenaHolder() : _arena(NULL), _previous(NULL) {
+	}
+
+	~ArenaHolder();
+
+	Arena *getArena() { return _arena; }
+
+	void setArena(Arena *arena) { _arena = arena; }
+
+	void beginDestruction();
+
+private:
+	Arena *_arena;
+	Arena *_previous;
+
+	ArenaHolder(const ArenaHolder &);
+
+	ArenaHolder &operator=(const ArenaHolder &);
+};
+}
+
+#endif /* Spine_Arena_h */
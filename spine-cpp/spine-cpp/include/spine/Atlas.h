@@ -35,6 +35,7 @@
 #include <spine/SpineObject.h>
 #include <spine/SpineString.h>
 #include <spine/HasRendererObject.h>
+#include <spine/NameIndex.h>
 
 namespace spine {
 enum Format {
@@ -96,6 +97,13 @@ public:
 	Vector<int> pads;
 };
 
+template<>
+struct SP_API NameOf<AtlasRegion> {
+	static const String &get(AtlasRegion *region) {
+		return region->name;
+	}
+};
+
 class TextureLoader;
 
 class SP_API Atlas : public SpineObject {
@@ -108,8 +116,8 @@ public:
 
 	void flipV();
 
-	/// Returns the first region found with the specified name. This method uses String comparison to find the region, so the result
-	/// should be cached rather than calling this method multiple times.
+	/// Returns the first region found with the specified name. Regions are found in constant time by a name index built
+	/// when the atlas is loaded. Regions added later are found by comparing names.
 	/// @return The region, or NULL.
 	AtlasRegion *findRegion(const String &name);
 
@@ -120,6 +128,7 @@ public:
 private:
 	Vector<AtlasPage *> _pages;
 	Vector<AtlasRegion *> _regions;
+	NameIndex _regionNames;
 	TextureLoader *_textureLoader;
 
 	void load(const char *begin, int length, const char *dir, bool createTexture);
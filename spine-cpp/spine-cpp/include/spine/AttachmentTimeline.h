@@ -46,6 +46,7 @@ namespace spine {
 	class SP_API AttachmentTimeline : public Timeline {
 		friend class SkeletonBinary;
 		friend class SkeletonJson;
+		friend class SkeletonData;
 
 		RTTI_DECL
 
@@ -63,13 +64,18 @@ namespace spine {
 		void setSlotIndex(size_t inValue);
 		Vector<float>& getFrames();
 		Vector<String>& getAttachmentNames();
+
+		/// The handle of each frame's attachment name, see SkeletonData::updateAttachmentHandles(), or -1 if it has not
+		/// been assigned since the frame was set.
+		Vector<int>& getAttachmentHandles();
 		size_t getFrameCount();
 	private:
 		size_t _slotIndex;
 		Vector<float> _frames;
 		Vector<String> _attachmentNames;
+		Vector<int> _attachmentHandles;
 
-        void setAttachment(Skeleton& skeleton, Slot& slot, String* attachmentName);
+        void setAttachment(Skeleton& skeleton, Slot& slot, int attachmentHandle, const String& attachmentName);
     };
 }
 
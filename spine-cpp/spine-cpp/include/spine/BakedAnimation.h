@@ -0,0 +1,122 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifndef Spine_BakedAnimation_h
+#define Spine_BakedAnimation_h
+
+#include <spine/Vector.h>
+#include <spine/MixBlend.h>
+#include <spine/MixDirection.h>
+#include <spine/SpineObject.h>
+
+namespace spine {
+class Animation;
+
+class Skeleton;
+
+class Timeline;
+
+class Event;
+
+class Bone;
+
+/// The baked form of an Animation, see Animation::bake().
+///
+/// The keyframes and curves of all rotate, translate, scale and shear timelines are packed into one contiguous stream per
+/// timeline type and applied without virtual dispatch. Keyframes are found through a cursor per timeline, stored by the caller
+/// (AnimationState keeps one set per TrackEntry), so playback moving forward finds the next keyframe in amortized constant
+/// time. Scrubbing backward or jumping ahead falls back to a binary search. The results are identical to applying the
+/// timelines of the animation.
+class SP_API BakedAnimation : public SpineObject {
+public:
+	explicit BakedAnimation(Animation &animation);
+
+	/// Same as Animation::apply(), using and updating the keyframe cursors. Cursors are indexed by timeline and are resized to
+	/// the number of timelines if needed.
+	void apply(Skeleton &skeleton, float lastTime, float time, bool loop, Vector<Event *> *pEvents, float alpha,
+		MixBlend blend, MixDirection direction, Vector<int> &cursors);
+
+	/// Applies the timeline at the index in Animation::getTimelines() from the streams, using and updating its keyframe
+	/// cursor.
+	/// @param cursors Must have a cursor for every timeline.
+	/// @return False if the timeline was not baked and has to be applied through Timeline::apply().
+	bool applyTimeline(size_t timelineIndex, Skeleton &skeleton, float time, float alpha, MixBlend blend,
+		MixDirection direction, Vector<int> &cursors);
+
+	Animation &getAnimation();
+
+	/// The number of timelines packed into the streams.
+	size_t getBakedTimelineCount();
+
+private:
+	typedef void (*ApplyFrames)(Bone &bone, const float *frames, int size, const float *curves, float time, float alpha,
+		MixBlend blend, MixDirection direction, int *cursor);
+
+	/// One timeline's range in a stream.
+	struct Entry {
+		int timeline;
+		int bone;
+		int frames;
+		int size;
+		int curves;
+
+		Entry() : timeline(0), bone(0), frames(0), size(0), curves(0) {}
+	};
+
+	struct Stream {
+		ApplyFrames applyFrames;
+		Vector<float> frames;
+		Vector<float> curves;
+		Vector<Entry> entries;
+	};
+
+	enum StreamType {
+		StreamType_Rotate = 0,
+		StreamType_Translate,
+		StreamType_Scale,
+		StreamType_Shear,
+		StreamType_Count
+	};
+
+	Animation &_animation;
+	Stream _streams[StreamType_Count];
+	Vector<int> _timelineStreams; // Stream type of each timeline, -1 if not baked.
+	Vector<int> _timelineEntries;
+	Vector<Timeline *> _unbaked;
+	size_t _bakedCount;
+
+	void add(StreamType type, size_t timelineIndex, int boneIndex, Vector<float> &frames, Vector<float> &curves);
+
+	void apply(Stream &stream, Entry &entry, Skeleton &skeleton, float time, float alpha, MixBlend blend,
+		MixDirection direction, Vector<int> &cursors);
+};
+}
+
+#endif /* Spine_BakedAnimation_h */
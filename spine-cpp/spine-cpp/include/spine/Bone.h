@@ -69,6 +69,10 @@ class SP_API Bone : public Updatable {
 
 	friend class TranslateTimeline;
 
+	friend class BonePoseBuffer;
+
+	friend class SkeletonSnapshot;
+
 RTTI_DECL
 
 public:
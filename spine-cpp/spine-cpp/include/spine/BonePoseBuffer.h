@@ -0,0 +1,105 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifndef Spine_BonePoseBuffer_h
+#define Spine_BonePoseBuffer_h
+
+#include <spine/Vector.h>
+#include <spine/SpineObject.h>
+
+namespace spine {
+class Skeleton;
+
+class Bone;
+
+/// Optional structure-of-arrays storage for the bone poses of a Skeleton, see Skeleton::setPoseBufferEnabled().
+///
+/// Every bone entry of the skeleton's update cache that can be solved without virtual dispatch gets a slot in the buffer, in
+/// update order. Consecutive slots form runs: bones with TransformMode_Normal (or no parent) that have no constraint between them.
+/// Skeleton::updateWorldTransform() solves each run in one pass over contiguous arrays, reading parent world transforms from the
+/// buffer where the parent was solved earlier in the same run, and writes the results back to the Bone objects so all Bone
+/// accessors stay valid. Everything else in the update cache is updated as usual.
+class SP_API BonePoseBuffer : public SpineObject {
+public:
+	BonePoseBuffer();
+
+	/// Rebuilds the slot layout and runs from the skeleton's update cache. Called by Skeleton::updateCache().
+	void build(Skeleton &skeleton);
+
+	/// Updates every entry of the skeleton's update cache, solving the runs in batches.
+	void updateWorldTransform(Skeleton &skeleton);
+
+	/// The number of bone slots, which is the number of bones solved in batches.
+	size_t size();
+
+	/// The number of runs the update cache was split into.
+	size_t getRunCount();
+
+	/// The bone of each slot, in update order.
+	Vector<Bone *> &getBones();
+
+	Vector<float> &getA();
+
+	Vector<float> &getB();
+
+	Vector<float> &getC();
+
+	Vector<float> &getD();
+
+	Vector<float> &getWorldX();
+
+	Vector<float> &getWorldY();
+
+private:
+	/// Consecutive update cache entries [start, end) that are stored in slots starting at slot.
+	struct Run {
+		size_t start;
+		size_t end;
+		size_t slot;
+
+		Run(size_t inStart = 0, size_t inEnd = 0, size_t inSlot = 0) : start(inStart), end(inEnd), slot(inSlot) {}
+	};
+
+	/// Values of _parents for bones whose parent is not solved earlier in the same run, and for root bones.
+	static const int ParentExternal = -1;
+	static const int ParentNone = -2;
+
+	Vector<Run> _runs;
+	Vector<Bone *> _bones;
+	Vector<int> _parents;
+	Vector<float> _x, _y, _rotation, _scaleX, _scaleY, _shearX, _shearY;
+	Vector<float> _a, _b, _c, _d, _worldX, _worldY;
+	Vector<int> _slotOfBone;
+
+	void solve(Skeleton &skeleton, const Run &run);
+};
+}
+
+#endif /* Spine_BonePoseBuffer_h */
@@ -51,8 +51,22 @@ namespace spine {
 
 		virtual Attachment* copy();
 
+		/// Decomposes the clipping polygon into convex polygons in the attachment's local space, so SkeletonClipping only has
+		/// to transform them while the attachment is unweighted and the slot has no deform. Called by SkeletonBinary and
+		/// SkeletonJson; call again after changing the vertices.
+		void updateConvexPolygons();
+
+		/// The clockwise convex polygons of an unweighted clipping polygon in local space, or empty.
+		/// See getConvexPolygonSizes().
+		Vector<float>& getConvexPolygons();
+
+		/// The number of floats of each polygon in getConvexPolygons().
+		Vector<int>& getConvexPolygonSizes();
+
 	private:
 		SlotData* _endSlot;
+		Vector<float> _convexPolygons;
+		Vector<int> _convexPolygonSizes;
 	};
 }
 
@@ -33,6 +33,7 @@
 #include <spine/Extension.h>
 #include <spine/Vector.h>
 #include <spine/HashMap.h>
+#include <spine/NameIndex.h>
 #include <spine/SpineObject.h>
 #include <spine/SpineString.h>
 
@@ -73,6 +74,24 @@ namespace spine {
 			return -1;
 		}
 
+		/// Finds an item by name using a NameIndex of the items.
+		/// @return May be NULL.
+		template<typename T>
+		static T* findWithName(Vector<T*>& items, NameIndex& index, const String& name) {
+			assert(name.length() > 0);
+
+			int i = index.find(items, name);
+			return i == -1 ? NULL : items[i];
+		}
+
+		/// @return -1 if the item was not found.
+		template<typename T>
+		static int findIndexWithName(Vector<T*>& items, NameIndex& index, const String& name) {
+			assert(name.length() > 0);
+
+			return index.find(items, name);
+		}
+
 		/// Finds an item by comparing each item's name.
 		/// It is more efficient to cache the results of this method than to call it multiple times.
 		/// @return May be NULL.
@@ -30,12 +30,15 @@
 #ifndef Spine_CurveTimeline_h
 #define Spine_CurveTimeline_h
 
+#include <spine/CurveMode.h>
 #include <spine/Timeline.h>
 #include <spine/Vector.h>
 
 namespace spine {
 	/// Base class for frames that use an interpolation bezier curve.
 	class SP_API CurveTimeline : public Timeline {
+		friend class Animation;
+
 		RTTI_DECL
 
 	public:
@@ -55,21 +58,39 @@ namespace spine {
 
 		/// Sets the control handle positions for an interpolation bezier curve used to transition from this keyframe to the next.
 		/// cx1 and cx2 are from 0 to 1, representing the percent of time between the two keyframes. cy1 and cy2 are the percent of
-		/// the difference between the keyframe's values.
-		void setCurve(size_t frameIndex, float cx1, float cy1, float cx2, float cy2);
+		/// the difference between the keyframe's values. The mode decides how the curve is stored, see CurveMode.
+		void setCurve(size_t frameIndex, float cx1, float cy1, float cx2, float cy2, CurveMode mode = CurveMode_Sampled);
 
 		float getCurvePercent(size_t frameIndex, float percent);
 
+		/// Same as getCurvePercent(size_t, float) for curves stored elsewhere, such as the streams of a BakedAnimation.
+		static float getCurvePercent(const float *curves, size_t frameIndex, float percent);
+
+		/// Returns the y of the bezier curve at the given x, solving the cubic for x. Slower than getCurvePercent, but exact.
+		static float getBezierPercent(float cx1, float cy1, float cx2, float cy2, float percent);
+
 		float getCurveType(size_t frameIndex);
 
+		/// The curves of all keyframes, BEZIER_SIZE values each. Empty after Animation::compress().
+		Vector<float> &getCurves();
+
+		/// True if Animation::compress() moved the curves of this timeline into the animation's shared curves.
+		bool isCompressed() { return _curvePool != NULL; }
+
 	protected:
 		static const float LINEAR;
 		static const float STEPPED;
 		static const float BEZIER;
+		static const float BEZIER_UNIFORM;
 		static const int BEZIER_SIZE;
 
+		/// Returns the BEZIER_SIZE values of the keyframe's curve, starting with its type.
+		const float *getCurve(size_t frameIndex);
+
 	private:
 		Vector<float> _curves; // type, x, y, ...
+		Vector<unsigned short> _curveIndices; // Index of each keyframe's curve in _curvePool when compressed.
+		const float *_curvePool;
 	};
 }
 
@@ -31,6 +31,7 @@
 #define SPINE_DEBUG_H
 
 #include <spine/Extension.h>
+#include <spine/Threading.h>
 
 #include <map>
 
@@ -54,6 +55,7 @@ public:
 	}
 
 	void reportLeaks() {
+		MutexLock lock(_mutex);
 		for (std::map<void*, Allocation>::iterator it = _allocated.begin(); it != _allocated.end(); it++) {
 			printf("\"%s:%i (%zu bytes at %p)\n", it->second.fileName, it->second.line, it->second.size, it->second.address);
 		}
@@ -62,11 +64,13 @@ public:
 	}
 
 	void clearAllocations() {
+		MutexLock lock(_mutex);
 		_allocated.clear();
 		_usedMemory = 0;
 	}
 
 	virtual void *_alloc(size_t size, const char *file, int line) {
+		MutexLock lock(_mutex);
 		void *result = _extension->_alloc(size, file, line);
 		_allocated[result] = Allocation(result, size, file, line);
 		_allocations++;
@@ -75,6 +79,7 @@ public:
 	}
 
 	virtual void *_calloc(size_t size, const char *file, int line) {
+		MutexLock lock(_mutex);
 		void *result = _extension->_calloc(size, file, line);
 		_allocated[result] = Allocation(result, size, file, line);
 		_allocations++;
@@ -83,6 +88,7 @@ public:
 	}
 
 	virtual void *_realloc(void *ptr, size_t size, const char *file, int line) {
+		MutexLock lock(_mutex);
 		if (_allocated.count(ptr)) _usedMemory -= _allocated[ptr].size;
 		_allocated.erase(ptr);
 		void *result = _extension->_realloc(ptr, size, file, line);
@@ -93,6 +99,7 @@ public:
 	}
 
 	virtual void _free(void *mem, const char *file, int line) {
+		MutexLock lock(_mutex);
 		if (_allocated.count(mem)) {
 			_extension->_free(mem, file, line);
 			_frees++;
@@ -110,11 +117,28 @@ public:
 	}
 	
 	size_t getUsedMemory() {
+		MutexLock lock(_mutex);
 		return _usedMemory;
 	}
 
+	size_t getAllocations() {
+		MutexLock lock(_mutex);
+		return _allocations;
+	}
+
+	size_t getReallocations() {
+		MutexLock lock(_mutex);
+		return _reallocations;
+	}
+
+	size_t getFrees() {
+		MutexLock lock(_mutex);
+		return _frees;
+	}
+
 private:
 	SpineExtension* _extension;
+	Mutex _mutex;
 	std::map<void*, Allocation> _allocated;
 	size_t _allocations;
 	size_t _reallocations;
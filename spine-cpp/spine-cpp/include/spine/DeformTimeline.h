@@ -38,12 +38,15 @@ namespace spine {
 	class SP_API DeformTimeline : public CurveTimeline {
 		friend class SkeletonBinary;
 		friend class SkeletonJson;
+		friend class Animation;
 
 		RTTI_DECL
 
 	public:
 		explicit DeformTimeline(int frameCount);
 
+		virtual ~DeformTimeline();
+
 		virtual void apply(Skeleton& skeleton, float lastTime, float time, Vector<Event*>* pEvents, float alpha, MixBlend blend, MixDirection direction);
 
 		virtual int getPropertyId();
@@ -53,7 +56,9 @@ namespace spine {
 
 		int getSlotIndex();
 		void setSlotIndex(int inValue);
+		/// Empty after Animation::compress().
 		Vector<float>& getFrames();
+		/// Empty after Animation::compress().
 		Vector< Vector<float> >& getVertices();
 		VertexAttachment* getAttachment();
 		void setAttachment(VertexAttachment* inValue);
@@ -63,6 +68,21 @@ namespace spine {
 		Vector<float> _frames;
 		Vector< Vector<float> > _frameVertices;
 		VertexAttachment* _attachment;
+
+		/// The keyframes after Animation::compress(), storing only the runs of vertices that differ from the setup pose, or
+		/// from zero for weighted deform offsets.
+		struct SparseFrames : public SpineObject {
+			const float *times;
+			size_t frameCount;
+			size_t vertexCount;
+			Vector<int> frameRuns; // Index of each keyframe's first run and first vertex, followed by the totals.
+			Vector<int> runs; // Start and count of each run.
+			Vector<float> vertices;
+		};
+		SparseFrames *_sparse;
+
+		/// Returns the vertices of the keyframe. Sparse keyframes are decoded into the buffer.
+		const float *getFrameVertices(size_t frameIndex, float *buffer);
 	};
 }
 
@@ -43,22 +43,22 @@ class SP_API SpineExtension {
 public:
 	template<typename T>
 	static T *alloc(size_t num, const char *file, int line) {
-		return (T *) getInstance()->_alloc(sizeof(T) * num, file, line);
+		return (T *) allocate(sizeof(T) * num, file, line);
 	}
 
 	template<typename T>
 	static T *calloc(size_t num, const char *file, int line) {
-		return (T *) getInstance()->_calloc(sizeof(T) * num, file, line);
+		return (T *) callocate(sizeof(T) * num, file, line);
 	}
 
 	template<typename T>
 	static T *realloc(T *ptr, size_t num, const char *file, int line) {
-		return (T *) getInstance()->_realloc(ptr, sizeof(T) * num, file, line);
+		return (T *) reallocate((void *) ptr, sizeof(T) * num, file, line);
 	}
 
 	template<typename T>
 	static void free(T *ptr, const char *file, int line) {
-		getInstance()->_free((void *) ptr, file, line);
+		deallocate((void *) ptr, file, line);
 	}
 
 	template<typename T>
@@ -95,6 +95,15 @@ protected:
 
 private:
 	static SpineExtension *_instance;
+
+	// Serve allocations from the calling thread's current Arena, if any, and forward to the instance otherwise.
+	static void *allocate(size_t size, const char *file, int line);
+
+	static void *callocate(size_t size, const char *file, int line);
+
+	static void *reallocate(void *ptr, size_t size, const char *file, int line);
+
+	static void deallocate(void *ptr, const char *file, int line);
 };
 
 class SP_API DefaultSpineExtension : public SpineExtension {
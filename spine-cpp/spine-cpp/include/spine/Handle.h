@@ -0,0 +1,104 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifndef Spine_Handle_h
+#define Spine_Handle_h
+
+#include <spine/dll.h>
+
+namespace spine {
+class BoneData;
+
+class SlotData;
+
+class Skin;
+
+class EventData;
+
+class Animation;
+
+class IkConstraintData;
+
+class TransformConstraintData;
+
+class PathConstraintData;
+
+/// The index of an item of a SkeletonData, typed by the item so handles of different kinds can't be mixed up. Found
+/// once by name, a handle gets the item without hashing or comparing names. Handles stay valid as long as items are
+/// only added to the SkeletonData, and can be used with any Skeleton of that data.
+template<typename T>
+class SP_API Handle {
+public:
+	Handle() : _index(-1) {
+	}
+
+	explicit Handle(int index) : _index(index) {
+	}
+
+	/// The index of the item in its SkeletonData vector, or -1.
+	int getIndex() const {
+		return _index;
+	}
+
+	/// False if the item was not found.
+	bool isValid() const {
+		return _index != -1;
+	}
+
+	bool operator==(const Handle &other) const {
+		return _index == other._index;
+	}
+
+	bool operator!=(const Handle &other) const {
+		return _index != other._index;
+	}
+
+private:
+	int _index;
+};
+
+typedef Handle<BoneData> BoneHandle;
+
+typedef Handle<SlotData> SlotHandle;
+
+typedef Handle<Skin> SkinHandle;
+
+typedef Handle<EventData> EventHandle;
+
+typedef Handle<Animation> AnimationHandle;
+
+typedef Handle<IkConstraintData> IkConstraintHandle;
+
+typedef Handle<TransformConstraintData> TransformConstraintHandle;
+
+typedef Handle<PathConstraintData> PathConstraintHandle;
+}
+
+#endif /* Spine_Handle_h */
@@ -33,6 +33,7 @@
 #include <spine/Extension.h>
 #include <spine/Vector.h>
 #include <spine/SpineObject.h>
+#include <spine/SpineString.h>
 
  // Required for new with line number and file name in MSVC
 #ifdef _MSC_VER
@@ -40,7 +41,64 @@
 #endif
 
 namespace spine {
-template<typename K, typename V>
+/// Hash function used by HashMap. Integral, pointer and String keys are supported out of the box,
+/// any other key type must provide a size_t hash() const member consistent with its operator==.
+template<typename K>
+struct SP_API Hash {
+	static size_t hash(const K &key) {
+		return key.hash();
+	}
+};
+
+/// Mixes the bits of an integer key so sequential ids spread over the low bits used for indexing.
+inline size_t hashInteger(size_t key) {
+	size_t h = key * (size_t) 0x9E3779B1u;
+	return h ^ (h >> 16);
+}
+
+template<>
+struct SP_API Hash<int> {
+	static size_t hash(int key) { return hashInteger((size_t) key); }
+};
+
+template<>
+struct SP_API Hash<unsigned int> {
+	static size_t hash(unsigned int key) { return hashInteger((size_t) key); }
+};
+
+template<>
+struct SP_API Hash<long> {
+	static size_t hash(long key) { return hashInteger((size_t) key); }
+};
+
+template<>
+struct SP_API Hash<unsigned long> {
+	static size_t hash(unsigned long key) { return hashInteger((size_t) key); }
+};
+
+template<typename T>
+struct SP_API Hash<T *> {
+	static size_t hash(T *key) { return hashInteger(((size_t) key) >> 3); }
+};
+
+template<>
+struct SP_API Hash<String> {
+	/// FNV-1a over the characters of the string.
+	static size_t hash(const String &key) {
+		size_t h = (size_t) 2166136261u;
+		const char *chars = key.buffer();
+		for (size_t i = 0, n = key.length(); i < n; i++) {
+			h ^= (unsigned char) chars[i];
+			h *= (size_t) 16777619u;
+		}
+		return h;
+	}
+};
+
+/// Hash table using open addressing with linear probing. Entries are stored inline in a single
+/// power-of-two sized buffer, so lookups touch contiguous memory and insertions do not allocate
+/// unless the table grows. Removal uses backward shifting, so no tombstones accumulate.
+template<typename K, typename V, typename H = Hash<K> >
 class SP_API HashMap : public SpineObject {
 private:
 	class Entry;
@@ -58,47 +116,49 @@ public:
 	public:
 		friend class HashMap;
 
-		explicit Entries(Entry *entry) : _entry(NULL), _hasChecked(false) {
-			_start.next = entry;
-			_entry = &_start;
+		explicit Entries(Entry *entries, size_t capacity) : _hasChecked(false), _entries(entries), _capacity(capacity), _index(0) {
 		}
 
 		Pair next() {
-			assert(_entry);
 			assert(_hasChecked);
-			_entry = _entry->next;
-			Pair pair(_entry->_key, _entry->_value);
+			assert(_index < _capacity);
+			Entry &entry = _entries[_index++];
 			_hasChecked = false;
-			return pair;
+			return Pair(entry._key, entry._value);
 		}
 
 		bool hasNext() {
 			_hasChecked = true;
-			return _entry->next;
+			while (_index < _capacity && !_entries[_index]._used)
+				_index++;
+			return _index < _capacity;
 		}
 
 	private:
 		bool _hasChecked;
-		Entry _start;
-		Entry *_entry;
+		Entry *_entries;
+		size_t _capacity;
+		size_t _index;
 	};
 
 	HashMap() :
-			_head(NULL),
+			_entries(NULL),
+			_capacity(0),
 			_size(0) {
 	}
 
 	~HashMap() {
-		clear();
+		deallocate(_entries, _capacity);
 	}
 
+	/// Removes all entries, keeping the allocated storage for reuse.
 	void clear() {
-		for (Entry *entry = _head; entry != NULL;) {
-			Entry* next = entry->next;
-			delete entry;
-			entry = next;
+		if (_size == 0) return;
+		for (size_t i = 0; i < _capacity; i++) {
+			if (_entries[i]._used) {
+				_entries[i] = Entry();
+			}
 		}
-		_head = NULL;
 		_size = 0;
 	}
 
@@ -107,25 +167,23 @@ public:
 	}
 
 	void put(const K &key, const V &value) {
-		Entry *entry = find(key);
-		if (entry) {
-			entry->_key = key;
-			entry->_value = value;
-		} else {
-			entry = new(__FILE__, __LINE__) Entry();
-			entry->_key = key;
-			entry->_value = value;
-
-			Entry *oldHead = _head;
-
-			if (oldHead) {
-				_head = entry;
-				oldHead->prev = entry;
-				entry->next = oldHead;
-			} else {
-				_head = entry;
+		if ((_size + 1) * 4 > _capacity * 3) grow();
+
+		size_t mask = _capacity - 1;
+		for (size_t i = H::hash(key) & mask;; i = (i + 1) & mask) {
+			Entry &entry = _entries[i];
+			if (!entry._used) {
+				entry._key = key;
+				entry._value = value;
+				entry._used = true;
+				_size++;
+				return;
+			}
+			if (entry._key == key) {
+				entry._key = key;
+				entry._value = value;
+				return;
 			}
-			_size++;
 		}
 	}
 
@@ -137,14 +195,18 @@ public:
 		Entry *entry = find(key);
 		if (!entry) return false;
 
-		Entry *prev = entry->prev;
-		Entry *next = entry->next;
-
-		if (prev) prev->next = next;
-		else _head = next;
-		if (next) next->prev = entry->prev;
-
-		delete entry;
+		// Shift following entries of the probe sequence back into the hole, so
+		// lookups never have to skip over deleted slots.
+		size_t mask = _capacity - 1;
+		size_t hole = (size_t) (entry - _entries);
+		for (size_t i = (hole + 1) & mask; _entries[i]._used; i = (i + 1) & mask) {
+			size_t home = H::hash(_entries[i]._key) & mask;
+			if (((i - home) & mask) >= ((i - hole) & mask)) {
+				_entries[hole] = _entries[i];
+				hole = i;
+			}
+		}
+		_entries[hole] = Entry();
 		_size--;
 
 		return true;
@@ -160,29 +222,63 @@ public:
 	}
 
 	Entries getEntries() const {
-		return Entries(_head);
+		return Entries(_entries, _capacity);
 	}
 
 private:
 	Entry *find(const K &key) {
-		for (Entry *entry = _head; entry != NULL; entry = entry->next) {
-			if (entry->_key == key)
-				return entry;
+		if (_size == 0) return NULL;
+
+		size_t mask = _capacity - 1;
+		for (size_t i = H::hash(key) & mask;; i = (i + 1) & mask) {
+			Entry &entry = _entries[i];
+			if (!entry._used) return NULL;
+			if (entry._key == key) return &entry;
+		}
+	}
+
+	void grow() {
+		Entry *oldEntries = _entries;
+		size_t oldCapacity = _capacity;
+
+		_capacity = oldCapacity == 0 ? 8 : oldCapacity << 1;
+		_entries = SpineExtension::alloc<Entry>(_capacity, __FILE__, __LINE__);
+		for (size_t i = 0; i < _capacity; i++) {
+			new(_entries + i) Entry();
+		}
+
+		size_t mask = _capacity - 1;
+		for (size_t i = 0; i < oldCapacity; i++) {
+			Entry &entry = oldEntries[i];
+			if (!entry._used) continue;
+			size_t index = H::hash(entry._key) & mask;
+			while (_entries[index]._used)
+				index = (index + 1) & mask;
+			_entries[index] = entry;
+		}
+
+		deallocate(oldEntries, oldCapacity);
+	}
+
+	static void deallocate(Entry *entries, size_t capacity) {
+		if (!entries) return;
+		for (size_t i = 0; i < capacity; i++) {
+			entries[i].~Entry();
 		}
-		return NULL;
+		SpineExtension::free(entries, __FILE__, __LINE__);
 	}
 
-	class SP_API Entry : public SpineObject {
+	class SP_API Entry {
 	public:
 		K _key;
 		V _value;
-		Entry *next;
-		Entry *prev;
+		bool _used;
 
-		Entry() : next(NULL), prev(NULL) {}
+		Entry() : _key(), _value(), _used(false) {}
 	};
 
-	Entry *_head;
+	Entry *_entries;
+	size_t _capacity;
 	size_t _size;
 };
 }
@@ -46,6 +46,8 @@ class SP_API IkConstraint : public Updatable {
 
 	friend class IkConstraintTimeline;
 
+	friend class SkeletonSnapshot;
+
 RTTI_DECL
 
 public:
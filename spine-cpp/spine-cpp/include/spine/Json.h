@@ -51,7 +51,7 @@ public:
 	static const int JSON_ARRAY;
 	static const int JSON_OBJECT;
 
-	/* Get item "string" from object. Case insensitive. */
+	/* Get item "string" from object. Case insensitive. Objects with many items are indexed by name hash when parsed. */
 	static Json *getItem(Json *object, const char *string);
 
 	static const char *getString(Json *object, const char *name, const char *defaultValue);
@@ -90,6 +90,11 @@ private:
 
 	const char *_name; /* The item's name string, if this item is the child of, or is in the list of subitems of an object. */
 
+	Json **_index; /* The items of an object by case insensitive name hash with linear probing, if it has at least INDEX_MIN_SIZE items. */
+	int _indexCapacity;
+
+	static const int INDEX_MIN_SIZE;
+
 	/* Utility to jump whitespace and cr/lf */
 	static const char *skip(const char *inValue);
 
@@ -109,6 +114,10 @@ private:
 	static const char *parseObject(Json *item, const char *value);
 
 	static int json_strcasecmp(const char *s1, const char *s2);
+
+	static size_t hashName(const char *name);
+
+	static void buildIndex(Json *object);
 };
 }
 
@@ -58,18 +58,72 @@ public:
 
 	static float abs(float v);
 
-	/// Returns the sine in radians from a lookup table.
+	/// Returns the sine in radians. See sinCos() for how the implementation is selected.
 	static float sin(float radians);
 
-	/// Returns the cosine in radians from a lookup table.
+	/// Returns the cosine in radians. See sinCos() for how the implementation is selected.
 	static float cos(float radians);
 
-	/// Returns the sine in radians from a lookup table.
+	/// Returns the sine in degrees. See sinCos() for how the implementation is selected.
 	static float sinDeg(float degrees);
 
-	/// Returns the cosine in radians from a lookup table.
+	/// Returns the cosine in degrees. See sinCos() for how the implementation is selected.
 	static float cosDeg(float degrees);
 
+	/// Computes the sine and cosine of the same angle in radians in one call, sharing the range reduction.
+	///
+	/// By default the C library is used, which is exact to float precision. Defining SPINE_TRIG_POLYNOMIAL selects
+	/// sinCosPolynomial(), defining SPINE_TRIG_TABLE selects sinCosTable(). All trigonometry in the runtime goes
+	/// through these functions, so the define affects every skeleton.
+	static inline void sinCos(float radians, float &outSin, float &outCos) {
+#if defined(SPINE_TRIG_POLYNOMIAL)
+		sinCosPolynomial(radians, outSin, outCos);
+#elif defined(SPINE_TRIG_TABLE)
+		sinCosTable(radians, outSin, outCos);
+#else
+		sinCosLibm(radians, outSin, outCos);
+#endif
+	}
+
+	/// Computes the sine and cosine of the same angle in degrees in one call. See sinCos().
+	static inline void sinCosDeg(float degrees, float &outSin, float &outCos) {
+#if defined(SPINE_TRIG_POLYNOMIAL)
+		sinCosDegPolynomial(degrees, outSin, outCos);
+#elif defined(SPINE_TRIG_TABLE)
+		sinCosDegTable(degrees, outSin, outCos);
+#else
+		sinCosDegLibm(degrees, outSin, outCos);
+#endif
+	}
+
+	/// Sine and cosine from the C library, rounded to float.
+	static void sinCosLibm(float radians, float &outSin, float &outCos);
+
+	static void sinCosDegLibm(float degrees, float &outSin, float &outCos);
+
+	/// Sine and cosine from a 4096 entry table with linear interpolation. Largest error is about 5e-7, the table
+	/// costs 16 KB.
+	static void sinCosTable(float radians, float &outSin, float &outCos);
+
+	static void sinCosDegTable(float degrees, float &outSin, float &outCos);
+
+	/// Sine and cosine from minimax polynomials after reduction to [-45, 45] degrees. Largest error is about 1e-7
+	/// for angles up to a few thousand degrees. Branch free and inlined, so loops over many angles can be vectorized.
+	/// The angle must be within +-2^31 quarter turns.
+	static inline void sinCosPolynomial(float radians, float &outSin, float &outCos) {
+		int quadrant = nearestInteger(radians * 0.63661977236758134f);
+		// Pi / 2 split in three parts with short mantissas, so the products are exact for large quadrants.
+		float x = radians - quadrant * 1.5703125f;
+		x -= quadrant * 4.837512969970703125e-4f;
+		x -= quadrant * 7.54978995489188216e-8f;
+		sinCosQuadrant(x, quadrant, outSin, outCos);
+	}
+
+	static inline void sinCosDegPolynomial(float degrees, float &outSin, float &outCos) {
+		int quadrant = nearestInteger(degrees * (1.0f / 90.0f));
+		sinCosQuadrant((degrees - quadrant * 90.0f) * 0.017453292519943295f, quadrant, outSin, outCos);
+	}
+
 	/// Returns atan2 in radians, faster but less accurate than Math.Atan2. Average error of 0.00231 radians (0.1323
 	/// degrees), largest error of 0.00488 radians (0.2796 degrees).
 	static float atan2(float y, float x);
@@ -89,6 +143,25 @@ public:
 	static float randomTriangular(float min, float max, float mode);
 
 	static float pow(float a, float b);
+
+private:
+	/// Rounds to the nearest integer without branches, which would mispredict for angles of random sign.
+	static inline int nearestInteger(float value) {
+		int integer = (int)value;
+		float fraction = value - integer;
+		return integer + (int)(fraction > 0.5f) - (int)(fraction < -0.5f);
+	}
+
+	/// Evaluates the polynomials for x in [-Pi / 4, Pi / 4] and rotates the result by the given number of quarter turns.
+	/// The rotation selects and negates by multiplying with exact 0 and +-1 instead of branching.
+	static inline void sinCosQuadrant(float x, int quadrant, float &outSin, float &outCos) {
+		float x2 = x * x;
+		float s = x + x * x2 * (-1.6666654611e-1f + x2 * (8.3321608736e-3f + x2 * -1.9515295891e-4f));
+		float c = 1.0f - 0.5f * x2 + x2 * x2 * (4.166664568298827e-2f + x2 * (-1.388731625493765e-3f + x2 * 2.443315711809948e-5f));
+		float swap = (float)(quadrant & 1), keep = 1.0f - swap;
+		outSin = (s * keep + c * swap) * (1.0f - (float)(quadrant & 2));
+		outCos = (c * keep + s * swap) * (1.0f - (float)((quadrant + 1) & 2));
+	}
 };
 
 struct SP_API Interpolation {
@@ -0,0 +1,98 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifndef Spine_NameIndex_h
+#define Spine_NameIndex_h
+
+#include <spine/Vector.h>
+#include <spine/HashMap.h>
+#include <spine/SpineObject.h>
+#include <spine/SpineString.h>
+
+namespace spine {
+/// How NameIndex gets the name of an item. Items provide getName() by default.
+template<typename T>
+struct SP_API NameOf {
+	static const String &get(T *item) {
+		return item->getName();
+	}
+};
+
+/// Finds the index of an item in a vector by name in constant time. Only the name hashes and item indices are stored, a
+/// hash match is confirmed by comparing the item's name. Items added since the last update() are found by comparing
+/// names, like ContainerUtil::findIndexWithName(). After removing, renaming or replacing items, clear() and update()
+/// again.
+class SP_API NameIndex : public SpineObject {
+public:
+	NameIndex();
+
+	void clear();
+
+	/// Indexes the items added since the last update, or all items if items were removed.
+	template<typename T>
+	void update(Vector<T *> &items) {
+		if (items.size() < _hashes.size()) clear();
+		size_t n = items.size();
+		if (n == _hashes.size()) return;
+		_hashes.ensureCapacity(n);
+		for (size_t i = _hashes.size(); i < n; i++)
+			_hashes.add(Hash<String>::hash(NameOf<T>::get(items[i])));
+		rehash();
+	}
+
+	/// @return The index of the first item with the name, or -1.
+	template<typename T>
+	int find(Vector<T *> &items, const String &name) {
+		size_t start = 0, itemCount = _hashes.size();
+		if (itemCount > 0 && itemCount <= items.size()) {
+			size_t hash = Hash<String>::hash(name), mask = _slots.size() - 1;
+			for (size_t i = hash & mask; _slots[i] != -1; i = (i + 1) & mask) {
+				int index = _slots[i];
+				if (_hashes[index] == hash && NameOf<T>::get(items[index]) == name) return index;
+			}
+			start = itemCount;
+		}
+		for (size_t i = start, n = items.size(); i < n; i++)
+			if (NameOf<T>::get(items[i]) == name) return (int) i;
+		return -1;
+	}
+
+	/// The number of items indexed by the last update.
+	size_t getItemCount();
+
+private:
+	Vector<size_t> _hashes; // Name hash of each indexed item.
+	Vector<int> _slots; // Item indices by hash with linear probing, -1 if empty.
+
+	void rehash();
+};
+}
+
+#endif /* Spine_NameIndex_h */
@@ -46,6 +46,7 @@ namespace spine {
 		friend class PathConstraintMixTimeline;
 		friend class PathConstraintPositionTimeline;
 		friend class PathConstraintSpacingTimeline;
+		friend class SkeletonSnapshot;
 
 		RTTI_DECL
 
@@ -82,6 +83,16 @@ namespace spine {
 
 		void setActive(bool inValue);
 
+		/// If true, the world vertices and curve lengths of a constant speed path are kept between updates and only
+		/// recomputed when the world transforms of the bones the path depends on or the target slot's deform change.
+		/// Default is true.
+		void setGeometryCacheEnabled(bool inValue);
+
+		bool isGeometryCacheEnabled();
+
+		/// Discards the cached path geometry. Must be called if the vertices of the target's path attachment are modified.
+		void invalidateGeometryCache();
+
 	private:
 		static const float EPSILON;
 		static const int NONE;
@@ -98,10 +109,27 @@ namespace spine {
 		Vector<float> _world;
 		Vector<float> _curves;
 		Vector<float> _lengths;
+
+		/// 10 cumulative segment lengths per curve, computed when a curve is first sampled. The first length of a curve is
+		/// negative until then.
 		Vector<float> _segments;
 
 		bool _active;
 
+		bool _geometryCacheEnabled;
+		/// The path attachment whose world vertices are in _world and curve lengths in _curves, or NULL.
+		PathAttachment* _cachedPath;
+		/// The target slot the cached path was computed for.
+		Slot* _cachedTarget;
+		/// The bones whose world transforms the cached path depends on.
+		Vector<Bone*> _cachedBones;
+		/// The world transforms of _cachedBones and the target's deform the cached path was computed from.
+		Vector<float> _cachedInputs;
+
+		/// Stores the inputs of the path's world vertices.
+		/// @return true if they are the same as for the cached geometry.
+		bool updateCachedInputs(PathAttachment& path);
+
 		Vector<float>& computeWorldPositions(PathAttachment& path, int spacesCount, bool tangents, bool percentPosition, bool percentSpacing);
 
 		static void addBeforePosition(float p, Vector<float>& temp, int i, Vector<float>& output, int o);
@@ -60,10 +60,9 @@ public:
 		}
 	}
 
+	/// Returns an object to the free list in constant time. An object must not be freed twice before it is obtained again.
 	void free(T *object) {
-		if (!_objects.contains(object)) {
-			_objects.add(object);
-		}
+		_objects.add(object);
 	}
 
 private:
@@ -0,0 +1,249 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifndef Spine_ProfilingExtension_h
+#define Spine_ProfilingExtension_h
+
+#include <spine/Extension.h>
+#include <spine/Threading.h>
+
+#include <stdio.h>
+
+/// Times the enclosing scope when the runtime is compiled with SPINE_PROFILE and a ProfilingSpineExtension has timers
+/// enabled. Expands to nothing otherwise. The name must be a string literal.
+#ifdef SPINE_PROFILE
+#define SP_PROFILE_SCOPE(name) spine::ProfileScope _spProfileScope(name)
+#else
+#define SP_PROFILE_SCOPE(name)
+#endif
+
+namespace spine {
+/// Forwards to another extension, recording statistics per allocating call site (the file and line every allocation
+/// already passes), allocations per frame, live memory for leak reports and, optionally, scoped timers. The statistics
+/// are kept in tables allocated from the wrapped extension, so the extension never profiles itself.
+///
+/// To enforce an allocation budget, call beginFrame() and endFrame() around each frame and check getFramesOverBudget().
+class SP_API ProfilingSpineExtension : public SpineExtension {
+public:
+	struct CallSite {
+		const char *file;
+		int line;
+		size_t allocations;
+		size_t reallocations;
+		size_t frees;
+		/// The bytes requested by all allocations and reallocations.
+		size_t bytes;
+		size_t liveAllocations;
+		size_t liveBytes;
+		size_t peakLiveBytes;
+	};
+
+	struct Timer {
+		const char *name;
+		size_t count;
+		/// In microseconds.
+		double total, min, max;
+	};
+
+	explicit ProfilingSpineExtension(SpineExtension *extension);
+
+	virtual ~ProfilingSpineExtension();
+
+	/// Starts counting the allocations of a new frame.
+	void beginFrame();
+
+	/// Ends the frame, comparing its allocations to the budget.
+	void endFrame();
+
+	size_t getFrameCount();
+
+	/// The allocations and reallocations since the last beginFrame().
+	size_t getFrameAllocations();
+
+	/// The bytes allocated and reallocated since the last beginFrame().
+	size_t getFrameBytes();
+
+	/// The most allocations and reallocations of any ended frame.
+	size_t getMaxFrameAllocations();
+
+	/// The allocations and reallocations allowed per frame. Default is unlimited, (size_t)-1.
+	void setFrameAllocationBudget(size_t budget);
+
+	size_t getFrameAllocationBudget();
+
+	/// The number of ended frames that exceeded the budget.
+	size_t getFramesOverBudget();
+
+	size_t getCallSiteCount();
+
+	/// Call sites are in order of their first allocation. The returned reference is valid until the next allocation.
+	const CallSite &getCallSite(size_t index);
+
+	size_t getLiveAllocations();
+
+	size_t getLiveBytes();
+
+	size_t getPeakLiveBytes();
+
+	/// Frees of memory that was not allocated through this extension, eg before it was set as the instance.
+	size_t getUntrackedFrees();
+
+	/// Prints the live allocations of each call site.
+	/// @return The number of live allocations.
+	size_t reportLeaks();
+
+	/// Clears all statistics. Memory that is live stays tracked.
+	void reset();
+
+	/// Sets this extension as the one SP_PROFILE_SCOPE reports to, or clears it. Only one extension receives timings.
+	void setTimersEnabled(bool enabled);
+
+	bool isTimersEnabled();
+
+	/// The number of timed scopes kept for writeChromeTrace(). Scopes after that are only added to the timer statistics.
+	/// Default is 65536. Takes effect when timers are enabled.
+	void setMaxTraceEvents(size_t maxTraceEvents);
+
+	size_t getTimerCount();
+
+	const Timer &getTimer(size_t index);
+
+	/// Records a timed scope. Used by ProfileScope.
+	void addTimer(const char *name, double start, double end);
+
+	/// Writes the frame, memory, call site and timer statistics as a JSON object.
+	void writeJson(FILE *file);
+
+	/// Writes the timed scopes and the allocations per frame in the Chrome trace event format, for chrome://tracing or
+	/// Perfetto.
+	void writeChromeTrace(FILE *file);
+
+	/// Microseconds from an arbitrary point, from a monotonic clock.
+	static double now();
+
+	static ProfilingSpineExtension *getTimerExtension();
+
+	virtual void *_alloc(size_t size, const char *file, int line);
+
+	virtual void *_calloc(size_t size, const char *file, int line);
+
+	virtual void *_realloc(void *ptr, size_t size, const char *file, int line);
+
+	virtual void _free(void *mem, const char *file, int line);
+
+	virtual char *_readFile(const String &path, int *length);
+
+private:
+	struct Allocation {
+		void *address;
+		size_t size;
+		size_t site;
+	};
+
+	struct SiteKey {
+		const char *file;
+		int line;
+		size_t site;
+	};
+
+	// A timed scope, or a counter value when counter is set.
+	struct TraceEvent {
+		const char *name;
+		double start, duration;
+		size_t value;
+		unsigned int thread;
+		bool counter;
+	};
+
+	static ProfilingSpineExtension *_timerExtension;
+
+	SpineExtension *_extension;
+	Mutex _mutex;
+
+	// Open addressing tables with linear probing, their capacities are powers of 2.
+	Allocation *_allocations;
+	size_t _allocationsCapacity, _allocationsCount;
+	SiteKey *_siteKeys;
+	size_t _siteKeysCapacity, _siteKeysCount;
+
+	CallSite *_sites;
+	size_t _sitesCapacity, _sitesCount;
+	Timer *_timers;
+	size_t _timersCapacity, _timersCount;
+	TraceEvent *_traceEvents;
+	size_t _traceEventsCapacity, _traceEventsCount, _maxTraceEvents;
+
+	size_t _liveAllocations, _liveBytes, _peakLiveBytes, _untrackedFrees;
+	size_t _frameCount, _frameAllocations, _frameBytes, _maxFrameAllocations, _frameAllocationBudget, _framesOverBudget;
+	double _frameStart;
+
+	size_t findSite(const char *file, int line);
+
+	void track(void *address, size_t size, size_t site);
+
+	bool untrack(void *address, size_t &size, size_t &site);
+
+	void growAllocations();
+
+	void growSiteKeys();
+
+	template<typename T>
+	T *grow(T *items, size_t &capacity);
+
+	void addTraceEvent(const char *name, double start, double duration, size_t value, bool counter);
+
+	ProfilingSpineExtension(const ProfilingSpineExtension &);
+
+	ProfilingSpineExtension &operator=(const ProfilingSpineExtension &);
+};
+
+/// Times its lifetime and reports it to ProfilingSpineExtension::getTimerExtension(), if any. Use SP_PROFILE_SCOPE.
+class SP_API ProfileScope {
+public:
+	explicit ProfileScope(const char *name) : _name(name), _extension(ProfilingSpineExtension::getTimerExtension()) {
+		if (_extension) _start = ProfilingSpineExtension::now();
+	}
+
+	~ProfileScope() {
+		if (_extension) _extension->addTimer(_name, _start, ProfilingSpineExtension::now());
+	}
+
+private:
+	const char *_name;
+	ProfilingSpineExtension *_extension;
+	double _start;
+
+	ProfileScope(const ProfileScope &);
+
+	ProfileScope &operator=(const ProfileScope &);
+};
+}
+
+#endif /* Spine_ProfilingExtension_h */
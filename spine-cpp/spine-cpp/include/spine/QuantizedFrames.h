@@ -0,0 +1,81 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifndef Spine_QuantizedFrames_h
+#define Spine_QuantizedFrames_h
+
+#include <spine/Vector.h>
+#include <spine/SpineObject.h>
+
+namespace spine {
+/// The keyframe values of a bone timeline stored as 16 bit integers, see Animation::compress().
+///
+/// Each value of a keyframe, such as x or y, is quantized to 65535 steps between the smallest and largest value it has in
+/// the timeline. A decoded value differs from the original by at most half a step, see getMaxError(). If the range includes
+/// 0, the steps are placed so 0 stays exact: AnimationState treats a rotation equal to the current one differently. The
+/// keyframe times are not copied, they are shared with other timelines that have the same times.
+class SP_API QuantizedFrames : public SpineObject {
+public:
+	/// The largest number of floats decode() writes.
+	static const int MAX_WINDOW_SIZE = 6;
+
+	/// @param frames The keyframes, each a time followed by entries - 1 values.
+	/// @param times The time of each keyframe. Must stay valid for the lifetime of this object.
+	QuantizedFrames(const float *frames, int frameCount, int entries, const float *times);
+
+	/// Writes the keyframes needed to apply a timeline at the time to window, laid out like the original frames: the first
+	/// two keyframes if the time is before the second, the last two if it is after the last, else the two around the time.
+	/// A timeline with a single keyframe writes only that one.
+	/// @param outFirstFrame The index of the first keyframe written, to find its curve.
+	/// @return The number of floats written.
+	int decode(float time, float *window, int &outFirstFrame);
+
+	int getFrameCount() { return _frameCount; }
+
+	const float *getTimes() { return _times; }
+
+	/// The largest difference of a decoded value from its original value.
+	float getMaxError() { return _maxError; }
+
+private:
+	static const int MAX_VALUES = 2;
+
+	const float *_times;
+	int _frameCount;
+	int _valueCount;
+	float _offsets[MAX_VALUES];
+	int _biases[MAX_VALUES];
+	float _steps[MAX_VALUES];
+	float _maxError;
+	Vector<unsigned short> _values;
+};
+}
+
+#endif /* Spine_QuantizedFrames_h */
@@ -0,0 +1,139 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifndef Spine_RenderCommandBuilder_h
+#define Spine_RenderCommandBuilder_h
+
+#include <spine/BlendMode.h>
+#include <spine/SkeletonClipping.h>
+#include <spine/SpineObject.h>
+#include <spine/Vector.h>
+
+namespace spine {
+class Skeleton;
+
+class VertexEffect;
+
+/// A range of vertices and indices drawn with one texture and blend mode, what a renderer issues as one draw call.
+struct SP_API DrawCommand {
+	/// The renderer object of the atlas page, see AtlasPage::getRendererObject(). NULL if the attachment's renderer
+	/// object is not an AtlasRegion.
+	void *texture;
+	BlendMode blendMode;
+	/// The range of the command's vertices in the positions, UVs and colors.
+	size_t firstVertex;
+	size_t vertexCount;
+	/// The range of the command's indices. Indices are relative to firstVertex, so they fit in 16 bits.
+	size_t firstIndex;
+	size_t indexCount;
+};
+
+/// Walks the draw order of skeletons like every renderer does: it computes the world vertices of region and mesh
+/// attachments, clips them with clipping attachments, applies the VertexEffect and computes the vertex colors. The
+/// results are appended to buffers shared by all commands, and consecutive attachments with the same texture and blend
+/// mode are merged into one DrawCommand. A renderer uploads the buffers and issues one draw call per command.
+///
+/// The buffers are reused, so once they have grown to the largest frame, building commands does not allocate.
+class SP_API RenderCommandBuilder : public SpineObject {
+public:
+	/// The most vertices of a command, so its indices fit in 16 bits.
+	static const int MaxVertices = 65535;
+
+	RenderCommandBuilder();
+
+	/// If true, the RGB of the light colors are multiplied by alpha and the alpha of the dark colors is 1, as shaders
+	/// for premultiplied alpha textures expect. Default is false.
+	void setUsePremultipliedAlpha(bool usePremultipliedAlpha) { _usePremultipliedAlpha = usePremultipliedAlpha; }
+
+	bool getUsePremultipliedAlpha() { return _usePremultipliedAlpha; }
+
+	/// If true, the dark colors of two color tinting are computed too. Default is false.
+	void setUseTwoColorTint(bool useTwoColorTint) { _useTwoColorTint = useTwoColorTint; }
+
+	bool getUseTwoColorTint() { return _useTwoColorTint; }
+
+	/// May be NULL.
+	void setVertexEffect(VertexEffect *vertexEffect) { _vertexEffect = vertexEffect; }
+
+	VertexEffect *getVertexEffect() { return _vertexEffect; }
+
+	/// Removes all commands, vertices and indices, keeping the buffers' capacity.
+	void clear();
+
+	/// Appends the attachments of the skeleton to the commands. The skeleton's world transforms must be up to date.
+	void add(Skeleton &skeleton);
+
+	Vector<DrawCommand> &getCommands() { return _commands; }
+
+	/// World x, y pairs.
+	Vector<float> &getPositions() { return _positions; }
+
+	/// u, v pairs.
+	Vector<float> &getUVs() { return _uvs; }
+
+	/// Light colors with red, green, blue and alpha from the lowest to the highest byte, as RGBA8 vertex attributes are
+	/// laid out in memory on little endian machines.
+	Vector<unsigned int> &getColors() { return _colors; }
+
+	/// Dark colors packed like the light colors. Empty unless two color tinting is used.
+	Vector<unsigned int> &getDarkColors() { return _darkColors; }
+
+	/// Three indices per triangle, relative to the firstVertex of their command.
+	Vector<unsigned short> &getIndices() { return _indices; }
+
+	size_t getVertexCount() { return _colors.size(); }
+
+	size_t getTriangleCount() { return _indices.size() / 3; }
+
+	/// Packs a color with each channel clamped to 0-1, red in the lowest byte.
+	static unsigned int packColor(float r, float g, float b, float a);
+
+private:
+	bool _usePremultipliedAlpha;
+	bool _useTwoColorTint;
+	VertexEffect *_vertexEffect;
+	SkeletonClipping _clipper;
+	Vector<float> _worldVertices;
+	Vector<unsigned short> _quadIndices;
+
+	Vector<DrawCommand> _commands;
+	Vector<float> _positions;
+	Vector<float> _uvs;
+	Vector<unsigned int> _colors;
+	Vector<unsigned int> _darkColors;
+	Vector<unsigned short> _indices;
+
+	/// Returns the command the next vertexCount vertices are appended to, starting a new one if the texture or blend
+	/// mode differ or its indices would not fit in 16 bits.
+	DrawCommand &nextCommand(void *texture, BlendMode blendMode, size_t vertexCount);
+};
+}
+
+#endif /* Spine_RenderCommandBuilder_h */
@@ -33,10 +33,16 @@
 #include <spine/CurveTimeline.h>
 
 namespace spine {
+	class Bone;
+
+	class QuantizedFrames;
+
 	class SP_API RotateTimeline : public CurveTimeline {
 		friend class SkeletonBinary;
 		friend class SkeletonJson;
+		friend class BakedAnimation;
 		friend class AnimationState;
+		friend class Animation;
 
 		RTTI_DECL
 
@@ -45,16 +51,25 @@ namespace spine {
 
 		explicit RotateTimeline(int frameCount);
 
+		virtual ~RotateTimeline();
+
 		virtual void apply(Skeleton& skeleton, float lastTime, float time, Vector<Event*>* pEvents, float alpha, MixBlend blend, MixDirection direction);
 
 		virtual int getPropertyId();
 
+		/// Applies keyframes laid out like this timeline's frames and curves, such as the streams of a BakedAnimation, to the
+		/// bone. The bone must be active.
+		/// @param cursor The keyframe cursor for Animation::search, may be NULL.
+		static void applyFrames(Bone &bone, const float *frames, int size, const float *curves, float time, float alpha,
+			MixBlend blend, MixDirection direction, int *cursor);
+
 		/// Sets the time and value of the specified keyframe.
 		void setFrame(int frameIndex, float time, float degrees);
 
 		int getBoneIndex();
 		void setBoneIndex(int inValue);
 
+		/// Empty after Animation::compress() quantized the keyframes.
 		Vector<float>& getFrames();
 
 	private:
@@ -64,6 +79,7 @@ namespace spine {
 
 		int _boneIndex;
 		Vector<float> _frames; // time, angle, ...
+		QuantizedFrames *_quantized;
 	};
 }
 
@@ -45,6 +45,12 @@ namespace spine {
 		virtual void apply(Skeleton& skeleton, float lastTime, float time, Vector<Event*>* pEvents, float alpha, MixBlend blend, MixDirection direction);
 
 		virtual int getPropertyId();
+
+		/// Applies keyframes laid out like this timeline's frames and curves, such as the streams of a BakedAnimation, to the
+		/// bone. The bone must be active.
+		/// @param cursor The keyframe cursor for Animation::search, may be NULL.
+		static void applyFrames(Bone &bone, const float *frames, int size, const float *curves, float time, float alpha,
+			MixBlend blend, MixDirection direction, int *cursor);
 	};
 }
 
@@ -0,0 +1,116 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifndef Spine_SimdUtil_h
+#define Spine_SimdUtil_h
+
+#include <spine/SpineObject.h>
+
+#include <stddef.h>
+
+// The SIMD code paths are selected at compile time from the instruction sets the target is compiled for, e.g. -mavx2 enables
+// the AVX2 paths. Define SPINE_NO_SIMD to force the scalar fallback.
+#ifndef SPINE_NO_SIMD
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SPINE_SIMD_SSE2
+#if defined(__AVX2__)
+#define SPINE_SIMD_AVX2
+#endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define SPINE_SIMD_NEON
+#endif
+#endif
+
+namespace spine {
+/// Vertex processing kernels with SSE2, AVX2 and NEON code paths and a scalar fallback.
+///
+/// The kernels perform the same floating point operations in the same order as the scalar code, so the results are identical
+/// to the scalar path. The only exception is a scalar path that the compiler contracts into fused multiply-adds (e.g.
+/// -ffp-contract=fast on FMA capable targets), which is then more precise by at most 1 ULP per multiply-add.
+class SP_API SimdUtil : public SpineObject {
+private:
+	SimdUtil();
+
+public:
+	/// The number of floats used per bone matrix by transformWeighted(): a, c, b, d, worldX, worldY.
+	static const int MatrixSize = 6;
+
+	/// @return The instruction set the kernels were compiled for: "avx2", "sse2", "neon" or "scalar".
+	static const char *getInstructionSet();
+
+	/// Transforms vertices by the affine transform [a b x] [c d y].
+	/// @param vertices count x,y pairs.
+	/// @param worldVertices Receives the transformed x,y pairs, stride floats apart.
+	static void transform(const float *vertices, size_t count, float a, float b, float c, float d, float x, float y,
+		float *worldVertices, size_t stride);
+
+	/// Transforms weighted vertices. Each vertex is the weighted sum of its influences, each influence being a local x,y position
+	/// transformed by a bone matrix.
+	/// @param matrices MatrixSize floats per influence, in the order the influences are stored in vertices.
+	/// @param influenceCounts The number of influences of each vertex.
+	/// @param count The number of vertices.
+	/// @param vertices x, y, weight per influence.
+	/// @param deform x, y offsets added to the local position of each influence. May be NULL.
+	/// @param worldVertices Receives the transformed x,y pairs, stride floats apart.
+	static void transformWeighted(const float *matrices, const int *influenceCounts, size_t count, const float *vertices,
+		const float *deform, float *worldVertices, size_t stride);
+
+	/// Grows the given bounds by count x,y pairs.
+	static void bounds(const float *vertices, size_t count, float &minX, float &minY, float &maxX, float &maxY);
+
+	/// Tests points against a convex, clockwise polygon. A point is inside if it lies strictly on the inner side of every
+	/// edge, the same test SkeletonClipping uses for each vertex it clips.
+	/// @param xs The x coordinates of count points.
+	/// @param ys The y coordinates of count points.
+	/// @param polygon x,y pairs, with the first vertex duplicated at the end.
+	/// @param polygonLength The number of floats in polygon.
+	/// @param inside Receives 1 for each point inside the polygon, else 0.
+	static void insidePolygon(const float *xs, const float *ys, size_t count, const float *polygon, size_t polygonLength,
+		unsigned char *inside);
+
+	/// Approximates the lengths of cubic Bezier curves by forward differencing 4 segments each, as
+	/// PathConstraint does for constant speed paths.
+	/// @param curves x1, y1 of the first curve, then cx1, cy1, cx2, cy2, x2, y2 for each curve. Each curve starts at the
+	/// end of the previous one.
+	/// @param lengths Receives the length of the path from its start to the end of each curve.
+	static void curveLengths(const float *curves, size_t count, float *lengths);
+
+	/// Interpolates count floats: out = from + (to - from) * alpha. out may be from or to.
+	static void lerp(const float *from, const float *to, float alpha, float *out, size_t count);
+
+	/// Adds count floats relative to base: out += (values - base) * alpha. If base is NULL: out += values * alpha.
+	static void add(const float *values, const float *base, float alpha, float *out, size_t count);
+
+	/// Scales count floats: out = values * scale. out may be values.
+	static void scale(const float *values, float scale, float *out, size_t count);
+};
+}
+
+#endif /* Spine_SimdUtil_h */
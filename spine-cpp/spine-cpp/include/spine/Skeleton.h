@@ -35,6 +35,7 @@
 #include <spine/SpineObject.h>
 #include <spine/SpineString.h>
 #include <spine/Color.h>
+#include <spine/Handle.h>
 
 namespace spine {
 class SkeletonData;
@@ -55,6 +56,10 @@ class Skin;
 
 class Attachment;
 
+class ConstraintData;
+
+class BonePoseBuffer;
+
 class SP_API Skeleton : public SpineObject {
 	friend class AnimationState;
 
@@ -90,13 +95,19 @@ class SP_API Skeleton : public SpineObject {
 
 	friend class TwoColorTimeline;
 
+	friend class BonePoseBuffer;
+
+	friend class SkeletonSnapshot;
+
 public:
 	explicit Skeleton(SkeletonData *skeletonData);
 
 	~Skeleton();
 
 	/// Caches information about bones and constraints. Must be called if bones, constraints or weighted path attachments are added
-	/// or removed.
+	/// or removed. The update order for each set of active bones, constraints and path attachment bones is cached by the
+	/// SkeletonData, so switching to a skin seen before does not sort again. Skeletons whose constraints have other targets or
+	/// bones than the data's always sort. See SkeletonData::clearUpdateOrders().
 	void updateCache();
 
 	void printUpdateCache();
@@ -104,6 +115,14 @@ public:
 	/// Updates the world transform for each bone and applies constraints.
 	void updateWorldTransform();
 
+	/// Enables or disables the structure-of-arrays pose buffer. When enabled, updateWorldTransform() solves runs of
+	/// unconstrained TransformMode_Normal bones in batches instead of calling Bone::update() for each of them. The results are
+	/// the same either way. Disabled by default.
+	void setPoseBufferEnabled(bool enabled);
+
+	/// @return May be NULL if the pose buffer is not enabled.
+	BonePoseBuffer *getPoseBuffer();
+
 	/// Sets the bones, constraints, and slots to their setup pose values.
 	void setToSetupPose();
 
@@ -112,6 +131,7 @@ public:
 
 	void setSlotsToSetupPose();
 
+	/// Finds a bone by name using the SkeletonData name index, see SkeletonData::updateNameIndex().
 	/// @return May be NULL.
 	Bone *findBone(const String &boneName);
 
@@ -142,6 +162,15 @@ public:
 	/// @return May be NULL.
 	Attachment *getAttachment(int slotIndex, const String &attachmentName);
 
+	/// Finds an attachment by its SkeletonData attachment handle. The result is cached until the skin is set again, so
+	/// repeated lookups do no string comparisons. If the handle is -1, the attachment is found by name.
+	/// @return May be NULL.
+	Attachment *getAttachment(int slotIndex, int attachmentHandle, const String &attachmentName);
+
+	/// Clears the attachments cached by attachment handle. Must be called if the skin's attachments are changed without
+	/// setting the skin again.
+	void clearAttachmentCache();
+
 	/// @param attachmentName May be empty.
 	void setAttachment(const String &slotName, const String &attachmentName);
 
@@ -154,6 +183,22 @@ public:
 	/// @return May be NULL.
 	PathConstraint *findPathConstraint(const String &constraintName);
 
+	/// Gets a bone by a handle found with SkeletonData::findBoneHandle().
+	/// @return NULL if the handle is invalid.
+	Bone *getBone(BoneHandle handle);
+
+	/// @return NULL if the handle is invalid.
+	Slot *getSlot(SlotHandle handle);
+
+	/// @return NULL if the handle is invalid.
+	IkConstraint *getIkConstraint(IkConstraintHandle handle);
+
+	/// @return NULL if the handle is invalid.
+	TransformConstraint *getTransformConstraint(TransformConstraintHandle handle);
+
+	/// @return NULL if the handle is invalid.
+	PathConstraint *getPathConstraint(PathConstraintHandle handle);
+
 	void update(float delta);
 
 	/// Returns the axis aligned bounding box (AABB) of the region and mesh attachments for the current pose.
@@ -172,6 +217,9 @@ public:
 
 	Vector<Updatable *> &getUpdateCacheList();
 
+	/// The bones whose applied transform is reset to their local transform by updateWorldTransform().
+	Vector<Bone *> &getUpdateCacheResetList();
+
 	Vector<Slot *> &getSlots();
 
 	Vector<Slot *> &getDrawOrder();
@@ -218,12 +266,41 @@ private:
 	Vector<PathConstraint *> _pathConstraints;
 	Vector<Updatable *> _updateCache;
 	Vector<Bone *> _updateCacheReset;
+	Vector<unsigned int> _updateCacheKey;
+	Vector<unsigned int> _updateCacheBones; // Bits for the bones in _updateCache while sorting.
+	Vector<int> _ownConstraintOrder; // Used when this skeleton's constraints differ from its data's, see constraintsMatchData().
+	Vector<int> *_constraintOrder; // The order updateCache() sorts by, the SkeletonData's or _ownConstraintOrder.
+	Vector<Attachment *> _slotAttachments;
+	BonePoseBuffer *_poseBuffer;
 	Skin *_skin;
+	Vector<Attachment *> _attachmentCache;
+	Vector<int> _attachmentCacheStamps;
+	Vector<float> _deformScratch; // Decoded and interpolated keyframe vertices of DeformTimeline.
+	int _attachmentCacheStamp;
 	Color _color;
 	float _time;
 	float _scaleX, _scaleY;
 	float _x, _y;
 
+	/// Sets which bones are active and stores everything the update order depends on in _updateCacheKey: a bit for each
+	/// active bone, a bit for each skin constraint by order, then the bones path constraints sort for their path attachments.
+	void updateCacheKey();
+
+	void sortUpdateCache();
+
+	/// True if this skeleton has the same constraints as its data, with the same targets and bones. Otherwise the update
+	/// orders cached by the SkeletonData do not apply, because their keys only cover what a skin changes.
+	bool constraintsMatchData();
+
+	/// Like SkeletonData::updateConstraintOrder(), for this skeleton's own constraints.
+	void updateOwnConstraintOrder();
+
+	bool isSkinConstraint(ConstraintData &constraint);
+
+	void addPathAttachmentKey(Attachment *attachment, Bone &slotBone);
+
+	Updatable *getConstraint(int code);
+
 	void sortIkConstraint(IkConstraint *constraint);
 
 	void sortPathConstraint(PathConstraint *constraint);
@@ -0,0 +1,121 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifndef Spine_SkeletonBatchUpdater_h
+#define Spine_SkeletonBatchUpdater_h
+
+#include <spine/SpineObject.h>
+#include <spine/Threading.h>
+#include <spine/Vector.h>
+
+namespace spine {
+class Skeleton;
+
+class AnimationState;
+
+/// Updates many independent skeletons and animation states on a pool of threads.
+///
+/// Each frame, update() distributes the pairs over the workers, which steal from each other when their own share runs
+/// out. Listener and event callbacks of the animation states are queued while the workers run and delivered afterwards
+/// on the calling thread, in the order the pairs were added. Callbacks that change an animation state therefore take
+/// effect in the next frame rather than between AnimationState::update() and AnimationState::apply().
+///
+/// While update() runs, the workers only read the shared SkeletonData and everything it owns: BoneData, SlotData,
+/// constraint data, skins and their attachments, EventData and the events of event timelines, and all Animation and
+/// Timeline objects. AnimationStateData is only read. None of these may be modified from another thread during
+/// update(), and each Skeleton and AnimationState may be part of only one pair. The SpineExtension must be thread safe;
+/// DefaultSpineExtension and DebugExtension are.
+class SP_API SkeletonBatchUpdater : public SpineObject {
+public:
+	/// @param workerCount Threads created in addition to the calling thread, which works too during update(). -1
+	/// creates one thread for each processor beyond the first, 0 updates everything on the calling thread.
+	explicit SkeletonBatchUpdater(int workerCount = -1);
+
+	~SkeletonBatchUpdater();
+
+	/// Adds a skeleton and the animation state that poses it.
+	/// @param state May be NULL, then the skeleton's world transforms are only updated.
+	void add(Skeleton *skeleton, AnimationState *state);
+
+	/// Removes the pair of the skeleton.
+	/// @return false if the skeleton was not added.
+	bool remove(Skeleton *skeleton);
+
+	void clear();
+
+	size_t size();
+
+	/// The number of threads created in addition to the calling thread.
+	int getWorkerCount();
+
+	/// For every pair calls Skeleton::update(), AnimationState::update(), AnimationState::apply() and
+	/// Skeleton::updateWorldTransform() on the workers, then delivers the queued callbacks on the calling thread.
+	void update(float delta);
+
+private:
+	struct Entry {
+		Skeleton *skeleton;
+		AnimationState *state;
+		bool drainDisabled;
+	};
+
+	/// A thread and the range of entries it has left to update. The range is guarded by the mutex, since other workers
+	/// steal from its end. Worker 0 is the calling thread.
+	struct Worker : public SpineObject {
+		SkeletonBatchUpdater *updater;
+		size_t index;
+		Thread thread;
+		Mutex mutex;
+		size_t start, end;
+	};
+
+	Vector<Entry> _entries;
+	Vector<Worker *> _workers;
+	Mutex _mutex;
+	Condition _workAvailable;
+	Condition _workDone;
+	int _generation;
+	int _busyWorkers;
+	bool _shutdown;
+	float _delta;
+
+	static void runWorker(void *worker);
+
+	void work(Worker &worker);
+
+	bool next(Worker &worker, size_t &outIndex);
+
+	bool steal(Worker &thief, size_t &outIndex);
+
+	void updateEntry(Entry &entry);
+};
+}
+
+#endif /* Spine_SkeletonBatchUpdater_h */
@@ -30,6 +30,7 @@
 #ifndef Spine_SkeletonBinary_h
 #define Spine_SkeletonBinary_h
 
+#include <spine/CurveMode.h>
 #include <spine/TransformMode.h>
 #include <spine/Vector.h>
 #include <spine/SpineObject.h>
@@ -74,30 +75,52 @@ namespace spine {
 
 		SkeletonData* readSkeletonData(const unsigned char* binary, int length);
 
+		/// Reads skeleton data from a writable buffer, e.g. a private memory mapping of a .skel file, that must stay alive
+		/// as long as the returned data. Names are not copied but point into the buffer, which is modified to terminate
+		/// them, so it can only be read once. The data is always loaded into an arena, see setUseArena().
+		/// @param ownsBinary If true, the buffer must have been allocated through the SpineExtension and is freed together
+		/// with the returned data, or before returning if reading fails.
+		SkeletonData* readSkeletonDataInPlace(unsigned char* binary, int length, bool ownsBinary = false);
+
 		SkeletonData* readSkeletonDataFile(const String& path);
 
 		void setScale(float scale) { _scale = scale; }
 
+		/// If true, each SkeletonData is loaded into its own Arena, making loading faster and keeping the heap from
+		/// fragmenting. The data's vectors and strings must then not be resized or freed after loading, other than by
+		/// deleting the SkeletonData. Default is false.
+		void setUseArena(bool useArena) { _useArena = useArena; }
+
+		/// How bezier curves are stored in the timelines. Default is CurveMode_Sampled.
+		void setCurveMode(CurveMode curveMode) { _curveMode = curveMode; }
+
 		String& getError() { return _error; }
 
 	private:
 		struct DataInput : public SpineObject {
 			const unsigned char* cursor;
 			const unsigned char* end;
+			bool inPlace;
 		};
 
 		AttachmentLoader* _attachmentLoader;
 		Vector<LinkedMesh*> _linkedMeshes;
 		String _error;
 		float _scale;
+		bool _useArena;
+		CurveMode _curveMode;
 		const bool _ownsLoader;
 
+		SkeletonData* readSkeletonData(const unsigned char* binary, int length, bool inPlace, bool ownsBinary);
+
 		void setError(const char* value1, const char* value2);
 
 		char* readString(DataInput* input);
 
 		char* readStringRef(DataInput* input, SkeletonData* skeletonData);
 
+		void setStringRef(DataInput* input, String& string, const char* value);
+
 		float readFloat(DataInput* input);
 
 		unsigned char readByte(DataInput* input);
@@ -118,6 +141,8 @@ namespace spine {
 
 		void readVertices(DataInput* input, VertexAttachment* attachment, int vertexCount);
 
+		void readFloats(DataInput *input, float* values, int n, float scale);
+
 		void readFloatArray(DataInput *input, int n, float scale, Vector<float>& array);
 
 		void readShortArray(DataInput *input, Vector<unsigned short>& array);
@@ -38,9 +38,17 @@ namespace spine {
 	class ClippingAttachment;
 
 	class SP_API SkeletonClipping : public SpineObject {
+		friend class ClippingAttachment;
+
 	public:
 		SkeletonClipping();
 
+		~SkeletonClipping();
+
+		/// Starts clipping with the clipping attachment's polygon. If the attachment is unweighted and the slot has no
+		/// deform, its cached convex polygons are transformed, see ClippingAttachment::updateConvexPolygons(). Otherwise
+		/// the world polygon is decomposed.
+		/// @return The number of convex polygons.
 		size_t clipStart(Slot& slot, ClippingAttachment* clip);
 
 		void clipEnd(Slot& slot);
@@ -51,12 +59,22 @@ namespace spine {
 
 		void clipTriangles(Vector<float>& vertices, Vector<unsigned short>& triangles, Vector<float>& uvs, size_t stride);
 
+		/// Clips triangles like clipTriangles(float*, unsigned short*, size_t, float*, size_t), also interpolating any number of
+		/// per vertex attributes, such as the light and dark colors used for two color tinting.
+		/// @param attributes attributeCount floats for each vertex, tightly packed.
+		/// @param attributeCount The number of floats per vertex in attributes and getClippedAttributes().
+		void clipTriangles(float* vertices, unsigned short* triangles, size_t trianglesLength, float* uvs, size_t stride,
+			float* attributes, size_t attributeCount);
+
 		bool isClipping();
 
 		Vector<float>& getClippedVertices();
 		Vector<unsigned short>& getClippedTriangles();
 		Vector<float>& getClippedUVs();
 
+		/// The attributes interpolated for each clipped vertex by the last clipTriangles() call given attributes.
+		Vector<float>& getClippedAttributes();
+
 	private:
 		Triangulator _triangulator;
 		Vector<float> _clippingPolygon;
@@ -64,13 +82,22 @@ namespace spine {
 		Vector<float> _clippedVertices;
 		Vector<unsigned short> _clippedTriangles;
 		Vector<float> _clippedUVs;
+		Vector<float> _clippedAttributes;
 		Vector<float> _scratch;
+		Vector<float> _vertexXs;
+		Vector<float> _vertexYs;
+		Vector<unsigned char> _insideFlags; // Per clipping polygon, 1 for each vertex strictly inside it.
 		ClippingAttachment* _clipAttachment;
 		Vector< Vector<float>* > *_clippingPolygons;
+		Vector< Vector<float>* > _transformedPolygons;
+		Vector< Vector<float>* > _polygonStorage;
+		Vector<float> _clippingBounds; // minX, minY, maxX, maxY of each clipping polygon.
 
-		/** Clips the input triangle against the convex, clockwise clipping area. If the triangle lies entirely within the clipping
-		  * area, false is returned. The clipping area must duplicate the first vertex at the end of the vertices list. */
-		bool clip(float x1, float y1, float x2, float y2, float x3, float y3, Vector<float>* clippingArea, Vector<float>* output);
+		/** Clips the input triangle against the convex, clockwise clipping area, which must duplicate the first vertex at the end
+		  * of the vertices list. Output and scratch must each hold clippingAreaLength + 6 floats.
+		  * @return The number of floats written to output, 0 if the triangle lies entirely outside the clipping area. */
+		static size_t clip(float x1, float y1, float x2, float y2, float x3, float y3, const float* clippingArea,
+			size_t clippingAreaLength, float* output, float* scratch);
 
 		static void makeClockwise(Vector<float>& polygon);
 	};
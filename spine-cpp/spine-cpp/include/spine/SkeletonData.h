@@ -32,6 +32,10 @@
 
 #include <spine/Vector.h>
 #include <spine/SpineString.h>
+#include <spine/Arena.h>
+#include <spine/Handle.h>
+#include <spine/NameIndex.h>
+#include <spine/Threading.h>
 
 namespace spine {
 class BoneData;
@@ -50,6 +54,8 @@ class TransformConstraintData;
 
 class PathConstraintData;
 
+class SkeletonUpdateOrder;
+
 /// Stores the setup pose and all of the stateless data for a skeleton.
 class SP_API SkeletonData : public SpineObject {
 	friend class SkeletonBinary;
@@ -63,8 +69,8 @@ public:
 
 	~SkeletonData();
 
-	/// Finds a bone by comparing each bone's name.
-	/// It is more efficient to cache the results of this method than to call it multiple times.
+	/// Finds a bone by name. Bones are found in constant time by the name index, see updateNameIndex(). Hot code can
+	/// find a BoneHandle once and use getBone() instead.
 	/// @return May be NULL.
 	BoneData *findBone(const String &boneName);
 
@@ -98,6 +104,54 @@ public:
 	/// @return -1 if the path constraint was not found.
 	int findPathConstraintIndex(const String &pathConstraintName);
 
+	/// Indexes the names of the items added since the last update, so find methods take constant time. Items added
+	/// later are still found by comparing their names. Called by SkeletonBinary and SkeletonJson; call again after adding
+	/// items, or after clearNameIndex() if items were removed, renamed or replaced.
+	void updateNameIndex();
+
+	void clearNameIndex();
+
+	/// The handle is invalid if the bone was not found.
+	BoneHandle findBoneHandle(const String &boneName);
+
+	SlotHandle findSlotHandle(const String &slotName);
+
+	SkinHandle findSkinHandle(const String &skinName);
+
+	EventHandle findEventHandle(const String &eventDataName);
+
+	AnimationHandle findAnimationHandle(const String &animationName);
+
+	IkConstraintHandle findIkConstraintHandle(const String &constraintName);
+
+	TransformConstraintHandle findTransformConstraintHandle(const String &constraintName);
+
+	PathConstraintHandle findPathConstraintHandle(const String &constraintName);
+
+	/// @return NULL if the handle is invalid.
+	BoneData *getBone(BoneHandle handle);
+
+	/// @return NULL if the handle is invalid.
+	SlotData *getSlot(SlotHandle handle);
+
+	/// @return NULL if the handle is invalid.
+	Skin *getSkin(SkinHandle handle);
+
+	/// @return NULL if the handle is invalid.
+	EventData *getEvent(EventHandle handle);
+
+	/// @return NULL if the handle is invalid.
+	Animation *getAnimation(AnimationHandle handle);
+
+	/// @return NULL if the handle is invalid.
+	IkConstraintData *getIkConstraint(IkConstraintHandle handle);
+
+	/// @return NULL if the handle is invalid.
+	TransformConstraintData *getTransformConstraint(TransformConstraintHandle handle);
+
+	/// @return NULL if the handle is invalid.
+	PathConstraintData *getPathConstraint(PathConstraintHandle handle);
+
 	const String &getName();
 
 	void setName(const String &inValue);
@@ -165,7 +219,43 @@ public:
 
 	void setFps(float inValue);
 
+	/// Assigns a handle to every distinct attachment name of each slot found in the skins, the slot setup pose and the
+	/// attachment timelines, and stores the handles in SlotData and AttachmentTimeline, so that Skeleton can cache
+	/// attachment lookups and posing does no string comparisons. Handles of a slot are consecutive. Called by SkeletonBinary
+	/// and SkeletonJson after loading; call again after adding skins, attachments or attachment timelines or changing
+	/// attachment timeline names, then set the skin of existing skeletons again to clear their cached attachments.
+	void updateAttachmentHandles();
+
+	/// @return -1 if the name has no handle for the slot.
+	int findAttachmentHandle(int slotIndex, const String &attachmentName);
+
+	size_t getAttachmentHandleCount();
+
+	int getAttachmentHandleSlot(int attachmentHandle);
+
+	const String &getAttachmentHandleName(int attachmentHandle);
+
+	/// The maximum number of update orders cached for distinct sets of active bones and constraints, see
+	/// Skeleton::updateCache(). When full, the oldest order is replaced. 0 sorts every time. Default is 64.
+	size_t getMaxUpdateOrders();
+
+	void setMaxUpdateOrders(size_t inValue);
+
+	/// Removes the cached update orders and sorts the constraints by their order again. Called by SkeletonBinary and
+	/// SkeletonJson after loading. Must be called after any edit of this data that affects the update order: changing bone
+	/// parents, the bones, targets or order of constraints, or adding or removing bones or constraints. Then call
+	/// Skeleton::updateCache() on existing skeletons. Skeletons created before constraints were added or removed keep their
+	/// own constraints and sort them without the cached orders. Skeleton::updateCache() also calls this itself if the number
+	/// of constraints changed. Changes to skins and their attachments, and to the targets and bones of a skeleton's
+	/// constraints, are detected.
+	void clearUpdateOrders();
+
+	/// The arena this data was loaded into, or NULL. See SkeletonBinary::setUseArena() and SkeletonJson::setUseArena().
+	/// Its used bytes are the memory owned by this data.
+	Arena *getArena();
+
 private:
+	ArenaHolder _arena; // Destroyed last.
 	String _name;
 	Vector<BoneData *> _bones; // Ordered parents first
 	Vector<SlotData *> _slots; // Setup pose draw order.
@@ -180,6 +270,29 @@ private:
 	String _version;
 	String _hash;
 	Vector<char*> _strings;
+	NameIndex _boneNames;
+	NameIndex _slotNames;
+	NameIndex _skinNames;
+	NameIndex _eventNames;
+	NameIndex _animationNames;
+	NameIndex _ikConstraintNames;
+	NameIndex _transformConstraintNames;
+	NameIndex _pathConstraintNames;
+	Vector<int> _slotAttachmentHandles; // First handle of each slot, followed by the handle count.
+	Vector<int> _attachmentHandleSlots;
+	Vector<String> _attachmentHandleNames;
+	Vector<SkeletonUpdateOrder *> _updateOrders;
+	size_t _maxUpdateOrders;
+	size_t _nextUpdateOrder; // Replaced next when the cache is full.
+	Vector<int> _constraintOrder; // Index << 2 | kind (1 IK, 2 transform, 3 path) of the constraint with each order, or -1.
+	Mutex _updateOrderMutex; // Guards _updateOrders and _constraintOrder for skeletons calling updateCache() on other threads.
+
+	/// Must be called with _updateOrderMutex held.
+	void updateConstraintOrder();
+
+	/// Removes the cached update orders and rebuilds the constraint order if constraints were added or removed since it was
+	/// built, so it never refers to missing constraints. Called by Skeleton::updateCache() with _updateOrderMutex held.
+	void validateConstraintOrder();
 
 	// Nonessential.
 	float _fps;
@@ -0,0 +1,125 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifndef Spine_SkeletonInstance_h
+#define Spine_SkeletonInstance_h
+
+#include <spine/Color.h>
+#include <spine/SpineObject.h>
+
+namespace spine {
+class SkeletonPoseCache;
+
+class SkeletonPose;
+
+class Animation;
+
+class Skin;
+
+/// A lightweight stand-in for a Skeleton playing a single animation, for drawing many identical characters.
+///
+/// An instance owns no bones, slots or constraints. It only stores its animation, time, skin, root transform and color,
+/// and takes its pose from a SkeletonPoseCache shared by all instances of the same SkeletonData. Renderers draw the slots
+/// of getPose() in its draw order, using computeWorldVertices() for positions and the instance color in place of the
+/// skeleton color.
+class SP_API SkeletonInstance : public SpineObject {
+public:
+	explicit SkeletonInstance(SkeletonPoseCache *cache);
+
+	/// Sets the animation and restarts it.
+	/// @param animation May be NULL for the setup pose.
+	void setAnimation(Animation *animation, bool loop);
+
+	Animation *getAnimation();
+
+	bool getLoop();
+
+	/// May be NULL to use only the default skin.
+	Skin *getSkin();
+
+	void setSkin(Skin *inValue);
+
+	/// Advances the animation time by delta multiplied by the time scale.
+	void update(float delta);
+
+	float getTime();
+
+	void setTime(float inValue);
+
+	float getTimeScale();
+
+	void setTimeScale(float inValue);
+
+	/// Returns the cached pose for the current animation time, evaluating it if needed.
+	SkeletonPose *getPose();
+
+	/// Transforms the pose's world vertices of a slot by the instance's root transform.
+	/// @param worldVertices Receives SkeletonPose::getVerticesLength() floats, starting at offset, stride floats per vertex.
+	void computeWorldVertices(SkeletonPose &pose, size_t slotIndex, float *worldVertices, size_t offset, size_t stride = 2);
+
+	SkeletonPoseCache *getCache();
+
+	float getX();
+
+	void setX(float inValue);
+
+	float getY();
+
+	void setY(float inValue);
+
+	void setPosition(float x, float y);
+
+	/// The rotation in degrees, applied after scaling.
+	float getRotation();
+
+	void setRotation(float inValue);
+
+	float getScaleX();
+
+	void setScaleX(float inValue);
+
+	float getScaleY();
+
+	void setScaleY(float inValue);
+
+	Color &getColor();
+
+private:
+	SkeletonPoseCache *_cache;
+	Animation *_animation;
+	Skin *_skin;
+	bool _loop;
+	float _time, _timeScale;
+	float _x, _y, _rotation, _scaleX, _scaleY;
+	Color _color;
+};
+}
+
+#endif /* Spine_SkeletonInstance_h */
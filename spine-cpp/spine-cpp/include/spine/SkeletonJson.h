@@ -30,6 +30,7 @@
 #ifndef Spine_SkeletonJson_h
 #define Spine_SkeletonJson_h
 
+#include <spine/CurveMode.h>
 #include <spine/Vector.h>
 #include <spine/SpineObject.h>
 #include <spine/SpineString.h>
@@ -67,18 +68,28 @@ public:
 
 	void setScale(float scale) { _scale = scale; }
 
+	/// If true, each SkeletonData is loaded into its own Arena, making loading faster and keeping the heap from
+	/// fragmenting. The data's vectors and strings must then not be resized or freed after loading, other than by
+	/// deleting the SkeletonData. Default is false.
+	void setUseArena(bool useArena) { _useArena = useArena; }
+
+	/// How bezier curves are stored in the timelines. Default is CurveMode_Sampled.
+	void setCurveMode(CurveMode curveMode) { _curveMode = curveMode; }
+
 	String &getError() { return _error; }
 
 private:
 	AttachmentLoader *_attachmentLoader;
 	Vector<LinkedMesh *> _linkedMeshes;
 	float _scale;
+	bool _useArena;
+	CurveMode _curveMode;
 	const bool _ownsLoader;
 	String _error;
 
 	static float toColor(const char *value, size_t index);
 
-	static void readCurve(Json *frame, CurveTimeline *timeline, size_t frameIndex);
+	void readCurve(Json *frame, CurveTimeline *timeline, size_t frameIndex);
 
 	Animation *readAnimation(Json *root, SkeletonData *skeletonData);
 
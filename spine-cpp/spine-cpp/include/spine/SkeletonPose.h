@@ -0,0 +1,90 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifndef Spine_SkeletonPose_h
+#define Spine_SkeletonPose_h
+
+#include <spine/Color.h>
+#include <spine/SpineObject.h>
+#include <spine/Vector.h>
+
+namespace spine {
+class Skeleton;
+
+class Attachment;
+
+/// An immutable world space pose of a skeleton, evaluated once by a SkeletonPoseCache and shared by every
+/// SkeletonInstance showing it. All positions are relative to the skeleton origin, without any root transform.
+class SP_API SkeletonPose : public SpineObject {
+	friend class SkeletonPoseCache;
+
+public:
+	SkeletonPose();
+
+	size_t getBoneCount();
+
+	/// The world transform of each bone as a, b, c, d, worldX, worldY.
+	Vector<float> &getBoneTransforms();
+
+	size_t getSlotCount();
+
+	/// The slot indices in the order the slots should be drawn.
+	Vector<int> &getDrawOrder();
+
+	/// The slot's attachment, or NULL.
+	Attachment *getAttachment(size_t slotIndex);
+
+	Color &getColor(size_t slotIndex);
+
+	/// The slot's dark color, only meaningful if the SlotData has one.
+	Color &getDarkColor(size_t slotIndex);
+
+	/// The number of floats of the slot's world vertices, or 0 if the attachment has none. Region attachments have 8, vertex
+	/// attachments VertexAttachment::getWorldVerticesLength().
+	size_t getVerticesLength(size_t slotIndex);
+
+	/// The world vertices of the slot's attachment as x, y pairs, including deform, or NULL if it has none.
+	float *getVertices(size_t slotIndex);
+
+private:
+	Vector<float> _boneTransforms;
+	Vector<int> _drawOrder;
+	Vector<Attachment *> _attachments;
+	Vector<Color> _colors;
+	Vector<Color> _darkColors;
+	Vector<size_t> _vertexOffsets; // One more than slots, the vertices of slot i end where those of slot i + 1 start.
+	Vector<float> _vertices;
+
+	/// Captures the skeleton's current world transforms and slot state.
+	void capture(Skeleton &skeleton);
+};
+}
+
+#endif /* Spine_SkeletonPose_h */
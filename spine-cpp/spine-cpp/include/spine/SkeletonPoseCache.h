@@ -0,0 +1,103 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifndef Spine_SkeletonPoseCache_h
+#define Spine_SkeletonPoseCache_h
+
+#include <spine/HashMap.h>
+#include <spine/SpineObject.h>
+
+namespace spine {
+class SkeletonData;
+
+class Skeleton;
+
+class Animation;
+
+class Skin;
+
+class SkeletonPose;
+
+/// Evaluates world space poses of one SkeletonData at quantized animation times and shares them between any number of
+/// SkeletonInstance objects.
+///
+/// A pose is keyed by animation, skin and time quantized to the cache's frame rate. It is evaluated on first use with a
+/// single Skeleton owned by the cache: setup pose, the skin, the animation applied with MixBlend_Setup and alpha 1, and
+/// Skeleton::updateWorldTransform(). Poses stay cached until clear() is called. A cache is not thread safe.
+class SP_API SkeletonPoseCache : public SpineObject {
+public:
+	/// @param framesPerSecond The number of distinct poses per second of animation.
+	explicit SkeletonPoseCache(SkeletonData *skeletonData, float framesPerSecond = 30);
+
+	~SkeletonPoseCache();
+
+	/// Returns the pose of the animation at the time, evaluating it if it was not cached yet. The time is wrapped to the
+	/// animation's duration if looping, else clamped to it, then rounded down to the frame rate.
+	/// @param animation May be NULL for the setup pose.
+	/// @param skin May be NULL to use only the default skin.
+	SkeletonPose *getPose(Animation *animation, float time, bool loop, Skin *skin);
+
+	/// Deletes all cached poses. Poses returned before become invalid.
+	void clear();
+
+	/// The number of cached poses.
+	size_t size();
+
+	SkeletonData *getSkeletonData();
+
+	float getFramesPerSecond();
+
+private:
+	struct Key {
+		Animation *animation;
+		Skin *skin;
+		int frame;
+
+		Key() : animation(NULL), skin(NULL), frame(0) {}
+
+		Key(Animation *inAnimation, Skin *inSkin, int inFrame) : animation(inAnimation), skin(inSkin), frame(inFrame) {}
+
+		bool operator==(const Key &other) const {
+			return animation == other.animation && skin == other.skin && frame == other.frame;
+		}
+
+		size_t hash() const {
+			return hashInteger(((size_t) animation >> 3) * 31 + ((size_t) skin >> 3) * 17 + (size_t) frame);
+		}
+	};
+
+	SkeletonData *_skeletonData;
+	Skeleton *_skeleton;
+	float _framesPerSecond;
+	HashMap<Key, SkeletonPose *> _poses;
+};
+}
+
+#endif /* Spine_SkeletonPoseCache_h */
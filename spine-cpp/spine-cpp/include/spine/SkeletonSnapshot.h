@@ -0,0 +1,117 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifndef Spine_SkeletonSnapshot_h
+#define Spine_SkeletonSnapshot_h
+
+#include <spine/SpineObject.h>
+
+#include <assert.h>
+#include <string.h>
+
+namespace spine {
+class Skeleton;
+
+class AnimationState;
+
+class TrackEntry;
+
+class Color;
+
+/// Captures the mutable state of a Skeleton and optionally its AnimationState into one flat buffer and restores it, for
+/// rollback networking and cloning.
+///
+/// The skeleton state is the bone local, applied and world transforms, slot attachments, colors, attachment state and
+/// deform, the draw order, skin, constraint mixes, color, position, scale and time. The animation state is the time scale
+/// and, for every track, the current entry with its mixing from chain and queued entries, including their times and
+/// mixing progress.
+///
+/// The buffer holds raw values and pointers to objects of the SkeletonData, the animations and listeners, so it is only
+/// valid in the process that captured it. It can be restored into the captured skeleton or any other skeleton of the
+/// same SkeletonData. The buffer is reused, so after the first capture and restore no memory is allocated, as long as
+/// deform and track entry counts don't grow.
+///
+/// Restoring an animation state replaces its track entries without raising events: TrackEntry pointers obtained before
+/// are invalid afterwards, and renderer objects of track entries are not restored. Capture and restore between frames,
+/// when no events are queued.
+class SP_API SkeletonSnapshot : public SpineObject {
+public:
+	SkeletonSnapshot();
+
+	~SkeletonSnapshot();
+
+	/// Captures the skeleton and, if not NULL, the animation state, replacing the previous contents.
+	void capture(Skeleton &skeleton, AnimationState *state = NULL);
+
+	/// Restores the captured state. The animation state must be NULL if none was captured.
+	void restore(Skeleton &skeleton, AnimationState *state = NULL);
+
+	/// The captured bytes.
+	const unsigned char *getData();
+
+	size_t size();
+
+private:
+	unsigned char *_buffer;
+	size_t _size;
+	size_t _capacity;
+	size_t _position;
+
+	void grow(size_t size);
+
+	template<typename T>
+	void write(const T &value) {
+		if (_size + sizeof(T) > _capacity) grow(sizeof(T));
+		memcpy(_buffer + _size, &value, sizeof(T));
+		_size += sizeof(T);
+	}
+
+	template<typename T>
+	void read(T &value) {
+		assert(_position + sizeof(T) <= _size);
+		memcpy(&value, _buffer + _position, sizeof(T));
+		_position += sizeof(T);
+	}
+
+	void writeFloats(const float *values, size_t count);
+
+	void readFloats(float *values, size_t count);
+
+	void writeColor(Color &color);
+
+	void readColor(Color &color);
+
+	void writeEntry(TrackEntry &entry);
+
+	TrackEntry *readEntry(AnimationState &state);
+};
+}
+
+#endif /* Spine_SkeletonSnapshot_h */
@@ -0,0 +1,54 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifndef Spine_SkeletonUpdateOrder_h
+#define Spine_SkeletonUpdateOrder_h
+
+#include <spine/Vector.h>
+
+namespace spine {
+/// An update order computed by Skeleton::updateCache() for one set of active bones and constraints. SkeletonData caches
+/// these so skeletons switching to a skin seen before copy the order instead of sorting again. Updatables are stored as
+/// indices, so an order is shared by all skeletons of the data.
+class SP_API SkeletonUpdateOrder : public SpineObject {
+	friend class Skeleton;
+
+	friend class SkeletonData;
+
+private:
+	size_t _hash;
+	Vector<unsigned int> _key; // See Skeleton::updateCacheKey().
+	Vector<int> _updateCache; // Bone index << 1, or constraint order << 1 | 1.
+	Vector<int> _updateCacheReset; // Bone indices.
+	Vector<unsigned int> _active; // Bits for each bone, then for each constraint by order.
+};
+}
+
+#endif /* Spine_SkeletonUpdateOrder_h */
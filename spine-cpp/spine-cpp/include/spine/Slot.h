@@ -80,6 +80,8 @@ class SP_API Slot : public SpineObject {
 
 	friend class TwoColorTimeline;
 
+	friend class SkeletonSnapshot;
+
 public:
 	Slot(SlotData &data, Bone &bone);
 
@@ -110,8 +112,17 @@ public:
 
 	void setAttachmentTime(float inValue);
 
+	/// The vertices set by a DeformTimeline, to be used instead of the attachment's vertices. If they are the keyframe
+	/// vertices of the timeline, see getDeformVertices(), they are copied into this vector first.
 	Vector<float> &getDeform();
 
+	/// The deform vertices without copying them, or NULL if there is no deform. A DeformTimeline applied with alpha 1 and a
+	/// blend other than MixBlend_Add points the slot at its keyframe vertices instead of copying them into getDeform().
+	const float *getDeformVertices();
+
+	/// The number of floats in getDeformVertices().
+	size_t getDeformLength();
+
 private:
 	SlotData &_data;
 	Bone &_bone;
@@ -123,6 +134,19 @@ private:
 	int _attachmentState;
 	float _attachmentTime;
 	Vector<float> _deform;
+	const float *_deformAlias; // Keyframe vertices used instead of _deform, or NULL.
+	size_t _deformAliasLength;
+
+	/// Points the deform at keyframe vertices, which must stay unchanged while the slot uses them.
+	void setDeformAlias(const float *vertices, size_t length);
+
+	/// Copies the aliased keyframe vertices into _deform, so they can be changed.
+	void copyDeformAlias();
+
+	/// Resizes _deform to length and returns it. If keep is false, aliased keyframe vertices are dropped instead of copied.
+	float *resizeDeform(size_t length, bool keep);
+
+	void clearDeform();
 };
 }
 
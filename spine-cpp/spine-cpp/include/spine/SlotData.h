@@ -71,6 +71,8 @@ class SP_API SlotData : public SpineObject {
 
 	friend class TwoColorTimeline;
 
+	friend class SkeletonData;
+
 public:
 	SlotData(int index, const String &name, BoneData &boneData);
 
@@ -93,6 +95,10 @@ public:
 
 	void setAttachmentName(const String &inValue);
 
+	/// The handle of the setup pose attachment name, see SkeletonData::updateAttachmentHandles(), or -1 if it has not
+	/// been assigned since the name was set.
+	int getAttachmentHandle();
+
 	BlendMode getBlendMode();
 
 	void setBlendMode(BlendMode inValue);
@@ -106,6 +112,7 @@ private:
 
 	bool _hasDarkColor;
 	String _attachmentName;
+	int _attachmentHandle;
 	BlendMode _blendMode;
 };
 }
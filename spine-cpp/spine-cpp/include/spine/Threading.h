@@ -0,0 +1,133 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifndef Spine_Threading_h
+#define Spine_Threading_h
+
+#include <spine/SpineObject.h>
+
+namespace spine {
+/// A mutual exclusion lock on top of pthreads or Win32. Does nothing when SPINE_NO_THREADS is defined.
+///
+/// The platform objects are allocated with malloc rather than through SpineExtension, so extensions can guard their
+/// own state with a Mutex.
+class SP_API Mutex : public SpineObject {
+	friend class Condition;
+
+public:
+	Mutex();
+
+	~Mutex();
+
+	void lock();
+
+	void unlock();
+
+private:
+	void *_handle;
+
+	Mutex(const Mutex &);
+
+	Mutex &operator=(const Mutex &);
+};
+
+/// Locks a mutex for the lifetime of the scope.
+class SP_API MutexLock {
+public:
+	explicit MutexLock(Mutex &mutex) : _mutex(mutex) {
+		_mutex.lock();
+	}
+
+	~MutexLock() {
+		_mutex.unlock();
+	}
+
+private:
+	Mutex &_mutex;
+
+	MutexLock(const MutexLock &);
+
+	MutexLock &operator=(const MutexLock &);
+};
+
+/// A condition variable to wait on while holding a Mutex.
+class SP_API Condition : public SpineObject {
+public:
+	Condition();
+
+	~Condition();
+
+	/// Atomically unlocks the mutex and waits until signalled, then locks the mutex again. May wake up spuriously, so
+	/// callers must wait in a loop that checks their condition.
+	void wait(Mutex &mutex);
+
+	/// Wakes up one waiting thread.
+	void signal();
+
+	/// Wakes up all waiting threads.
+	void broadcast();
+
+private:
+	void *_handle;
+
+	Condition(const Condition &);
+
+	Condition &operator=(const Condition &);
+};
+
+/// A thread of execution running a function. The destructor joins the thread if it is still running.
+class SP_API Thread : public SpineObject {
+public:
+	typedef void (*Function)(void *argument);
+
+	Thread();
+
+	~Thread();
+
+	/// Starts running the function on a new thread.
+	/// @return false if the thread could not be created or SPINE_NO_THREADS is defined.
+	bool start(Function function, void *argument);
+
+	/// Waits until the function has returned.
+	void join();
+
+	/// The number of processors available to the process, at least 1.
+	static int getProcessorCount();
+
+private:
+	void *_handle;
+
+	Thread(const Thread &);
+
+	Thread &operator=(const Thread &);
+};
+}
+
+#endif /* Spine_Threading_h */
@@ -42,6 +42,7 @@ namespace spine {
 	class SP_API TransformConstraint : public Updatable {
 		friend class Skeleton;
 		friend class TransformConstraintTimeline;
+		friend class SkeletonSnapshot;
 
 		RTTI_DECL
 
@@ -36,10 +36,15 @@
 #include <spine/TimelineType.h>
 
 namespace spine {
+	class Bone;
+
+	class QuantizedFrames;
 
 	class SP_API TranslateTimeline : public CurveTimeline {
 		friend class SkeletonBinary;
 		friend class SkeletonJson;
+		friend class BakedAnimation;
+		friend class Animation;
 
 		RTTI_DECL
 
@@ -54,6 +59,12 @@ namespace spine {
 
 		virtual int getPropertyId();
 
+		/// Applies keyframes laid out like this timeline's frames and curves, such as the streams of a BakedAnimation, to the
+		/// bone. The bone must be active.
+		/// @param cursor The keyframe cursor for Animation::search, may be NULL.
+		static void applyFrames(Bone &bone, const float *frames, int size, const float *curves, float time, float alpha,
+			MixBlend blend, MixDirection direction, int *cursor);
+
 		/// Sets the time and value of the specified keyframe.
 		void setFrame(int frameIndex, float time, float x, float y);
 
@@ -66,6 +77,7 @@ namespace spine {
 
 		Vector<float> _frames;
 		int _boneIndex;
+		QuantizedFrames *_quantized; // Replaces _frames after Animation::compress().
 	};
 }
 
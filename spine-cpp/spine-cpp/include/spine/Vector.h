@@ -64,6 +64,14 @@ public:
 		_size = 0;
 	}
 
+	/// Like clear(), but also frees the buffer.
+	inline void clearAndDeallocate() {
+		clear();
+		deallocate(_buffer);
+		_buffer = NULL;
+		_capacity = 0;
+	}
+
 	inline size_t getCapacity() const {
 		return _capacity;
 	}
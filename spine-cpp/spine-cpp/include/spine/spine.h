@@ -33,21 +33,25 @@
 #include <spine/Animation.h>
 #include <spine/AnimationState.h>
 #include <spine/AnimationStateData.h>
+#include <spine/Arena.h>
 #include <spine/Atlas.h>
 #include <spine/AtlasAttachmentLoader.h>
 #include <spine/Attachment.h>
 #include <spine/AttachmentLoader.h>
 #include <spine/AttachmentTimeline.h>
 #include <spine/AttachmentType.h>
+#include <spine/BakedAnimation.h>
 #include <spine/BlendMode.h>
 #include <spine/Bone.h>
 #include <spine/BoneData.h>
+#include <spine/BonePoseBuffer.h>
 #include <spine/BoundingBoxAttachment.h>
 #include <spine/ClippingAttachment.h>
 #include <spine/Color.h>
 #include <spine/ColorTimeline.h>
 #include <spine/ConstraintData.h>
 #include <spine/ContainerUtil.h>
+#include <spine/CurveMode.h>
 #include <spine/CurveTimeline.h>
 #include <spine/DeformTimeline.h>
 #include <spine/DrawOrderTimeline.h>
@@ -55,6 +59,7 @@
 #include <spine/EventData.h>
 #include <spine/EventTimeline.h>
 #include <spine/Extension.h>
+#include <spine/Handle.h>
 #include <spine/HashMap.h>
 #include <spine/HasRendererObject.h>
 #include <spine/IkConstraint.h>
@@ -66,6 +71,7 @@
 #include <spine/MeshAttachment.h>
 #include <spine/MixBlend.h>
 #include <spine/MixDirection.h>
+#include <spine/NameIndex.h>
 #include <spine/PathAttachment.h>
 #include <spine/PathConstraint.h>
 #include <spine/PathConstraintData.h>
@@ -75,18 +81,28 @@
 #include <spine/PointAttachment.h>
 #include <spine/Pool.h>
 #include <spine/PositionMode.h>
+#include <spine/ProfilingExtension.h>
+#include <spine/QuantizedFrames.h>
 #include <spine/RegionAttachment.h>
+#include <spine/RenderCommandBuilder.h>
 #include <spine/RotateMode.h>
 #include <spine/RotateTimeline.h>
 #include <spine/RTTI.h>
 #include <spine/ScaleTimeline.h>
 #include <spine/ShearTimeline.h>
+#include <spine/SimdUtil.h>
 #include <spine/Skeleton.h>
+#include <spine/SkeletonBatchUpdater.h>
 #include <spine/SkeletonBinary.h>
 #include <spine/SkeletonBounds.h>
 #include <spine/SkeletonClipping.h>
 #include <spine/SkeletonData.h>
+#include <spine/SkeletonInstance.h>
 #include <spine/SkeletonJson.h>
+#include <spine/SkeletonPose.h>
+#include <spine/SkeletonPoseCache.h>
+#include <spine/SkeletonSnapshot.h>
+#include <spine/SkeletonUpdateOrder.h>
 #include <spine/Skin.h>
 #include <spine/Slot.h>
 #include <spine/SlotData.h>
@@ -94,6 +110,7 @@
 #include <spine/SpineObject.h>
 #include <spine/SpineString.h>
 #include <spine/TextureLoader.h>
+#include <spine/Threading.h>
 #include <spine/Timeline.h>
 #include <spine/TimelineType.h>
 #include <spine/TransformConstraint.h>
@@ -32,11 +32,21 @@
 #endif
 
 #include <spine/Animation.h>
+#include <spine/Arena.h>
+#include <spine/BakedAnimation.h>
 #include <spine/Timeline.h>
 #include <spine/Skeleton.h>
 #include <spine/Event.h>
 
 #include <spine/ContainerUtil.h>
+#include <spine/DeformTimeline.h>
+#include <spine/MathUtil.h>
+#include <spine/QuantizedFrames.h>
+#include <spine/RotateTimeline.h>
+#include <spine/ScaleTimeline.h>
+#include <spine/ShearTimeline.h>
+#include <spine/TranslateTimeline.h>
+#include <spine/VertexAttachment.h>
 
 #include <stdint.h>
 
@@ -46,7 +56,11 @@ Animation::Animation(const String &name, Vector<Timeline *> &timelines, float du
 		_timelines(timelines),
 		_timelineIds(),
 		_duration(duration),
-		_name(name) {
+		_name(name),
+		_baked(NULL),
+		_compressed(false),
+		_compressionError(0),
+		_arena(Arena::getCurrent()) {
 	assert(_name.length() > 0);
 	for (int i = 0; i < (int)timelines.size(); i++)
 		_timelineIds.put(timelines[i]->getPropertyId(), true);
@@ -57,6 +71,7 @@ bool Animation::hasTimeline(int id) {
 }
 
 Animation::~Animation() {
+	delete _baked;
 	ContainerUtil::cleanUpVectorOfPointers(_timelines);
 }
 
@@ -91,9 +106,246 @@ void Animation::setDuration(float inValue) {
 	_duration = inValue;
 }
 
+void Animation::bake() {
+	delete _baked;
+	_baked = new(__FILE__, __LINE__) BakedAnimation(*this);
+}
+
+BakedAnimation *Animation::getBaked() {
+	return _baked;
+}
+
+/// Float arrays stored once each, found by hash.
+struct FloatPool {
+	Vector<float> values;
+	Vector<int> starts; // Start of each array in values.
+	Vector<int> counts;
+	Vector<uint32_t> hashes;
+	Vector<int> table; // Index + 1 of the arrays by hash, 0 if empty.
+};
+
+static uint32_t hashFloats(const float *values, int count) {
+	uint32_t hash = 2166136261u;
+	for (int i = 0; i < count; i++) {
+		uint32_t bits;
+		memcpy(&bits, values + i, sizeof(bits));
+		hash = (hash ^ bits) * 16777619u;
+	}
+	return hash;
+}
+
+static void insertFloats(FloatPool &pool, int index) {
+	size_t mask = pool.table.size() - 1;
+	size_t i = pool.hashes[index] & mask;
+	while (pool.table[i] != 0)
+		i = (i + 1) & mask;
+	pool.table[i] = index + 1;
+}
+
+/// Returns the start of the array in the pool's values, adding it if the pool doesn't have it yet.
+static int poolFloats(FloatPool &pool, const float *array, int count) {
+	uint32_t hash = hashFloats(array, count);
+	size_t mask = pool.table.size() - 1;
+	for (size_t i = hash & mask; pool.table.size() > 0 && pool.table[i] != 0; i = (i + 1) & mask) {
+		int index = pool.table[i] - 1;
+		if (pool.hashes[index] == hash && pool.counts[index] == count
+			&& memcmp(pool.values.buffer() + pool.starts[index], array, count * sizeof(float)) == 0)
+			return pool.starts[index];
+	}
+
+	int index = (int) pool.starts.size(), start = (int) pool.values.size();
+	pool.starts.add(start);
+	pool.counts.add(count);
+	pool.hashes.add(hash);
+	for (int i = 0; i < count; i++)
+		pool.values.add(array[i]);
+
+	// Keep the table at most half full.
+	if (pool.table.size() < pool.starts.size() * 2) {
+		size_t size = pool.table.size() == 0 ? 64 : pool.table.size() * 2;
+		pool.table.clear();
+		pool.table.setSize(size, 0);
+		for (int i = 0; i < index; i++)
+			insertFloats(pool, i);
+	}
+	insertFloats(pool, index);
+	return start;
+}
+
+/// Adds the start and count of each run of vertices that differ from the setup vertices, or from 0 if setup is NULL.
+/// Runs less than 3 vertices apart are joined, as a run takes the memory of 2 vertices.
+static void addChangedRuns(const float *vertices, const float *setup, int count, Vector<int> &runs) {
+	int runEnd = -3;
+	for (int i = 0; i < count; i++) {
+		if (vertices[i] == (setup ? setup[i] : 0)) continue;
+		if (i - runEnd < 3 && runs.size() > 0)
+			runs[runs.size() - 1] = i + 1 - runs[runs.size() - 2];
+		else {
+			runs.add(i);
+			runs.add(1);
+		}
+		runEnd = i + 1;
+	}
+}
+
+/// Frees the keyframes of a compressed timeline. Keyframes loaded into an arena are freed into the arena, which owns them
+/// and releases them when it is destroyed.
+template<typename T>
+static void releaseFrames(Vector<T> &frames, Arena *arena) {
+	ArenaScope arenaScope(arena);
+	frames.clearAndDeallocate();
+}
+
+void Animation::compress() {
+	if (_compressed) return;
+	_compressed = true;
+
+	// Pool the curves and the times of the keyframes first, the timelines point into the pools once they are complete.
+	const int bezierSize = CurveTimeline::BEZIER_SIZE;
+	FloatPool curves, times;
+	Vector<bool> compressed;
+	Vector<int> timeStarts;
+	Vector<float> keyTimes;
+	compressed.setSize(_timelines.size(), false);
+	timeStarts.setSize(_timelines.size(), -1);
+	for (size_t i = 0, n = _timelines.size(); i < n; i++) {
+		Timeline *timeline = _timelines[i];
+		const RTTI &rtti = timeline->getRTTI();
+		if (!rtti.instanceOf(CurveTimeline::rtti)) continue;
+		CurveTimeline *curveTimeline = static_cast<CurveTimeline *>(timeline);
+
+		size_t curveCount = curveTimeline->_curves.size() / bezierSize;
+		Vector<unsigned short> &curveIndices = curveTimeline->_curveIndices;
+		curveIndices.ensureCapacity(curveCount);
+		for (size_t ii = 0; ii < curveCount; ii++) {
+			int index = poolFloats(curves, curveTimeline->_curves.buffer() + ii * bezierSize, bezierSize) / bezierSize;
+			if (index > 65535) break;
+			curveIndices.add((unsigned short) index);
+		}
+		if (curveIndices.size() < curveCount) {
+			curveIndices.clearAndDeallocate();
+			continue;
+		}
+		compressed[i] = true;
+
+		const float *frames = NULL;
+		int frameCount = (int) curveCount + 1, entries = 0;
+		if (rtti.isExactly(RotateTimeline::rtti)) {
+			frames = static_cast<RotateTimeline *>(timeline)->_frames.buffer();
+			entries = RotateTimeline::ENTRIES;
+		} else if (rtti.isExactly(TranslateTimeline::rtti) || rtti.isExactly(ScaleTimeline::rtti) ||
+			rtti.isExactly(ShearTimeline::rtti)) {
+			frames = static_cast<TranslateTimeline *>(timeline)->_frames.buffer();
+			entries = TranslateTimeline::ENTRIES;
+		} else if (rtti.isExactly(DeformTimeline::rtti)) {
+			DeformTimeline *deformTimeline = static_cast<DeformTimeline *>(timeline);
+			Vector< Vector<float> > &frameVertices = deformTimeline->_frameVertices;
+			VertexAttachment *attachment = deformTimeline->_attachment;
+			size_t vertexCount = frameVertices[0].size();
+			bool sparse = attachment && vertexCount > 0
+				&& (attachment->getBones().size() > 0 || attachment->getVertices().size() == vertexCount);
+			for (size_t ii = 1; sparse && ii < frameVertices.size(); ii++)
+				sparse = frameVertices[ii].size() == vertexCount;
+			if (sparse) {
+				frames = deformTimeline->_frames.buffer();
+				entries = 1;
+			}
+		}
+		if (!frames || (frameCount < 2 && entries > 1)) continue;
+
+		keyTimes.clear();
+		for (int ii = 0; ii < frameCount; ii++)
+			keyTimes.add(frames[ii * entries]);
+		timeStarts[i] = poolFloats(times, keyTimes.buffer(), frameCount);
+	}
+	_compressedCurves.ensureCapacity(curves.values.size());
+	_compressedCurves.addAll(curves.values);
+	_compressedTimes.ensureCapacity(times.values.size());
+	_compressedTimes.addAll(times.values);
+
+	Vector<int> frameRuns, runs;
+	for (size_t i = 0, n = _timelines.size(); i < n; i++) {
+		if (!compressed[i]) continue;
+		Timeline *timeline = _timelines[i];
+		CurveTimeline *curveTimeline = static_cast<CurveTimeline *>(timeline);
+		if (curveTimeline->_curveIndices.size() > 0) {
+			curveTimeline->_curvePool = _compressedCurves.buffer();
+			releaseFrames(curveTimeline->_curves, _arena);
+		}
+		if (timeStarts[i] == -1) continue;
+
+		const float *frameTimes = _compressedTimes.buffer() + timeStarts[i];
+		int frameCount = (int) curveTimeline->getFrameCount();
+		const RTTI &rtti = timeline->getRTTI();
+		if (rtti.isExactly(RotateTimeline::rtti)) {
+			RotateTimeline *rotateTimeline = static_cast<RotateTimeline *>(timeline);
+			rotateTimeline->_quantized = new(__FILE__, __LINE__) QuantizedFrames(rotateTimeline->_frames.buffer(), frameCount,
+				RotateTimeline::ENTRIES, frameTimes);
+			_compressionError = MathUtil::max(_compressionError, rotateTimeline->_quantized->getMaxError());
+			releaseFrames(rotateTimeline->_frames, _arena);
+		} else if (rtti.isExactly(DeformTimeline::rtti)) {
+			DeformTimeline *deformTimeline = static_cast<DeformTimeline *>(timeline);
+			Vector< Vector<float> > &frameVertices = deformTimeline->_frameVertices;
+			VertexAttachment *attachment = deformTimeline->_attachment;
+			const float *setup = attachment->getBones().size() == 0 ? attachment->getVertices().buffer() : NULL;
+			int vertexCount = (int) frameVertices[0].size();
+
+			DeformTimeline::SparseFrames *sparse = new(__FILE__, __LINE__) DeformTimeline::SparseFrames();
+			sparse->times = frameTimes;
+			sparse->frameCount = frameCount;
+			sparse->vertexCount = vertexCount;
+			frameRuns.clear();
+			runs.clear();
+			int vertices = 0;
+			for (int frame = 0; frame < frameCount; frame++) {
+				size_t firstRun = runs.size();
+				frameRuns.add((int) (firstRun >> 1));
+				frameRuns.add(vertices);
+				addChangedRuns(frameVertices[frame].buffer(), setup, vertexCount, runs);
+				for (size_t ii = firstRun; ii < runs.size(); ii += 2)
+					vertices += runs[ii + 1];
+			}
+			frameRuns.add((int) (runs.size() >> 1));
+			frameRuns.add(vertices);
+			sparse->frameRuns.ensureCapacity(frameRuns.size());
+			sparse->frameRuns.addAll(frameRuns);
+			sparse->runs.ensureCapacity(runs.size());
+			sparse->runs.addAll(runs);
+			sparse->vertices.ensureCapacity(vertices);
+			for (int frame = 0; frame < frameCount; frame++) {
+				for (int ii = frameRuns[frame << 1], nn = frameRuns[(frame << 1) + 2]; ii < nn; ii++) {
+					const float *run = frameVertices[frame].buffer() + runs[ii << 1];
+					for (int iii = 0, count = runs[(ii << 1) + 1]; iii < count; iii++)
+						sparse->vertices.add(run[iii]);
+				}
+			}
+			deformTimeline->_sparse = sparse;
+			releaseFrames(deformTimeline->_frames, _arena);
+			releaseFrames(frameVertices, _arena);
+		} else {
+			TranslateTimeline *translateTimeline = static_cast<TranslateTimeline *>(timeline);
+			translateTimeline->_quantized = new(__FILE__, __LINE__) QuantizedFrames(translateTimeline->_frames.buffer(),
+				frameCount, TranslateTimeline::ENTRIES, frameTimes);
+			_compressionError = MathUtil::max(_compressionError, translateTimeline->_quantized->getMaxError());
+			releaseFrames(translateTimeline->_frames, _arena);
+		}
+	}
+}
+
+bool Animation::isCompressed() {
+	return _compressed;
+}
+
+float Animation::getCompressionError() {
+	return _compressionError;
+}
+
 int Animation::binarySearch(Vector<float> &values, float target, int step) {
+	return binarySearch(values.buffer(), (int)values.size(), target, step);
+}
+
+int Animation::binarySearch(const float *values, int size, float target, int step) {
 	int low = 0;
-	int size = (int)values.size();
 	int high = size / step - 2;
 	if (high == 0) {
 		return step;
@@ -112,6 +364,23 @@ int Animation::binarySearch(Vector<float> &values, float target, int step) {
 	}
 }
 
+int Animation::search(const float *values, int size, float target, int step, int *cursor) {
+	if (cursor == NULL) return binarySearch(values, size, target, step);
+
+	// Playback usually moves forward, so the entry is the previous one or shortly after it.
+	int i = *cursor;
+	if (i > 0 && i < size && values[i - step] <= target) {
+		for (int n = i + 4 * step; i < size && i < n; i += step) {
+			if (values[i] > target) {
+				*cursor = i;
+				return i;
+			}
+		}
+	}
+	*cursor = binarySearch(values, size, target, step);
+	return *cursor;
+}
+
 int Animation::binarySearch(Vector<float> &values, float target) {
 	int low = 0;
 	int size = (int)values.size();
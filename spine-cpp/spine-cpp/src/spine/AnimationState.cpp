@@ -33,6 +33,7 @@
 
 #include <spine/AnimationState.h>
 #include <spine/Animation.h>
+#include <spine/BakedAnimation.h>
 #include <spine/Event.h>
 #include <spine/AnimationStateData.h>
 #include <spine/Skeleton.h>
@@ -43,6 +44,8 @@
 #include <spine/AttachmentTimeline.h>
 #include <spine/DrawOrderTimeline.h>
 #include <spine/EventTimeline.h>
+#include <spine/ProfilingExtension.h>
+#include <spine/QuantizedFrames.h>
 #include <spine/Slot.h>
 #include <spine/SlotData.h>
 
@@ -183,11 +186,19 @@ void TrackEntry::reset() {
 	_timelineMode.clear();
 	_timelineHoldMix.clear();
 	_timelinesRotation.clear();
+	_timelineCursors.clear();
 
 	_listener = dummyOnAnimationEventFunc;
 	_listenerObject = NULL;
 }
 
+BakedAnimation *TrackEntry::getBaked() {
+	BakedAnimation *baked = _animation->_baked;
+	if (baked != NULL && _timelineCursors.size() != _animation->_timelines.size())
+		_timelineCursors.setSize(_animation->_timelines.size(), 0);
+	return baked;
+}
+
 EventQueueEntry::EventQueueEntry(EventType eventType, TrackEntry *trackEntry, Event *event) :
 		_type(eventType),
 		_entry(trackEntry),
@@ -202,38 +213,55 @@ EventQueueEntry EventQueue::newEventQueueEntry(EventType eventType, TrackEntry *
 	return EventQueueEntry(eventType, entry, event);
 }
 
-EventQueue::EventQueue(AnimationState &state, Pool<TrackEntry> &trackEntryPool) : _state(state),
+EventQueue::EventQueue(AnimationState &state, Pool<TrackEntry> &trackEntryPool) : _head(0),
+	_count(0),
+	_state(state),
 	_trackEntryPool(trackEntryPool),
-	_drainDisabled(false) {
+	_drainDisabled(false),
+	_batching(false) {
+	_eventQueueEntries.setSize(16, EventQueueEntry());
 }
 
 EventQueue::~EventQueue() {
 }
 
 void EventQueue::start(TrackEntry *entry) {
-	_eventQueueEntries.add(newEventQueueEntry(EventType_Start, entry));
+	add(EventType_Start, entry);
 	_state._animationsChanged = true;
 }
 
 void EventQueue::interrupt(TrackEntry *entry) {
-	_eventQueueEntries.add(newEventQueueEntry(EventType_Interrupt, entry));
+	add(EventType_Interrupt, entry);
 }
 
 void EventQueue::end(TrackEntry *entry) {
-	_eventQueueEntries.add(newEventQueueEntry(EventType_End, entry));
+	add(EventType_End, entry);
 	_state._animationsChanged = true;
 }
 
 void EventQueue::dispose(TrackEntry *entry) {
-	_eventQueueEntries.add(newEventQueueEntry(EventType_Dispose, entry));
+	add(EventType_Dispose, entry);
 }
 
 void EventQueue::complete(TrackEntry *entry) {
-	_eventQueueEntries.add(newEventQueueEntry(EventType_Complete, entry));
+	add(EventType_Complete, entry);
 }
 
 void EventQueue::event(TrackEntry *entry, Event *event) {
-	_eventQueueEntries.add(newEventQueueEntry(EventType_Event, entry, event));
+	add(EventType_Event, entry, event);
+}
+
+void EventQueue::add(EventType eventType, TrackEntry *entry, Event *event) {
+	size_t capacity = _eventQueueEntries.size();
+	if (_count == capacity) {
+		// Double the capacity and move the wrapped around entries behind the old end.
+		_eventQueueEntries.setSize(capacity << 1, EventQueueEntry());
+		for (size_t i = 0, n = _head + _count - capacity; i < n; i++)
+			_eventQueueEntries[capacity + i] = _eventQueueEntries[i];
+		capacity <<= 1;
+	}
+	_eventQueueEntries[(_head + _count) & (capacity - 1)] = EventQueueEntry(eventType, entry, event);
+	_count++;
 }
 
 /// Raises all events in the queue and drains the queue.
@@ -246,25 +274,34 @@ void EventQueue::drain() {
 
 	AnimationState &state = _state;
 
-	// Don't cache _eventQueueEntries.size() so callbacks can queue their own events (eg, call setAnimation in AnimationState_Complete).
-	for (size_t i = 0; i < _eventQueueEntries.size(); ++i) {
-		EventQueueEntry *queueEntry = &_eventQueueEntries[i];
-		TrackEntry *trackEntry = queueEntry->_entry;
+	// Callbacks can queue their own events (eg, call setAnimation in AnimationState_Complete), so the entry is copied out
+	// before it is raised.
+	while (_count > 0) {
+		EventQueueEntry queueEntry = _eventQueueEntries[_head];
+		_head = (_head + 1) & (_eventQueueEntries.size() - 1);
+		_count--;
+		TrackEntry *trackEntry = queueEntry._entry;
+
+		if (_batching) {
+			_batch.add(queueEntry);
+			if (queueEntry._type == EventType_End) _batch.add(EventQueueEntry(EventType_Dispose, trackEntry));
+			continue;
+		}
 
-		switch (queueEntry->_type) {
+		switch (queueEntry._type) {
 		case EventType_Start:
 		case EventType_Interrupt:
 		case EventType_Complete:
-			if (!trackEntry->_listenerObject) trackEntry->_listener(&state, queueEntry->_type, trackEntry, NULL);
-			else trackEntry->_listenerObject->callback(&state, queueEntry->_type, trackEntry, NULL);
-			if(!state._listenerObject) state._listener(&state, queueEntry->_type, trackEntry, NULL);
-			else state._listenerObject->callback(&state, queueEntry->_type, trackEntry, NULL);
+			if (!trackEntry->_listenerObject) trackEntry->_listener(&state, queueEntry._type, trackEntry, NULL);
+			else trackEntry->_listenerObject->callback(&state, queueEntry._type, trackEntry, NULL);
+			if(!state._listenerObject) state._listener(&state, queueEntry._type, trackEntry, NULL);
+			else state._listenerObject->callback(&state, queueEntry._type, trackEntry, NULL);
 			break;
 		case EventType_End:
-			if (!trackEntry->_listenerObject) trackEntry->_listener(&state, queueEntry->_type, trackEntry, NULL);
-			else trackEntry->_listenerObject->callback(&state, queueEntry->_type, trackEntry, NULL);
-			if (!state._listenerObject) state._listener(&state, queueEntry->_type, trackEntry, NULL);
-			else state._listenerObject->callback(&state, queueEntry->_type, trackEntry, NULL);
+			if (!trackEntry->_listenerObject) trackEntry->_listener(&state, queueEntry._type, trackEntry, NULL);
+			else trackEntry->_listenerObject->callback(&state, queueEntry._type, trackEntry, NULL);
+			if (!state._listenerObject) state._listener(&state, queueEntry._type, trackEntry, NULL);
+			else state._listenerObject->callback(&state, queueEntry._type, trackEntry, NULL);
 			/* Fall through. */
 		case EventType_Dispose:
 			if (!trackEntry->_listenerObject) trackEntry->_listener(&state, EventType_Dispose, trackEntry, NULL);
@@ -276,18 +313,28 @@ void EventQueue::drain() {
 			_trackEntryPool.free(trackEntry);
 			break;
 		case EventType_Event:
-			if (!trackEntry->_listenerObject) trackEntry->_listener(&state, queueEntry->_type, trackEntry, queueEntry->_event);
-			else trackEntry->_listenerObject->callback(&state, queueEntry->_type, trackEntry, queueEntry->_event);
-			if (!state._listenerObject) state._listener(&state, queueEntry->_type, trackEntry, queueEntry->_event);
-			else state._listenerObject->callback(&state, queueEntry->_type, trackEntry, queueEntry->_event);
+			if (!trackEntry->_listenerObject) trackEntry->_listener(&state, queueEntry._type, trackEntry, queueEntry._event);
+			else trackEntry->_listenerObject->callback(&state, queueEntry._type, trackEntry, queueEntry._event);
+			if (!state._listenerObject) state._listener(&state, queueEntry._type, trackEntry, queueEntry._event);
+			else state._listenerObject->callback(&state, queueEntry._type, trackEntry, queueEntry._event);
 			break;
 		}
 	}
-	_eventQueueEntries.clear();
+	_head = 0;
 
 	_drainDisabled = false;
 }
 
+void EventQueue::clearBatch() {
+	for (size_t i = 0, n = _batch.size(); i < n; i++) {
+		EventQueueEntry &queueEntry = _batch[i];
+		if (queueEntry._type != EventType_Dispose) continue;
+		queueEntry._entry->reset();
+		_trackEntryPool.free(queueEntry._entry);
+	}
+	_batch.clear();
+}
+
 const int Subsequent = 0;
 const int First = 1;
 const int HoldSubsequent = 2;
@@ -326,6 +373,7 @@ AnimationState::~AnimationState() {
 			delete entry;
 		}
 	}
+	_queue->clearBatch();
 	delete _queue;
 }
 
@@ -395,6 +443,7 @@ void AnimationState::update(float delta) {
 }
 
 bool AnimationState::apply(Skeleton &skeleton) {
+	SP_PROFILE_SCOPE("AnimationState::apply");
 	if (_animationsChanged) {
 		animationsChanged();
 	}
@@ -423,12 +472,13 @@ bool AnimationState::apply(Skeleton &skeleton) {
 		float animationLast = current._animationLast, animationTime = current.getAnimationTime();
 		size_t timelineCount = current._animation->_timelines.size();
 		Vector<Timeline *> &timelines = current._animation->_timelines;
+		BakedAnimation *baked = current.getBaked();
 		if ((i == 0 && mix == 1) || blend == MixBlend_Add) {
 			for (size_t ii = 0; ii < timelineCount; ++ii) {
                 Timeline *timeline = timelines[ii];
                 if (timeline->getRTTI().isExactly(AttachmentTimeline::rtti))
                     applyAttachmentTimeline(static_cast<AttachmentTimeline *>(timeline), skeleton, animationTime, blend, true);
-                else
+                else if (baked == NULL || !baked->applyTimeline(ii, skeleton, animationTime, mix, blend, MixDirection_In, current._timelineCursors))
                     timeline->apply(skeleton, animationLast, animationTime, &_events, mix, blend, MixDirection_In);
             }
 		} else {
@@ -445,10 +495,11 @@ bool AnimationState::apply(Skeleton &skeleton) {
 				MixBlend timelineBlend = timelineMode[ii] == Subsequent ? blend : MixBlend_Setup;
 
 				if (timeline->getRTTI().isExactly(RotateTimeline::rtti))
-					applyRotateTimeline(static_cast<RotateTimeline *>(timeline), skeleton, animationTime, mix, timelineBlend, timelinesRotation, ii << 1, firstFrame);
+					applyRotateTimeline(static_cast<RotateTimeline *>(timeline), skeleton, animationTime, mix, timelineBlend, timelinesRotation, ii << 1, firstFrame,
+						baked ? &current._timelineCursors[ii] : NULL);
 				else if (timeline->getRTTI().isExactly(AttachmentTimeline::rtti))
                     applyAttachmentTimeline(static_cast<AttachmentTimeline *>(timeline), skeleton, animationTime, timelineBlend, true);
-				else
+				else if (baked == NULL || !baked->applyTimeline(ii, skeleton, animationTime, mix, timelineBlend, MixDirection_In, current._timelineCursors))
 					timeline->apply(skeleton, animationLast, animationTime, &_events, mix, timelineBlend, MixDirection_In);
 			}
 		}
@@ -464,8 +515,8 @@ bool AnimationState::apply(Skeleton &skeleton) {
     for (int i = 0, n = slots.size(); i < n; i++) {
         Slot* slot = slots[i];
         if (slot->getAttachmentState() == setupState) {
-            const String& attachmentName = slot->getData().getAttachmentName();
-            slot->setAttachment(attachmentName.isEmpty() ? NULL : skeleton.getAttachment(slot->getData().getIndex(), attachmentName));
+            SlotData& slotData = slot->getData();
+            slot->setAttachment(skeleton.getAttachment(slotData.getIndex(), slotData.getAttachmentHandle(), slotData.getAttachmentName()));
         }
     }
     _unkeyedState += 2;
@@ -651,6 +702,23 @@ void AnimationState::enableQueue() {
 	_queue->_drainDisabled = false;
 }
 
+void AnimationState::setEventBatching(bool enabled) {
+	_queue->_batching = enabled;
+	if (!enabled) _queue->clearBatch();
+}
+
+bool AnimationState::isEventBatching() {
+	return _queue->_batching;
+}
+
+Vector<EventQueueEntry> &AnimationState::getEventBatch() {
+	return _queue->_batch;
+}
+
+void AnimationState::clearEventBatch() {
+	_queue->clearBatch();
+}
+
 Animation *AnimationState::getEmptyAnimation() {
 	static Vector<Timeline *> timelines;
 	static Animation ret(String("<empty>"), timelines, 0);
@@ -664,14 +732,14 @@ void AnimationState::applyAttachmentTimeline(AttachmentTimeline* attachmentTimel
     Vector<float>& frames = attachmentTimeline->getFrames();
     if (time < frames[0]) {
         if (blend == MixBlend_Setup || blend == MixBlend_First)
-            setAttachment(skeleton, *slot, slot->getData().getAttachmentName(), attachments);
+            setAttachment(skeleton, *slot, slot->getData().getAttachmentHandle(), slot->getData().getAttachmentName(), attachments);
     } else {
         int frameIndex = 0;
         if (time >= frames[attachmentTimeline->getFrames().size() - 1])
             frameIndex = attachmentTimeline->getFrames().size() - 1;
         else
             frameIndex = Animation::binarySearch(frames, time) - 1;
-        setAttachment(skeleton, *slot, attachmentTimeline->getAttachmentNames()[frameIndex], attachments);
+        setAttachment(skeleton, *slot, attachmentTimeline->getAttachmentHandles()[frameIndex], attachmentTimeline->getAttachmentNames()[frameIndex], attachments);
     }
 
     /* If an attachment wasn't set (ie before the first frame or attachments is false), set the setup attachment later.*/
@@ -680,18 +748,27 @@ void AnimationState::applyAttachmentTimeline(AttachmentTimeline* attachmentTimel
 
 
 void AnimationState::applyRotateTimeline(RotateTimeline *rotateTimeline, Skeleton &skeleton, float time, float alpha,
-	MixBlend blend, Vector<float> &timelinesRotation, size_t i, bool firstFrame
+	MixBlend blend, Vector<float> &timelinesRotation, size_t i, bool firstFrame, int *cursor
 ) {
 	if (firstFrame) timelinesRotation[i] = 0;
 
+	Bone *bone = skeleton._bones[rotateTimeline->_boneIndex];
+	if (!bone->isActive()) return;
+	const float *frames = rotateTimeline->_frames.buffer(), *curves = rotateTimeline->getCurves().buffer();
+	int size = (int) rotateTimeline->_frames.size();
+	float window[QuantizedFrames::MAX_WINDOW_SIZE];
+	if (rotateTimeline->_quantized) {
+		int windowFrame;
+		size = rotateTimeline->_quantized->decode(time, window, windowFrame);
+		frames = window;
+		curves = rotateTimeline->getCurve(windowFrame);
+		cursor = NULL;
+	}
+
 	if (alpha == 1) {
-		rotateTimeline->apply(skeleton, 0, time, NULL, 1, blend, MixDirection_In);
+		RotateTimeline::applyFrames(*bone, frames, size, curves, time, 1, blend, MixDirection_In, cursor);
 		return;
 	}
-
-	Bone *bone = skeleton._bones[rotateTimeline->_boneIndex];
-	if (!bone->isActive()) return;
-	Vector<float>& frames = rotateTimeline->_frames;
 	float r1, r2;
 	if (time < frames[0]) {
 		switch (blend) {
@@ -705,15 +782,15 @@ void AnimationState::applyRotateTimeline(RotateTimeline *rotateTimeline, Skeleto
 		}
 	} else {
 		r1 = blend == MixBlend_Setup ? bone->_data._rotation : bone->_rotation;
-		if (time >= frames[frames.size() - RotateTimeline::ENTRIES]) {
+		if (time >= frames[size - RotateTimeline::ENTRIES]) {
 			// Time is after last frame.
-			r2 = bone->_data._rotation + frames[frames.size() + RotateTimeline::PREV_ROTATION];
+			r2 = bone->_data._rotation + frames[size + RotateTimeline::PREV_ROTATION];
 		} else {
 			// Interpolate between the previous frame and the current frame.
-			int frame = Animation::binarySearch(frames, time, RotateTimeline::ENTRIES);
+			int frame = Animation::search(frames, size, time, RotateTimeline::ENTRIES, cursor);
 			float prevRotation = frames[frame + RotateTimeline::PREV_ROTATION];
 			float frameTime = frames[frame];
-			float percent = rotateTimeline->getCurvePercent((frame >> 1) - 1, 1 - (time - frameTime) / (frames[frame +
+			float percent = CurveTimeline::getCurvePercent(curves, (frame >> 1) - 1, 1 - (time - frameTime) / (frames[frame +
 				RotateTimeline::PREV_TIME] - frameTime));
 			r2 = frames[frame + RotateTimeline::ROTATION] - prevRotation;
 			r2 -= (16384 - (int) (16384.499999999996 - r2 / 360)) * 360;
@@ -808,10 +885,12 @@ float AnimationState::applyMixingFrom(TrackEntry *to, Skeleton &skeleton, MixBle
 	Vector<Timeline *> &timelines = from->_animation->_timelines;
 	size_t timelineCount = timelines.size();
 	float alphaHold = from->_alpha * to->_interruptAlpha, alphaMix = alphaHold * (1 - mix);
+	BakedAnimation *baked = from->getBaked();
 
 	if (blend == MixBlend_Add) {
 		for (size_t i = 0; i < timelineCount; i++)
-			timelines[i]->apply(skeleton, animationLast, animationTime, eventBuffer, alphaMix, blend, MixDirection_Out);
+			if (baked == NULL || !baked->applyTimeline(i, skeleton, animationTime, alphaMix, blend, MixDirection_Out, from->_timelineCursors))
+				timelines[i]->apply(skeleton, animationLast, animationTime, eventBuffer, alphaMix, blend, MixDirection_Out);
 	} else {
 		Vector<int> &timelineMode = from->_timelineMode;
 		Vector<TrackEntry *> &timelineHoldMix = from->_timelineHoldMix;
@@ -853,13 +932,15 @@ float AnimationState::applyMixingFrom(TrackEntry *to, Skeleton &skeleton, MixBle
 			}
 			from->_totalAlpha += alpha;
 			if ((timeline->getRTTI().isExactly(RotateTimeline::rtti))) {
-				applyRotateTimeline((RotateTimeline*)timeline, skeleton, animationTime, alpha, timelineBlend, timelinesRotation, i << 1, firstFrame);
+				applyRotateTimeline((RotateTimeline*)timeline, skeleton, animationTime, alpha, timelineBlend, timelinesRotation, i << 1, firstFrame,
+					baked ? &from->_timelineCursors[i] : NULL);
 			} else if (timeline->getRTTI().isExactly(AttachmentTimeline::rtti)) {
                 applyAttachmentTimeline(static_cast<AttachmentTimeline*>(timeline), skeleton, animationTime, timelineBlend, attachments);
             } else {
 			    if (drawOrder && timeline->getRTTI().isExactly(DrawOrderTimeline::rtti) && timelineBlend == MixBlend_Setup)
 			        direction = MixDirection_In;
-			    timeline->apply(skeleton, animationLast, animationTime, eventBuffer, alpha, timelineBlend, direction);
+			    if (baked == NULL || !baked->applyTimeline(i, skeleton, animationTime, alpha, timelineBlend, direction, from->_timelineCursors))
+			        timeline->apply(skeleton, animationLast, animationTime, eventBuffer, alpha, timelineBlend, direction);
 			}
 		}
 	}
@@ -875,8 +956,8 @@ float AnimationState::applyMixingFrom(TrackEntry *to, Skeleton &skeleton, MixBle
 	return mix;
 }
 
-void AnimationState::setAttachment(Skeleton& skeleton, Slot& slot, const String& attachmentName, bool attachments) {
-    slot.setAttachment(attachmentName.isEmpty() ? NULL : skeleton.getAttachment(slot.getData().getIndex(), attachmentName));
+void AnimationState::setAttachment(Skeleton& skeleton, Slot& slot, int attachmentHandle, const String& attachmentName, bool attachments) {
+    slot.setAttachment(skeleton.getAttachment(slot.getData().getIndex(), attachmentHandle, attachmentName));
     if (attachments) slot.setAttachmentState(_unkeyedState + Current);
 }
 
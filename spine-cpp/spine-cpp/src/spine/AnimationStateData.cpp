@@ -83,3 +83,9 @@ AnimationStateData::AnimationPair::AnimationPair(Animation *a1, Animation *a2) :
 bool AnimationStateData::AnimationPair::operator==(const AnimationPair &other) const {
 	return _a1->_name == other._a1->_name && _a2->_name == other._a2->_name;
 }
+
+size_t AnimationStateData::AnimationPair::hash() const {
+	size_t h1 = Hash<String>::hash(_a1->_name);
+	size_t h2 = Hash<String>::hash(_a2->_name);
+	return h1 ^ (h2 + 0x9E3779B9u + (h1 << 6) + (h1 >> 2));
+}
@@ -0,0 +1,207 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifdef SPINE_UE4
+#include "SpinePluginPrivatePCH.h"
+#endif
+
+#include <spine/Arena.h>
+#include <spine/Extension.h>
+
+#include <string.h>
+
+#if defined(SPINE_NO_THREADS)
+#define SPINE_THREAD_LOCAL
+#elif defined(_MSC_VER)
+#define SPINE_THREAD_LOCAL __declspec(thread)
+#else
+#define SPINE_THREAD_LOCAL __thread
+#endif
+
+using namespace spine;
+
+static const size_t MaxChunkSize = 256 * 1024;
+
+static SPINE_THREAD_LOCAL Arena *currentArena = NULL;
+
+static size_t align(size_t size) {
+	return (size + 7) & ~(size_t) 7;
+}
+
+Arena::Arena(size_t chunkSize) : _chunks(NULL), _regions(NULL), _chunkSize(align(chunkSize > 0 ? chunkSize : 1)), _last(NULL),
+								 _usedBytes(0), _reservedBytes(0), _allocationCount(0) {
+}
+
+Arena::~Arena() {
+	for (Region *region = _regions; region; region = region->next) {
+		if (region->owned) SpineExtension::getInstance()->_free(region->data, __FILE__, __LINE__);
+	}
+
+	Chunk *chunk = _chunks;
+	while (chunk) {
+		Chunk *next = chunk->next;
+		SpineExtension::getInstance()->_free(chunk, __FILE__, __LINE__);
+		chunk = next;
+	}
+}
+
+void *Arena::alloc(size_t size) {
+	if (size == 0) return NULL;
+	size = align(size);
+
+	Chunk *chunk = _chunks;
+	if (!chunk || chunk->used + size > chunk->size) {
+		if (chunk && size > _chunkSize / 4) {
+			// Large allocations get their own chunk behind the current one, so its remaining space is not wasted.
+			Chunk *dedicated = addChunk(size);
+			_chunks = dedicated->next;
+			dedicated->next = _chunks->next;
+			_chunks->next = dedicated;
+			chunk = dedicated;
+		} else {
+			chunk = addChunk(size > _chunkSize ? size : _chunkSize);
+			_chunkSize = _chunkSize * 2 < MaxChunkSize ? _chunkSize * 2 : MaxChunkSize;
+		}
+	}
+
+	void *ptr = chunk->data() + chunk->used;
+	chunk->used += size;
+	_usedBytes += size;
+	_allocationCount++;
+	_last = ptr;
+	return ptr;
+}
+
+void *Arena::calloc(size_t size) {
+	void *ptr = alloc(size);
+	if (ptr) memset(ptr, 0, size);
+	return ptr;
+}
+
+void *Arena::realloc(void *ptr, size_t size) {
+	if (!ptr) return alloc(size);
+	if (size == 0) {
+		free(ptr);
+		return NULL;
+	}
+
+	Chunk *chunk = findChunk(ptr);
+	if (!chunk) {
+		Region *region = findRegion(ptr);
+		size_t available = region->data + region->size - (char *) ptr;
+		void *result = alloc(size);
+		memcpy(result, ptr, size < available ? size : available);
+		return result;
+	}
+
+	size_t offset = (char *) ptr - chunk->data();
+	size_t newEnd = offset + align(size);
+	if (ptr == _last && chunk == _chunks && newEnd <= chunk->size) {
+		// The most recent allocation grows or shrinks in place.
+		_usedBytes = _usedBytes - chunk->used + newEnd;
+		chunk->used = newEnd;
+		return ptr;
+	}
+
+	// The old size is not stored, so everything up to the end of the chunk's used part is copied, which may include
+	// other allocations following the old one.
+	size_t available = chunk->used - offset;
+	void *result = alloc(size);
+	memcpy(result, ptr, size < available ? size : available);
+	return result;
+}
+
+void Arena::free(void *ptr) {
+	if (!ptr || ptr != _last) return;
+	Chunk *chunk = findChunk(ptr);
+	size_t offset = (char *) ptr - chunk->data();
+	_usedBytes -= chunk->used - offset;
+	chunk->used = offset;
+	_last = NULL;
+}
+
+void Arena::addRegion(void *ptr, size_t size, bool owned) {
+	Region *region = (Region *) alloc(sizeof(Region));
+	region->next = _regions;
+	region->data = (char *) ptr;
+	region->size = size;
+	region->owned = owned;
+	_regions = region;
+}
+
+bool Arena::owns(const void *ptr) const {
+	return findChunk(ptr) != NULL || findRegion(ptr) != NULL;
+}
+
+Arena *Arena::getCurrent() {
+	return currentArena;
+}
+
+void Arena::setCurrent(Arena *arena) {
+	currentArena = arena;
+}
+
+Arena::Chunk *Arena::findChunk(const void *ptr) const {
+	const char *p = (const char *) ptr;
+	for (Chunk *chunk = _chunks; chunk; chunk = chunk->next) {
+		if (p >= chunk->data() && p < chunk->data() + chunk->size) return chunk;
+	}
+	return NULL;
+}
+
+Arena::Region *Arena::findRegion(const void *ptr) const {
+	const char *p = (const char *) ptr;
+	for (Region *region = _regions; region; region = region->next) {
+		if (p >= region->data && p < region->data + region->size) return region;
+	}
+	return NULL;
+}
+
+Arena::Chunk *Arena::addChunk(size_t size) {
+	Chunk *chunk = (Chunk *) SpineExtension::getInstance()->_alloc(sizeof(Chunk) + size, __FILE__, __LINE__);
+	chunk->next = _chunks;
+	chunk->size = size;
+	chunk->used = 0;
+	_chunks = chunk;
+	_reservedBytes += sizeof(Chunk) + size;
+	return chunk;
+}
+
+ArenaHolder::~ArenaHolder() {
+	if (!_arena) return;
+	if (Arena::getCurrent() == _arena) Arena::setCurrent(_previous != _arena ? _previous : NULL);
+	delete _arena;
+}
+
+void ArenaHolder::beginDestruction() {
+	if (!_arena) return;
+	_previous = Arena::getCurrent();
+	Arena::setCurrent(_arena);
+}
@@ -89,9 +89,8 @@ void Atlas::flipV() {
 }
 
 AtlasRegion *Atlas::findRegion(const String &name) {
-	for (size_t i = 0, n = _regions.size(); i < n; ++i)
-		if (_regions[i]->name == name) return _regions[i];
-	return NULL;
+	int index = _regionNames.find(_regions, name);
+	return index == -1 ? NULL : _regions[index];
 }
 
 Vector<AtlasPage*> &Atlas::getPages() {
@@ -236,6 +235,7 @@ void Atlas::load(const char *begin, int length, const char *dir, bool createText
 			_regions.add(region);
 		}
 	}
+	_regionNames.update(_regions);
 }
 
 void Atlas::trim(Str *str) {
@@ -51,14 +51,15 @@ AttachmentTimeline::AttachmentTimeline(int frameCount) : Timeline(), _slotIndex(
 	_attachmentNames.ensureCapacity(frameCount);
 
 	_frames.setSize(frameCount, 0);
+	_attachmentHandles.setSize(frameCount, -1);
 
 	for (int i = 0; i < frameCount; ++i) {
 		_attachmentNames.add(String());
 	}
 }
 
-void AttachmentTimeline::setAttachment(Skeleton& skeleton, Slot& slot, String* attachmentName) {
-    slot.setAttachment(attachmentName == NULL || attachmentName->isEmpty() ? NULL : skeleton.getAttachment(_slotIndex, *attachmentName));
+void AttachmentTimeline::setAttachment(Skeleton& skeleton, Slot& slot, int attachmentHandle, const String& attachmentName) {
+    slot.setAttachment(skeleton.getAttachment((int) _slotIndex, attachmentHandle, attachmentName));
 }
 
 void AttachmentTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
@@ -70,20 +71,19 @@ void AttachmentTimeline::apply(Skeleton &skeleton, float lastTime, float time, V
 
 	assert(_slotIndex < skeleton._slots.size());
 
-	String *attachmentName;
 	Slot *slotP = skeleton._slots[_slotIndex];
 	Slot &slot = *slotP;
 	if (!slot._bone.isActive()) return;
 
 	if (direction == MixDirection_Out) {
-	    if (blend == MixBlend_Setup) setAttachment(skeleton, slot, &slot._data._attachmentName);
+	    if (blend == MixBlend_Setup) setAttachment(skeleton, slot, slot._data._attachmentHandle, slot._data._attachmentName);
 		return;
 	}
 
 	if (time < _frames[0]) {
 		// Time is before first frame.
 		if (blend == MixBlend_Setup || blend == MixBlend_First) {
-            setAttachment(skeleton, slot, &slot._data._attachmentName);
+            setAttachment(skeleton, slot, slot._data._attachmentHandle, slot._data._attachmentName);
 		}
 		return;
 	}
@@ -96,8 +96,7 @@ void AttachmentTimeline::apply(Skeleton &skeleton, float lastTime, float time, V
 		frameIndex = Animation::binarySearch(_frames, time, 1) - 1;
 	}
 
-	attachmentName = &_attachmentNames[frameIndex];
-	slot.setAttachment(attachmentName->length() == 0 ? NULL : skeleton.getAttachment(_slotIndex, *attachmentName));
+	setAttachment(skeleton, slot, _attachmentHandles[frameIndex], _attachmentNames[frameIndex]);
 }
 
 int AttachmentTimeline::getPropertyId() {
@@ -107,6 +106,7 @@ int AttachmentTimeline::getPropertyId() {
 void AttachmentTimeline::setFrame(int frameIndex, float time, const String &attachmentName) {
 	_frames[frameIndex] = time;
 	_attachmentNames[frameIndex] = attachmentName;
+	_attachmentHandles[frameIndex] = -1;
 }
 
 size_t AttachmentTimeline::getSlotIndex() {
@@ -125,6 +125,10 @@ Vector<String> &AttachmentTimeline::getAttachmentNames() {
 	return _attachmentNames;
 }
 
+Vector<int> &AttachmentTimeline::getAttachmentHandles() {
+	return _attachmentHandles;
+}
+
 size_t AttachmentTimeline::getFrameCount() {
 	return _frames.size();
 }
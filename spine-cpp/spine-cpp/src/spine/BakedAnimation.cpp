@@ -0,0 +1,146 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifdef SPINE_UE4
+#include "SpinePluginPrivatePCH.h"
+#endif
+
+#include <spine/BakedAnimation.h>
+
+#include <spine/Animation.h>
+#include <spine/Bone.h>
+#include <spine/MathUtil.h>
+#include <spine/RotateTimeline.h>
+#include <spine/ScaleTimeline.h>
+#include <spine/ShearTimeline.h>
+#include <spine/Skeleton.h>
+#include <spine/TranslateTimeline.h>
+
+using namespace spine;
+
+BakedAnimation::BakedAnimation(Animation &animation) : _animation(animation), _bakedCount(0) {
+	_streams[StreamType_Rotate].applyFrames = RotateTimeline::applyFrames;
+	_streams[StreamType_Translate].applyFrames = TranslateTimeline::applyFrames;
+	_streams[StreamType_Scale].applyFrames = ScaleTimeline::applyFrames;
+	_streams[StreamType_Shear].applyFrames = ShearTimeline::applyFrames;
+
+	Vector<Timeline *> &timelines = animation._timelines;
+	_timelineStreams.setSize(timelines.size(), -1);
+	_timelineEntries.setSize(timelines.size(), -1);
+	for (size_t i = 0, n = timelines.size(); i < n; i++) {
+		Timeline *timeline = timelines[i];
+		const RTTI &rtti = timeline->getRTTI();
+		if (rtti.instanceOf(CurveTimeline::rtti) && static_cast<CurveTimeline *>(timeline)->isCompressed()) {
+			// The keyframes are decoded as they are applied, see Animation::compress().
+			_unbaked.add(timeline);
+		} else if (rtti.isExactly(RotateTimeline::rtti)) {
+			RotateTimeline *rotate = static_cast<RotateTimeline *>(timeline);
+			add(StreamType_Rotate, i, rotate->_boneIndex, rotate->_frames, rotate->getCurves());
+		} else if (rtti.isExactly(TranslateTimeline::rtti)) {
+			TranslateTimeline *translate = static_cast<TranslateTimeline *>(timeline);
+			add(StreamType_Translate, i, translate->_boneIndex, translate->_frames, translate->getCurves());
+		} else if (rtti.isExactly(ScaleTimeline::rtti)) {
+			TranslateTimeline *scale = static_cast<TranslateTimeline *>(timeline);
+			add(StreamType_Scale, i, scale->_boneIndex, scale->_frames, scale->getCurves());
+		} else if (rtti.isExactly(ShearTimeline::rtti)) {
+			TranslateTimeline *shear = static_cast<TranslateTimeline *>(timeline);
+			add(StreamType_Shear, i, shear->_boneIndex, shear->_frames, shear->getCurves());
+		} else
+			_unbaked.add(timeline);
+	}
+}
+
+void BakedAnimation::add(StreamType type, size_t timelineIndex, int boneIndex, Vector<float> &frames, Vector<float> &curves) {
+	Stream &stream = _streams[type];
+	Entry entry;
+	entry.timeline = (int) timelineIndex;
+	entry.bone = boneIndex;
+	entry.frames = (int) stream.frames.size();
+	entry.size = (int) frames.size();
+	entry.curves = (int) stream.curves.size();
+	_timelineStreams[timelineIndex] = type;
+	_timelineEntries[timelineIndex] = (int) stream.entries.size();
+	stream.entries.add(entry);
+	stream.frames.addAll(frames);
+	stream.curves.addAll(curves);
+	_bakedCount++;
+}
+
+void BakedAnimation::apply(Skeleton &skeleton, float lastTime, float time, bool loop, Vector<Event *> *pEvents,
+	float alpha, MixBlend blend, MixDirection direction, Vector<int> &cursors
+) {
+	float duration = _animation._duration;
+	if (loop && duration != 0) {
+		time = MathUtil::fmod(time, duration);
+		if (lastTime > 0) {
+			lastTime = MathUtil::fmod(lastTime, duration);
+		}
+	}
+
+	if (cursors.size() != _timelineStreams.size()) cursors.setSize(_timelineStreams.size(), 0);
+
+	// Bone timelines each set different bone properties that other timelines don't read, so applying them first gives the
+	// same pose as applying all timelines in their original order.
+	for (int i = 0; i < StreamType_Count; i++) {
+		Stream &stream = _streams[i];
+		for (size_t ii = 0, n = stream.entries.size(); ii < n; ii++)
+			apply(stream, stream.entries[ii], skeleton, time, alpha, blend, direction, cursors);
+	}
+
+	for (size_t i = 0, n = _unbaked.size(); i < n; i++)
+		_unbaked[i]->apply(skeleton, lastTime, time, pEvents, alpha, blend, direction);
+}
+
+bool BakedAnimation::applyTimeline(size_t timelineIndex, Skeleton &skeleton, float time, float alpha, MixBlend blend,
+	MixDirection direction, Vector<int> &cursors
+) {
+	int type = _timelineStreams[timelineIndex];
+	if (type == -1) return false;
+	Stream &stream = _streams[type];
+	apply(stream, stream.entries[_timelineEntries[timelineIndex]], skeleton, time, alpha, blend, direction, cursors);
+	return true;
+}
+
+void BakedAnimation::apply(Stream &stream, Entry &entry, Skeleton &skeleton, float time, float alpha, MixBlend blend,
+	MixDirection direction, Vector<int> &cursors
+) {
+	Bone *bone = skeleton.getBones()[entry.bone];
+	if (!bone->isActive()) return;
+	stream.applyFrames(*bone, stream.frames.buffer() + entry.frames, entry.size, stream.curves.buffer() + entry.curves,
+		time, alpha, blend, direction, &cursors[entry.timeline]);
+}
+
+Animation &BakedAnimation::getAnimation() {
+	return _animation;
+}
+
+size_t BakedAnimation::getBakedTimelineCount() {
+	return _bakedCount;
+}
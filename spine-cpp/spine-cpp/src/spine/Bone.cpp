@@ -107,10 +107,13 @@ void Bone::updateWorldTransform(float x, float y, float rotation, float scaleX,
 		float rotationY = rotation + 90 + shearY;
 		float sx = _skeleton.getScaleX();
 		float sy = _skeleton.getScaleY();
-		_a = MathUtil::cosDeg(rotation + shearX) * scaleX * sx;
-		_b = MathUtil::cosDeg(rotationY) * scaleY * sx;
-		_c = MathUtil::sinDeg(rotation + shearX) * scaleX * sy;
-		_d = MathUtil::sinDeg(rotationY) * scaleY * sy;
+		float sinX, cosX, sinY, cosY;
+		MathUtil::sinCosDeg(rotation + shearX, sinX, cosX);
+		MathUtil::sinCosDeg(rotationY, sinY, cosY);
+		_a = cosX * scaleX * sx;
+		_b = cosY * scaleY * sx;
+		_c = sinX * scaleX * sy;
+		_d = sinY * scaleY * sy;
 		_worldX = x * sx + _skeleton.getX();
 		_worldY = y * sy + _skeleton.getY();
 		return;
@@ -127,10 +130,13 @@ void Bone::updateWorldTransform(float x, float y, float rotation, float scaleX,
 	switch (_data.getTransformMode()) {
 	case TransformMode_Normal: {
 		float rotationY = rotation + 90 + shearY;
-		float la = MathUtil::cosDeg(rotation + shearX) * scaleX;
-		float lb = MathUtil::cosDeg(rotationY) * scaleY;
-		float lc = MathUtil::sinDeg(rotation + shearX) * scaleX;
-		float ld = MathUtil::sinDeg(rotationY) * scaleY;
+		float sinX, cosX, sinY, cosY;
+		MathUtil::sinCosDeg(rotation + shearX, sinX, cosX);
+		MathUtil::sinCosDeg(rotationY, sinY, cosY);
+		float la = cosX * scaleX;
+		float lb = cosY * scaleY;
+		float lc = sinX * scaleX;
+		float ld = sinY * scaleY;
 		_a = pa * la + pb * lc;
 		_b = pa * lb + pb * ld;
 		_c = pc * la + pd * lc;
@@ -139,15 +145,18 @@ void Bone::updateWorldTransform(float x, float y, float rotation, float scaleX,
 	}
 	case TransformMode_OnlyTranslation: {
 		float rotationY = rotation + 90 + shearY;
-		_a = MathUtil::cosDeg(rotation + shearX) * scaleX;
-		_b = MathUtil::cosDeg(rotationY) * scaleY;
-		_c = MathUtil::sinDeg(rotation + shearX) * scaleX;
-		_d = MathUtil::sinDeg(rotationY) * scaleY;
+		float sinX, cosX, sinY, cosY;
+		MathUtil::sinCosDeg(rotation + shearX, sinX, cosX);
+		MathUtil::sinCosDeg(rotationY, sinY, cosY);
+		_a = cosX * scaleX;
+		_b = cosY * scaleY;
+		_c = sinX * scaleX;
+		_d = sinY * scaleY;
 		break;
 	}
 	case TransformMode_NoRotationOrReflection: {
 		float s = pa * pa + pc * pc;
-		float prx, rx, ry, la, lb, lc, ld;
+		float prx, rx, ry, la, lb, lc, ld, sinX, cosX, sinY, cosY;
 		if (s > 0.0001f) {
 			s = MathUtil::abs(pa * pd - pb * pc) / s;
             pa /= _skeleton.getScaleX();
@@ -162,10 +171,12 @@ void Bone::updateWorldTransform(float x, float y, float rotation, float scaleX,
 		}
 		rx = rotation + shearX - prx;
 		ry = rotation + shearY - prx + 90;
-		la = MathUtil::cosDeg(rx) * scaleX;
-		lb = MathUtil::cosDeg(ry) * scaleY;
-		lc = MathUtil::sinDeg(rx) * scaleX;
-		ld = MathUtil::sinDeg(ry) * scaleY;
+		MathUtil::sinCosDeg(rx, sinX, cosX);
+		MathUtil::sinCosDeg(ry, sinY, cosY);
+		la = cosX * scaleX;
+		lb = cosY * scaleY;
+		lc = sinX * scaleX;
+		ld = sinY * scaleY;
 		_a = pa * la - pb * lc;
 		_b = pa * lb - pb * ld;
 		_c = pc * la + pd * lc;
@@ -175,9 +186,8 @@ void Bone::updateWorldTransform(float x, float y, float rotation, float scaleX,
 	case TransformMode_NoScale:
 	case TransformMode_NoScaleOrReflection: {
 		float za, zc, s;
-		float r, zb, zd, la, lb, lc, ld;
-		cosine = MathUtil::cosDeg(rotation);
-		sine = MathUtil::sinDeg(rotation);
+		float r, zb, zd, la, lb, lc, ld, sinX, cosX, sinY, cosY;
+		MathUtil::sinCosDeg(rotation, sine, cosine);
 		za = (pa * cosine + pb * sine) / _skeleton.getScaleX();
 		zc = (pc * cosine + pd * sine) / _skeleton.getScaleY();
 		s = MathUtil::sqrt(za * za + zc * zc);
@@ -189,12 +199,15 @@ void Bone::updateWorldTransform(float x, float y, float rotation, float scaleX,
 			&& (pa * pd - pb * pc < 0) != (_skeleton.getScaleX() < 0 != _skeleton.getScaleY() < 0))
 			s = -s;
 		r = MathUtil::Pi / 2 + MathUtil::atan2(zc, za);
-		zb = MathUtil::cos(r) * s;
-		zd = MathUtil::sin(r) * s;
-		la = MathUtil::cosDeg(shearX) * scaleX;
-		lb = MathUtil::cosDeg(90 + shearY) * scaleY;
-		lc = MathUtil::sinDeg(shearX) * scaleX;
-		ld = MathUtil::sinDeg(90 + shearY) * scaleY;
+		MathUtil::sinCos(r, zd, zb);
+		zb *= s;
+		zd *= s;
+		MathUtil::sinCosDeg(shearX, sinX, cosX);
+		MathUtil::sinCosDeg(90 + shearY, sinY, cosY);
+		la = cosX * scaleX;
+		lb = cosY * scaleY;
+		lc = sinX * scaleX;
+		ld = sinY * scaleY;
 		_a = za * la + zb * lc;
 		_b = za * lb + zb * ld;
 		_c = zc * la + zd * lc;
@@ -239,16 +252,16 @@ void Bone::localToWorld(float localX, float localY, float &outWorldX, float &out
 }
 
 float Bone::worldToLocalRotation(float worldRotation) {
-	float sin = MathUtil::sinDeg(worldRotation);
-	float cos = MathUtil::cosDeg(worldRotation);
+	float sin, cos;
+	MathUtil::sinCosDeg(worldRotation, sin, cos);
 
 	return MathUtil::atan2(_a * sin - _c * cos, _d * cos - _b * sin) * MathUtil::Rad_Deg + this->_rotation - this->_shearX;
 }
 
 float Bone::localToWorldRotation(float localRotation) {
 	localRotation -= this->_rotation - this->_shearX;
-	float sin = MathUtil::sinDeg(localRotation);
-	float cos = MathUtil::cosDeg(localRotation);
+	float sin, cos;
+	MathUtil::sinCosDeg(localRotation, sin, cos);
 
 	return MathUtil::atan2(cos * _c + sin * _d, cos * _a + sin * _b) * MathUtil::Rad_Deg;
 }
@@ -259,8 +272,8 @@ void Bone::rotateWorld(float degrees) {
 	float c = _c;
 	float d = _d;
 
-	float cos = MathUtil::cosDeg(degrees);
-	float sin = MathUtil::sinDeg(degrees);
+	float sin, cos;
+	MathUtil::sinCosDeg(degrees, sin, cos);
 
 	_a = cos * a - sin * c;
 	_b = cos * b - sin * d;
@@ -0,0 +1,247 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifdef SPINE_UE4
+#include "SpinePluginPrivatePCH.h"
+#endif
+
+#include <spine/BonePoseBuffer.h>
+
+#include <spine/Bone.h>
+#include <spine/BoneData.h>
+#include <spine/Skeleton.h>
+#include <spine/Updatable.h>
+
+using namespace spine;
+
+const int BonePoseBuffer::ParentExternal;
+const int BonePoseBuffer::ParentNone;
+
+BonePoseBuffer::BonePoseBuffer() {
+}
+
+void BonePoseBuffer::build(Skeleton &skeleton) {
+	Vector<Updatable *> &updateCache = skeleton._updateCache;
+
+	_runs.clear();
+	_bones.clear();
+	_parents.clear();
+	_slotOfBone.clear();
+	_slotOfBone.setSize(skeleton._bones.size(), ParentExternal);
+
+	bool inRun = false;
+	Run run;
+	for (size_t i = 0, n = updateCache.size(); i < n; i++) {
+		Updatable *updatable = updateCache[i];
+		Bone *bone = updatable->getRTTI().isExactly(Bone::rtti) ? static_cast<Bone *>(updatable) : NULL;
+		if (bone == NULL || (bone->_parent != NULL && bone->_data.getTransformMode() != TransformMode_Normal)) {
+			if (inRun) {
+				run.end = i;
+				_runs.add(run);
+				inRun = false;
+			}
+			continue;
+		}
+
+		if (!inRun) {
+			run = Run(i, i, _bones.size());
+			inRun = true;
+		}
+
+		// Slots only increase, so the parent's latest slot is inside this run if it is not before the run's first slot.
+		int slot = (int) _bones.size();
+		int parent = ParentNone;
+		if (bone->_parent != NULL) {
+			parent = _slotOfBone[bone->_parent->_data.getIndex()];
+			if (parent < (int) run.slot) parent = ParentExternal;
+		}
+		_bones.add(bone);
+		_parents.add(parent);
+		_slotOfBone[bone->_data.getIndex()] = slot;
+	}
+	if (inRun) {
+		run.end = updateCache.size();
+		_runs.add(run);
+	}
+
+	size_t size = _bones.size();
+	_x.setSize(size, 0);
+	_y.setSize(size, 0);
+	_rotation.setSize(size, 0);
+	_scaleX.setSize(size, 0);
+	_scaleY.setSize(size, 0);
+	_shearX.setSize(size, 0);
+	_shearY.setSize(size, 0);
+	_a.setSize(size, 0);
+	_b.setSize(size, 0);
+	_c.setSize(size, 0);
+	_d.setSize(size, 0);
+	_worldX.setSize(size, 0);
+	_worldY.setSize(size, 0);
+}
+
+void BonePoseBuffer::updateWorldTransform(Skeleton &skeleton) {
+	Vector<Updatable *> &updateCache = skeleton._updateCache;
+	size_t i = 0;
+	for (size_t r = 0, n = _runs.size(); r < n; r++) {
+		Run &run = _runs[r];
+		for (; i < run.start; i++)
+			updateCache[i]->update();
+		solve(skeleton, run);
+		i = run.end;
+	}
+	for (size_t n = updateCache.size(); i < n; i++)
+		updateCache[i]->update();
+}
+
+void BonePoseBuffer::solve(Skeleton &skeleton, const Run &run) {
+	size_t first = run.slot, last = run.slot + (run.end - run.start);
+	Bone **bones = _bones.buffer();
+	int *parents = _parents.buffer();
+	float *x = _x.buffer(), *y = _y.buffer(), *rotation = _rotation.buffer();
+	float *scaleX = _scaleX.buffer(), *scaleY = _scaleY.buffer(), *shearX = _shearX.buffer(), *shearY = _shearY.buffer();
+	float *a = _a.buffer(), *b = _b.buffer(), *c = _c.buffer(), *d = _d.buffer();
+	float *worldX = _worldX.buffer(), *worldY = _worldY.buffer();
+
+	for (size_t i = first; i < last; i++) {
+		Bone &bone = *bones[i];
+		x[i] = bone._x;
+		y[i] = bone._y;
+		rotation[i] = bone._rotation;
+		scaleX[i] = bone._scaleX;
+		scaleY[i] = bone._scaleY;
+		shearX[i] = bone._shearX;
+		shearY[i] = bone._shearY;
+	}
+
+	// Local rotation and scale only depend on the bone itself, so they are computed up front in a pass without
+	// dependencies between iterations. a, b, c, d temporarily hold the local la, lb, lc, ld.
+	for (size_t i = first; i < last; i++) {
+		float sinX, cosX, sinY, cosY;
+		MathUtil::sinCosDeg(rotation[i] + shearX[i], sinX, cosX);
+		MathUtil::sinCosDeg(rotation[i] + 90 + shearY[i], sinY, cosY);
+		a[i] = cosX * scaleX[i];
+		b[i] = cosY * scaleY[i];
+		c[i] = sinX * scaleX[i];
+		d[i] = sinY * scaleY[i];
+	}
+
+	// Same math as Bone::updateWorldTransform() for root bones and TransformMode_Normal.
+	float sx = skeleton.getScaleX(), sy = skeleton.getScaleY();
+	float skeletonX = skeleton.getX(), skeletonY = skeleton.getY();
+	for (size_t i = first; i < last; i++) {
+		Bone &bone = *bones[i];
+		int parent = parents[i];
+		float la = a[i], lb = b[i], lc = c[i], ld = d[i];
+		if (parent == ParentNone) {
+			a[i] = la * sx;
+			b[i] = lb * sx;
+			c[i] = lc * sy;
+			d[i] = ld * sy;
+			worldX[i] = x[i] * sx + skeletonX;
+			worldY[i] = y[i] * sy + skeletonY;
+		} else {
+			float pa, pb, pc, pd, pwx, pwy;
+			if (parent >= 0) {
+				pa = a[parent];
+				pb = b[parent];
+				pc = c[parent];
+				pd = d[parent];
+				pwx = worldX[parent];
+				pwy = worldY[parent];
+			} else {
+				Bone &parentBone = *bone._parent;
+				pa = parentBone._a;
+				pb = parentBone._b;
+				pc = parentBone._c;
+				pd = parentBone._d;
+				pwx = parentBone._worldX;
+				pwy = parentBone._worldY;
+			}
+			worldX[i] = pa * x[i] + pb * y[i] + pwx;
+			worldY[i] = pc * x[i] + pd * y[i] + pwy;
+			a[i] = pa * la + pb * lc;
+			b[i] = pa * lb + pb * ld;
+			c[i] = pc * la + pd * lc;
+			d[i] = pc * lb + pd * ld;
+		}
+
+		bone._ax = x[i];
+		bone._ay = y[i];
+		bone._arotation = rotation[i];
+		bone._ascaleX = scaleX[i];
+		bone._ascaleY = scaleY[i];
+		bone._ashearX = shearX[i];
+		bone._ashearY = shearY[i];
+		bone._appliedValid = true;
+		bone._a = a[i];
+		bone._b = b[i];
+		bone._c = c[i];
+		bone._d = d[i];
+		bone._worldX = worldX[i];
+		bone._worldY = worldY[i];
+	}
+}
+
+size_t BonePoseBuffer::size() {
+	return _bones.size();
+}
+
+size_t BonePoseBuffer::getRunCount() {
+	return _runs.size();
+}
+
+Vector<Bone *> &BonePoseBuffer::getBones() {
+	return _bones;
+}
+
+Vector<float> &BonePoseBuffer::getA() {
+	return _a;
+}
+
+Vector<float> &BonePoseBuffer::getB() {
+	return _b;
+}
+
+Vector<float> &BonePoseBuffer::getC() {
+	return _c;
+}
+
+Vector<float> &BonePoseBuffer::getD() {
+	return _d;
+}
+
+Vector<float> &BonePoseBuffer::getWorldX() {
+	return _worldX;
+}
+
+Vector<float> &BonePoseBuffer::getWorldY() {
+	return _worldY;
+}
@@ -34,6 +34,8 @@
 #include <spine/ClippingAttachment.h>
 
 #include <spine/SlotData.h>
+#include <spine/SkeletonClipping.h>
+#include <spine/Triangulator.h>
 
 using namespace spine;
 
@@ -54,5 +56,35 @@ Attachment* ClippingAttachment::copy() {
 	ClippingAttachment* copy = new (__FILE__, __LINE__) ClippingAttachment(getName());
 	copyTo(copy);
 	copy->_endSlot = _endSlot;
+	copy->_convexPolygons.addAll(_convexPolygons);
+	copy->_convexPolygonSizes.addAll(_convexPolygonSizes);
 	return copy;
 }
+
+void ClippingAttachment::updateConvexPolygons() {
+	_convexPolygons.clear();
+	_convexPolygonSizes.clear();
+	if (_bones.size() > 0 || _vertices.size() < 6) return;
+
+	// Triangulation and decomposition only depend on the orientation of vertex triples, so the decomposition of the local
+	// polygon is the decomposition of the world polygon for any bone transform, mirrored if the transform flips.
+	Vector<float> polygon;
+	polygon.addAll(_vertices);
+	SkeletonClipping::makeClockwise(polygon);
+	Triangulator triangulator;
+	Vector<Vector<float> *> &polygons = triangulator.decompose(polygon, triangulator.triangulate(polygon));
+	for (size_t i = 0; i < polygons.size(); ++i) {
+		Vector<float> &convexPolygon = *polygons[i];
+		SkeletonClipping::makeClockwise(convexPolygon);
+		_convexPolygons.addAll(convexPolygon);
+		_convexPolygonSizes.add((int) convexPolygon.size());
+	}
+}
+
+Vector<float> &ClippingAttachment::getConvexPolygons() {
+	return _convexPolygons;
+}
+
+Vector<int> &ClippingAttachment::getConvexPolygonSizes() {
+	return _convexPolygonSizes;
+}
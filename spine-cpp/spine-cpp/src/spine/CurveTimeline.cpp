@@ -42,9 +42,10 @@ RTTI_IMPL(CurveTimeline, Timeline)
 const float CurveTimeline::LINEAR = 0;
 const float CurveTimeline::STEPPED = 1;
 const float CurveTimeline::BEZIER = 2;
+const float CurveTimeline::BEZIER_UNIFORM = 3;
 const int CurveTimeline::BEZIER_SIZE = 10 * 2 - 1;
 
-CurveTimeline::CurveTimeline(int frameCount) {
+CurveTimeline::CurveTimeline(int frameCount) : _curvePool(NULL) {
 	assert(frameCount > 0);
 
 	_curves.setSize((frameCount - 1) * BEZIER_SIZE, 0);
@@ -54,6 +55,7 @@ CurveTimeline::~CurveTimeline() {
 }
 
 size_t CurveTimeline::getFrameCount() {
+	if (_curvePool) return _curveIndices.size() + 1;
 	return _curves.size() / BEZIER_SIZE + 1;
 }
 
@@ -65,7 +67,7 @@ void CurveTimeline::setStepped(size_t frameIndex) {
 	_curves[frameIndex * BEZIER_SIZE] = STEPPED;
 }
 
-void CurveTimeline::setCurve(size_t frameIndex, float cx1, float cy1, float cx2, float cy2) {
+void CurveTimeline::setCurve(size_t frameIndex, float cx1, float cy1, float cx2, float cy2, CurveMode mode) {
 	float tmpx = (-cx1 * 2 + cx2) * 0.03f, tmpy = (-cy1 * 2 + cy2) * 0.03f;
 	float dddfx = ((cx1 - cx2) * 3 + 1) * 0.006f, dddfy = ((cy1 - cy2) * 3 + 1) * 0.006f;
 	float ddfx = tmpx * 2 + dddfx, ddfy = tmpy * 2 + dddfy;
@@ -85,12 +87,44 @@ void CurveTimeline::setCurve(size_t frameIndex, float cx1, float cy1, float cx2,
 		x += dfx;
 		y += dfy;
 	}
+	if (mode == CurveMode_Sampled) return;
+
+	// The y at percents 0, 1/17, ..., 1. They are used if they follow the curve at least as closely as the sampled points,
+	// which steep curves need more points for.
+	const int n = BEZIER_SIZE - 2;
+	float uniform[n + 1];
+	for (int ii = 0; ii <= n; ii++)
+		uniform[ii] = getBezierPercent(cx1, cy1, cx2, cy2, ii / (float) n);
+	float sampledError = 0, uniformError = 0;
+	for (int ii = 0; ii < n; ii++) {
+		for (int step = 1; step < 4; step++) {
+			float percent = (ii + step * 0.25f) / n, expected = getBezierPercent(cx1, cy1, cx2, cy2, percent);
+			sampledError = MathUtil::max(sampledError, MathUtil::abs(getCurvePercent(frameIndex, percent) - expected));
+			uniformError = MathUtil::max(uniformError,
+				MathUtil::abs(uniform[ii] + (uniform[ii + 1] - uniform[ii]) * step * 0.25f - expected));
+		}
+	}
+	if (uniformError > sampledError) return;
+	i = frameIndex * BEZIER_SIZE;
+	_curves[i++] = BEZIER_UNIFORM;
+	for (int ii = 0; ii <= n; ii++)
+		_curves[i + ii] = uniform[ii];
 }
 
 float CurveTimeline::getCurvePercent(size_t frameIndex, float percent) {
+	if (_curvePool) return getCurvePercent(_curvePool + _curveIndices[frameIndex] * BEZIER_SIZE, 0, percent);
+	return getCurvePercent(_curves.buffer(), frameIndex, percent);
+}
+
+const float *CurveTimeline::getCurve(size_t frameIndex) {
+	if (_curvePool) return _curvePool + _curveIndices[frameIndex] * BEZIER_SIZE;
+	return _curves.buffer() + frameIndex * BEZIER_SIZE;
+}
+
+float CurveTimeline::getCurvePercent(const float *curves, size_t frameIndex, float percent) {
 	percent = MathUtil::clamp(percent, 0, 1);
 	size_t i = frameIndex * BEZIER_SIZE;
-	float type = _curves[i];
+	float type = curves[i];
 
 	if (type == LINEAR) {
 		return percent;
@@ -100,28 +134,70 @@ float CurveTimeline::getCurvePercent(size_t frameIndex, float percent) {
 		return 0;
 	}
 
+	if (type == BEZIER_UNIFORM) {
+		float x = percent * (BEZIER_SIZE - 2);
+		int index = MathUtil::min((int) x, BEZIER_SIZE - 3);
+		const float *y = curves + i + 1 + index;
+		return y[0] + (y[1] - y[0]) * (x - index);
+	}
+
 	i++;
 	float x = 0;
 	for (size_t start = i, n = i + BEZIER_SIZE - 1; i < n; i += 2) {
-		x = _curves[i];
+		x = curves[i];
 		if (x >= percent) {
 			float prevX, prevY;
 			if (i == start) {
 				prevX = 0;
 				prevY = 0;
 			} else {
-				prevX = _curves[i - 2];
-				prevY = _curves[i - 1];
+				prevX = curves[i - 2];
+				prevY = curves[i - 1];
 			}
-			return prevY + (_curves[i + 1] - prevY) * (percent - prevX) / (x - prevX);
+			return prevY + (curves[i + 1] - prevY) * (percent - prevX) / (x - prevX);
 		}
 	}
 
-	float y = _curves[i - 1];
+	float y = curves[i - 1];
 
 	return y + (1 - y) * (percent - x) / (1 - x); // Last point is 1,1.
 }
 
+float CurveTimeline::getBezierPercent(float cx1, float cy1, float cx2, float cy2, float percent) {
+	percent = MathUtil::clamp(percent, 0, 1);
+	// x(t) = ((ax * t + bx) * t + cx) * t, likewise for y.
+	float cx = 3 * cx1, bx = 3 * (cx2 - cx1) - cx, ax = 1 - cx - bx;
+	float cy = 3 * cy1, by = 3 * (cy2 - cy1) - cy, ay = 1 - cy - by;
+
+	// Newton's method usually converges in a few iterations. x(t) is monotonic for handles from 0 to 1, so bisection is
+	// used when it does not.
+	float t = percent;
+	for (int i = 0; i < 8; i++) {
+		float error = ((ax * t + bx) * t + cx) * t - percent;
+		if (MathUtil::abs(error) < 1e-6f) return ((ay * t + by) * t + cy) * t;
+		float slope = (3 * ax * t + 2 * bx) * t + cx;
+		if (MathUtil::abs(slope) < 1e-6f) break;
+		t -= error / slope;
+		if (t < 0 || t > 1) break;
+	}
+	float low = 0, high = 1;
+	t = percent;
+	for (int i = 0; i < 32; i++) {
+		float x = ((ax * t + bx) * t + cx) * t;
+		if (MathUtil::abs(x - percent) < 1e-6f) break;
+		if (x < percent)
+			low = t;
+		else
+			high = t;
+		t = (low + high) * 0.5f;
+	}
+	return ((ay * t + by) * t + cy) * t;
+}
+
 float CurveTimeline::getCurveType(size_t frameIndex) {
-	return _curves[frameIndex * BEZIER_SIZE];
+	return getCurve(frameIndex)[0];
+}
+
+Vector<float> &CurveTimeline::getCurves() {
+	return _curves;
 }
@@ -43,12 +43,14 @@
 #include <spine/Slot.h>
 #include <spine/Bone.h>
 #include <spine/SlotData.h>
+#include <spine/SimdUtil.h>
 
 using namespace spine;
 
 RTTI_IMPL(DeformTimeline, CurveTimeline)
 
-DeformTimeline::DeformTimeline(int frameCount) : CurveTimeline(frameCount), _slotIndex(0), _attachment(NULL) {
+DeformTimeline::DeformTimeline(int frameCount) : CurveTimeline(frameCount), _slotIndex(0), _attachment(NULL),
+	_sparse(NULL) {
 	_frames.ensureCapacity(frameCount);
 	_frameVertices.ensureCapacity(frameCount);
 
@@ -60,6 +62,10 @@ DeformTimeline::DeformTimeline(int frameCount) : CurveTimeline(frameCount), _slo
 	}
 }
 
+DeformTimeline::~DeformTimeline() {
+	delete _sparse;
+}
+
 void DeformTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
 	MixBlend blend, MixDirection direction
 ) {
@@ -81,38 +87,37 @@ void DeformTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 		return;
 	}
 
-	Vector<float> &deformArray = slot._deform;
-	if (deformArray.size() == 0) {
+	if (slot.getDeformLength() == 0) {
 		blend = MixBlend_Setup;
 	}
 
-	Vector< Vector<float> > &frameVertices = _frameVertices;
-	size_t vertexCount = frameVertices[0].size();
+	const float *frames = _frames.buffer();
+	size_t frameCount = _frames.size(), vertexCount;
+	if (_sparse) {
+		frames = _sparse->times;
+		frameCount = _sparse->frameCount;
+		vertexCount = _sparse->vertexCount;
+	} else
+		vertexCount = _frameVertices[0].size();
 
-	Vector<float> &frames = _frames;
-	if (time < _frames[0]) {
+	// Unweighted vertex positions are blended with the setup vertices, weighted deform offsets with zero.
+	const float *setupVertices = attachment->getBones().size() == 0 ? attachment->getVertices().buffer() : NULL;
+
+	if (time < frames[0]) {
 		switch (blend) {
 		case MixBlend_Setup:
-			deformArray.clear();
+			slot.clearDeform();
 			return;
 		case MixBlend_First: {
 			if (alpha == 1) {
-				deformArray.clear();
+				slot.clearDeform();
 				return;
 			}
-			deformArray.setSize(vertexCount, 0);
-			Vector<float> &deformInner = deformArray;
-			if (attachment->getBones().size() == 0) {
-				// Unweighted vertex positions.
-				Vector<float> &setupVertices = attachment->getVertices();
-				for (size_t i = 0; i < vertexCount; i++)
-					deformInner[i] += (setupVertices[i] - deformInner[i]) * alpha;
-			} else {
-				// Weighted deform offsets.
-				alpha = 1 - alpha;
-				for (size_t i = 0; i < vertexCount; i++)
-					deformInner[i] *= alpha;
-			}
+			float *deform = slot.resizeDeform(vertexCount, true);
+			if (setupVertices)
+				SimdUtil::lerp(deform, setupVertices, alpha, deform, vertexCount);
+			else
+				SimdUtil::scale(deform, 1 - alpha, deform, vertexCount);
 		}
 		case MixBlend_Replace:
 		case MixBlend_Add:
@@ -120,145 +125,60 @@ void DeformTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 		}
 	}
 
-	deformArray.setSize(vertexCount, 0);
-	Vector<float> &deform = deformArray;
-
-	if (time >= frames[frames.size() - 1]) { // Time is after last frame.
-		Vector<float> &lastVertices = frameVertices[frames.size() - 1];
-		if (alpha == 1) {
-			if (blend == MixBlend_Add) {
-				VertexAttachment *vertexAttachment = static_cast<VertexAttachment*>(slotAttachment);
-				if (vertexAttachment->getBones().size() == 0) {
-					// Unweighted vertex positions, no alpha.
-					Vector<float> &setupVertices = vertexAttachment->getVertices();
-					for (size_t i = 0; i < vertexCount; i++)
-						deform[i] += lastVertices[i] - setupVertices[i];
-				} else {
-					// Weighted deform offsets, no alpha.
-					for (size_t i = 0; i < vertexCount; i++)
-						deform[i] += lastVertices[i];
-				}
-			} else {
-				// Vertex positions or deform offsets, no alpha.
-				memcpy(deform.buffer(), lastVertices.buffer(), vertexCount * sizeof(float));
-			}
-		} else {
-			switch (blend) {
-			case MixBlend_Setup: {
-				VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
-				if (vertexAttachment->getBones().size() == 0) {
-					// Unweighted vertex positions, with alpha.
-					Vector<float> &setupVertices = vertexAttachment->getVertices();
-					for (size_t i = 0; i < vertexCount; i++) {
-						float setup = setupVertices[i];
-						deform[i] = setup + (lastVertices[i] - setup) * alpha;
-					}
-				} else {
-					// Weighted deform offsets, with alpha.
-					for (size_t i = 0; i < vertexCount; i++)
-						deform[i] = lastVertices[i] * alpha;
-				}
-				break;
-			}
-			case MixBlend_First:
-			case MixBlend_Replace:
-				// Vertex positions or deform offsets, with alpha.
-				for (size_t i = 0; i < vertexCount; i++)
-					deform[i] += (lastVertices[i] - deform[i]) * alpha;
-				break;
-			case MixBlend_Add:
-				VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
-				if (vertexAttachment->getBones().size() == 0) {
-					// Unweighted vertex positions, no alpha.
-					Vector<float> &setupVertices = vertexAttachment->getVertices();
-					for (size_t i = 0; i < vertexCount; i++)
-						deform[i] += (lastVertices[i] - setupVertices[i]) * alpha;
-				} else {
-					// Weighted deform offsets, alpha.
-					for (size_t i = 0; i < vertexCount; i++)
-						deform[i] += lastVertices[i] * alpha;
-				}
+	// The scratch holds the two keyframes decoded from sparse keyframes, followed by the interpolated vertices.
+	Vector<float> &scratch = skeleton._deformScratch;
+	scratch.setSize(vertexCount * 3, 0);
+	float *buffer = scratch.buffer();
+
+	const float *vertices;
+	if (time >= frames[frameCount - 1]) // Time is after last frame.
+		vertices = getFrameVertices(frameCount - 1, buffer);
+	else {
+		// Interpolate between the previous frame and the current frame.
+		int frame = Animation::binarySearch(frames, (int) frameCount, time, 1);
+		float frameTime = frames[frame];
+		float percent = getCurvePercent(frame - 1, 1 - (time - frameTime) / (frames[frame - 1] - frameTime));
+		vertices = getFrameVertices(frame - 1, buffer);
+		if (percent != 0) { // Stepped curves and times on a keyframe use the previous frame as is.
+			const float *nextVertices = getFrameVertices(frame, buffer + vertexCount);
+			if (alpha == 1 && blend != MixBlend_Add) {
+				SimdUtil::lerp(vertices, nextVertices, percent, slot.resizeDeform(vertexCount, false), vertexCount);
+				return;
 			}
+			float *interpolated = buffer + vertexCount * 2;
+			SimdUtil::lerp(vertices, nextVertices, percent, interpolated, vertexCount);
+			vertices = interpolated;
 		}
-		return;
 	}
 
-	// Interpolate between the previous frame and the current frame.
-	int frame = Animation::binarySearch(frames, time);
-	Vector<float> &prevVertices = frameVertices[frame - 1];
-	Vector<float> &nextVertices = frameVertices[frame];
-	float frameTime = frames[frame];
-	float percent = getCurvePercent(frame - 1, 1 - (time - frameTime) / (frames[frame - 1] - frameTime));
-
 	if (alpha == 1) {
-		if (blend == MixBlend_Add) {
-			VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
-			if (vertexAttachment->getBones().size() == 0) {
-				// Unweighted vertex positions, no alpha.
-				Vector<float> &setupVertices = vertexAttachment->getVertices();
-				for (size_t i = 0; i < vertexCount; i++) {
-					float prev = prevVertices[i];
-					deform[i] += prev + (nextVertices[i] - prev) * percent - setupVertices[i];
-				}
-			} else {
-				// Weighted deform offsets, no alpha.
-				for (size_t i = 0; i < vertexCount; i++) {
-					float prev = prevVertices[i];
-					deform[i] += prev + (nextVertices[i] - prev) * percent;
-				}
-			}
-		} else {
-			// Vertex positions or deform offsets, no alpha.
-			for (size_t i = 0; i < vertexCount; i++) {
-				float prev = prevVertices[i];
-				deform[i] = prev + (nextVertices[i] - prev) * percent;
-			}
-		}
-	} else {
-		switch (blend) {
-		case MixBlend_Setup: {
-			VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
-			if (vertexAttachment->getBones().size() == 0) {
-				// Unweighted vertex positions, with alpha.
-				Vector<float> &setupVertices = vertexAttachment->getVertices();
-				for (size_t i = 0; i < vertexCount; i++) {
-					float prev = prevVertices[i], setup = setupVertices[i];
-					deform[i] = setup + (prev + (nextVertices[i] - prev) * percent - setup) * alpha;
-				}
-			} else {
-				// Weighted deform offsets, with alpha.
-				for (size_t i = 0; i < vertexCount; i++) {
-					float prev = prevVertices[i];
-					deform[i] = (prev + (nextVertices[i] - prev) * percent) * alpha;
-				}
-			}
-			break;
-		}
-		case MixBlend_First:
-		case MixBlend_Replace:
-			// Vertex positions or deform offsets, with alpha.
-			for (size_t i = 0; i < vertexCount; i++) {
-				float prev = prevVertices[i];
-				deform[i] += (prev + (nextVertices[i] - prev) * percent - deform[i]) * alpha;
-			}
-			break;
-		case MixBlend_Add:
-			VertexAttachment *vertexAttachment = static_cast<VertexAttachment *>(slotAttachment);
-			if (vertexAttachment->getBones().size() == 0) {
-				// Unweighted vertex positions, with alpha.
-				Vector<float> &setupVertices = vertexAttachment->getVertices();
-				for (size_t i = 0; i < vertexCount; i++) {
-					float prev = prevVertices[i];
-					deform[i] += (prev + (nextVertices[i] - prev) * percent - setupVertices[i]) * alpha;
-				}
-			} else {
-				// Weighted deform offsets, with alpha.
-				for (size_t i = 0; i < vertexCount; i++) {
-					float prev = prevVertices[i];
-					deform[i] += (prev + (nextVertices[i] - prev) * percent) * alpha;
-				}
-			}
-		}
+		if (blend == MixBlend_Add)
+			SimdUtil::add(vertices, setupVertices, 1, slot.resizeDeform(vertexCount, true), vertexCount);
+		else if (!_sparse) {
+			// A single keyframe replaces the deform, so the slot uses its vertices without copying them.
+			slot.setDeformAlias(vertices, vertexCount);
+		} else
+			memcpy(slot.resizeDeform(vertexCount, false), vertices, vertexCount * sizeof(float));
+		return;
+	}
+
+	switch (blend) {
+	case MixBlend_Setup: {
+		float *deform = slot.resizeDeform(vertexCount, false);
+		if (setupVertices)
+			SimdUtil::lerp(setupVertices, vertices, alpha, deform, vertexCount);
+		else
+			SimdUtil::scale(vertices, alpha, deform, vertexCount);
+		break;
+	}
+	case MixBlend_First:
+	case MixBlend_Replace: {
+		float *deform = slot.resizeDeform(vertexCount, true);
+		SimdUtil::lerp(deform, vertices, alpha, deform, vertexCount);
+		break;
+	}
+	case MixBlend_Add:
+		SimdUtil::add(vertices, setupVertices, alpha, slot.resizeDeform(vertexCount, true), vertexCount);
 	}
 }
 
@@ -289,6 +209,24 @@ Vector<Vector<float> > &DeformTimeline::getVertices() {
 	return _frameVertices;
 }
 
+const float *DeformTimeline::getFrameVertices(size_t frameIndex, float *buffer) {
+	if (!_sparse) return _frameVertices[frameIndex].buffer();
+
+	size_t vertexCount = _sparse->vertexCount;
+	if (_attachment->getBones().size() == 0)
+		memcpy(buffer, _attachment->getVertices().buffer(), vertexCount * sizeof(float));
+	else
+		memset(buffer, 0, vertexCount * sizeof(float));
+	const int *frameRuns = _sparse->frameRuns.buffer() + (frameIndex << 1), *runs = _sparse->runs.buffer();
+	const float *vertices = _sparse->vertices.buffer() + frameRuns[1];
+	for (int i = frameRuns[0], n = frameRuns[2]; i < n; i++) {
+		int start = runs[i << 1], count = runs[(i << 1) + 1];
+		memcpy(buffer + start, vertices, count * sizeof(float));
+		vertices += count;
+	}
+	return buffer;
+}
+
 VertexAttachment *DeformTimeline::getAttachment() {
 	return _attachment;
 }
@@ -32,6 +32,7 @@
 #endif
 
 #include <spine/Extension.h>
+#include <spine/Arena.h>
 #include <spine/SpineString.h>
 
 #include <assert.h>
@@ -56,6 +57,33 @@ SpineExtension *SpineExtension::getInstance() {
 SpineExtension::~SpineExtension() {
 }
 
+void *SpineExtension::allocate(size_t size, const char *file, int line) {
+	Arena *arena = Arena::getCurrent();
+	if (arena) return arena->alloc(size);
+	return getInstance()->_alloc(size, file, line);
+}
+
+void *SpineExtension::callocate(size_t size, const char *file, int line) {
+	Arena *arena = Arena::getCurrent();
+	if (arena) return arena->calloc(size);
+	return getInstance()->_calloc(size, file, line);
+}
+
+void *SpineExtension::reallocate(void *ptr, size_t size, const char *file, int line) {
+	Arena *arena = Arena::getCurrent();
+	if (arena && (!ptr || arena->owns(ptr))) return arena->realloc(ptr, size);
+	return getInstance()->_realloc(ptr, size, file, line);
+}
+
+void SpineExtension::deallocate(void *ptr, const char *file, int line) {
+	Arena *arena = Arena::getCurrent();
+	if (arena && arena->owns(ptr)) {
+		arena->free(ptr);
+		return;
+	}
+	getInstance()->_free(ptr, file, line);
+}
+
 SpineExtension::SpineExtension() {
 }
 
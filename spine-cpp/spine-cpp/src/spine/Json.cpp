@@ -43,6 +43,7 @@ THE SOFTWARE.
 #include <spine/SpineString.h>
 
 #include <assert.h>
+#include <ctype.h>
 #include <math.h>
 
 using namespace spine;
@@ -55,9 +56,18 @@ const int Json::JSON_STRING = 4;
 const int Json::JSON_ARRAY = 5;
 const int Json::JSON_OBJECT = 6;
 
+const int Json::INDEX_MIN_SIZE = 8;
+
 const char *Json::_error = NULL;
 
 Json *Json::getItem(Json *object, const char *string) {
+	if (object->_index && string) {
+		size_t mask = (size_t) object->_indexCapacity - 1;
+		for (size_t i = hashName(string) & mask; object->_index[i]; i = (i + 1) & mask)
+			if (!json_strcasecmp(object->_index[i]->_name, string)) return object->_index[i];
+		return NULL;
+	}
+
 	Json *c = object->_child;
 	while (c && json_strcasecmp(c->_name, string)) {
 		c = c->_next;
@@ -111,7 +121,9 @@ Json::Json(const char *value) :
 		_valueString(NULL),
 		_valueInt(0),
 		_valueFloat(0),
-		_name(NULL) {
+		_name(NULL),
+		_index(NULL),
+		_indexCapacity(0) {
 	if (value) {
 		value = parseValue(this, skip(value));
 
@@ -137,6 +149,10 @@ Json::~Json() {
     if (_name) {
         SpineExtension::free(_name, __FILE__, __LINE__);
     }
+
+    if (_index) {
+        SpineExtension::free(_index, __FILE__, __LINE__);
+    }
 }
 
 const char *Json::skip(const char *inValue) {
@@ -525,6 +541,7 @@ const char *Json::parseObject(Json *item, const char *value) {
 	}
 
 	if (*value == '}') {
+		if (item->_size >= INDEX_MIN_SIZE) buildIndex(item);
 		return value + 1; /* end of array */
 	}
 
@@ -533,6 +550,33 @@ const char *Json::parseObject(Json *item, const char *value) {
 	return NULL; /* malformed. */
 }
 
+size_t Json::hashName(const char *name) {
+	/* FNV-1a over the lower case characters, so names differing only in case hash the same. */
+	size_t h = (size_t) 2166136261u;
+	for (; *name; name++) {
+		h ^= (size_t) tolower((unsigned char) *name);
+		h *= (size_t) 16777619u;
+	}
+	return h;
+}
+
+void Json::buildIndex(Json *object) {
+	int capacity = 16;
+	while (object->_size * 2 > capacity)
+		capacity <<= 1;
+	object->_index = SpineExtension::calloc<Json *>(capacity, __FILE__, __LINE__);
+	object->_indexCapacity = capacity;
+
+	/* Inserting in order with linear probing finds the first of several items with the same name, like the list. */
+	size_t mask = (size_t) capacity - 1;
+	for (Json *child = object->_child; child; child = child->_next) {
+		size_t i = hashName(child->_name) & mask;
+		while (object->_index[i])
+			i = (i + 1) & mask;
+		object->_index[i] = child;
+	}
+}
+
 int Json::json_strcasecmp(const char *s1, const char *s2) {
 	/* TODO we may be able to elide these NULL checks if we can prove
 	 * the graph and input (only callsite is Json_getItem) should not have NULLs
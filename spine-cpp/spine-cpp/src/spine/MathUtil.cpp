@@ -69,14 +69,24 @@ float MathUtil::atan2(float y, float x) {
 	return (float)::atan2(y, x);
 }
 
-/// Returns the cosine in radians from a lookup table.
 float MathUtil::cos(float radians) {
+#if defined(SPINE_TRIG_POLYNOMIAL) || defined(SPINE_TRIG_TABLE)
+	float s, c;
+	sinCos(radians, s, c);
+	return c;
+#else
 	return (float)::cos(radians);
+#endif
 }
 
-/// Returns the sine in radians from a lookup table.
 float MathUtil::sin(float radians) {
+#if defined(SPINE_TRIG_POLYNOMIAL) || defined(SPINE_TRIG_TABLE)
+	float s, c;
+	sinCos(radians, s, c);
+	return s;
+#else
 	return (float)::sin(radians);
+#endif
 }
 
 float MathUtil::sqrt(float v) {
@@ -87,14 +97,73 @@ float MathUtil::acos(float v) {
 	return (float)::acos(v);
 }
 
-/// Returns the sine in radians from a lookup table.
 float MathUtil::sinDeg(float degrees) {
+#if defined(SPINE_TRIG_POLYNOMIAL) || defined(SPINE_TRIG_TABLE)
+	float s, c;
+	sinCosDeg(degrees, s, c);
+	return s;
+#else
 	return (float)::sin(degrees * MathUtil::Deg_Rad);
+#endif
 }
 
-/// Returns the cosine in radians from a lookup table.
 float MathUtil::cosDeg(float degrees) {
+#if defined(SPINE_TRIG_POLYNOMIAL) || defined(SPINE_TRIG_TABLE)
+	float s, c;
+	sinCosDeg(degrees, s, c);
+	return c;
+#else
 	return (float)::cos(degrees * MathUtil::Deg_Rad);
+#endif
+}
+
+void MathUtil::sinCosLibm(float radians, float &outSin, float &outCos) {
+	outSin = (float)::sin(radians);
+	outCos = (float)::cos(radians);
+}
+
+void MathUtil::sinCosDegLibm(float degrees, float &outSin, float &outCos) {
+	float radians = degrees * MathUtil::Deg_Rad;
+	outSin = (float)::sin(radians);
+	outCos = (float)::cos(radians);
+}
+
+// One full turn of sine plus one entry so interpolation never wraps. Cosine reads a quarter turn ahead.
+static const int TrigTableBits = 12;
+static const int TrigTableSize = 1 << TrigTableBits;
+static const int TrigTableMask = TrigTableSize - 1;
+
+static struct TrigTable {
+	float values[TrigTableSize + 1];
+
+	TrigTable() {
+		for (int i = 0; i <= TrigTableSize; i++)
+			values[i] = (float)::sin(i * (2 * 3.14159265358979323846 / TrigTableSize));
+	}
+} trigTable;
+
+// index is in table entries and within one turn of 0.
+static inline void sinCosTableIndex(float index, float &outSin, float &outCos) {
+	int i = (int)index;
+	if (index < i) i--;
+	float alpha = index - i;
+	int s = i & TrigTableMask, c = (s + (TrigTableSize >> 2)) & TrigTableMask;
+	const float *values = trigTable.values;
+	outSin = values[s] + (values[s + 1] - values[s]) * alpha;
+	outCos = values[c] + (values[c + 1] - values[c]) * alpha;
+}
+
+void MathUtil::sinCosDegTable(float degrees, float &outSin, float &outCos) {
+	// Whole turns are removed first, so the index keeps its fractional precision for large angles.
+	int turns = nearestInteger(degrees * (1.0f / 360.0f));
+	sinCosTableIndex((degrees - turns * 360.0f) * (TrigTableSize / 360.0f), outSin, outCos);
+}
+
+void MathUtil::sinCosTable(float radians, float &outSin, float &outCos) {
+	int turns = nearestInteger(radians * 0.15915494309189535f);
+	float x = radians - turns * 6.28125f;
+	x -= turns * 1.9353071795864769253e-3f;
+	sinCosTableIndex(x * (TrigTableSize / 6.283185307179586f), outSin, outCos);
 }
 
 /* Need to pass 0 as an argument, so VC++ doesn't error with C2124 */
@@ -41,6 +41,7 @@
 
 #include <spine/SlotData.h>
 #include <spine/BoneData.h>
+#include <spine/SimdUtil.h>
 
 using namespace spine;
 
@@ -59,15 +60,16 @@ PathConstraint::PathConstraint(PathConstraintData &data, Skeleton &skeleton) : U
 	_spacing(data.getSpacing()),
 	_rotateMix(data.getRotateMix()),
 	_translateMix(data.getTranslateMix()),
-	_active(false)
+	_active(false),
+	_geometryCacheEnabled(true),
+	_cachedPath(NULL),
+	_cachedTarget(NULL)
 {
 	_bones.ensureCapacity(_data.getBones().size());
 	for (size_t i = 0; i < _data.getBones().size(); i++) {
 		BoneData *boneData = _data.getBones()[i];
 		_bones.add(skeleton.findBone(boneData->getName()));
 	}
-
-	_segments.setSize(10, 0);
 }
 
 void PathConstraint::apply() {
@@ -180,8 +182,7 @@ void PathConstraint::update() {
 			r -= MathUtil::atan2(c, a);
 
 			if (tip) {
-				cos = MathUtil::cos(r);
-				sin = MathUtil::sin(r);
+				MathUtil::sinCos(r, sin, cos);
 				float length = bone._data.getLength();
 				boneX += (length * (cos * a - sin * c) - dx) * rotateMix;
 				boneY += (length * (sin * a + cos * c) - dy) * rotateMix;
@@ -194,8 +195,7 @@ void PathConstraint::update() {
 				r += MathUtil::Pi_2;
 
 			r *= rotateMix;
-			cos = MathUtil::cos(r);
-			sin = MathUtil::sin(r);
+			MathUtil::sinCos(r, sin, cos);
 			bone._a = cos * a - sin * c;
 			bone._b = cos * b - sin * d;
 			bone._c = sin * a + cos * c;
@@ -282,6 +282,8 @@ PathConstraint::computeWorldPositions(PathAttachment &path, int spacesCount, boo
 				_spaces[i] *= pathLength;
 		}
 
+		// The world vertices are only computed per curve, so they are not cached.
+		_cachedPath = NULL;
 		world.setSize(8, 0);
 		for (int i = 0, o = 0, curve = 0; i < spacesCount; i++, o += 3) {
 			float space = _spaces[i];
@@ -341,57 +343,32 @@ PathConstraint::computeWorldPositions(PathAttachment &path, int spacesCount, boo
 		return out;
 	}
 
-	// World vertices.
-	if (closed) {
+	// World vertices and curve lengths, reused while the inputs of the world vertices are unchanged.
+	if (closed)
 		verticesLength += 2;
-		world.setSize(verticesLength, 0);
-		path.computeWorldVertices(target, 2, verticesLength - 4, world, 0);
-		path.computeWorldVertices(target, 0, 2, world, verticesLength - 4);
-		world[verticesLength - 2] = world[0];
-		world[verticesLength - 1] = world[1];
-	} else {
+	else {
 		curveCount--;
 		verticesLength -= 4;
+	}
+	if (!updateCachedInputs(path)) {
 		world.setSize(verticesLength, 0);
-		path.computeWorldVertices(target, 2, verticesLength, world, 0);
+		if (closed) {
+			path.computeWorldVertices(target, 2, verticesLength - 4, world, 0);
+			path.computeWorldVertices(target, 0, 2, world, verticesLength - 4);
+			world[verticesLength - 2] = world[0];
+			world[verticesLength - 1] = world[1];
+		} else
+			path.computeWorldVertices(target, 2, verticesLength, world, 0);
+
+		_curves.setSize(curveCount, 0);
+		SimdUtil::curveLengths(world.buffer(), curveCount, _curves.buffer());
+		_segments.setSize(curveCount * 10, 0);
+		for (int i = 0; i < curveCount; i++)
+			_segments[i * 10] = -1;
 	}
-
-	// Curve lengths.
-	_curves.setSize(curveCount, 0);
-	pathLength = 0;
-	float x1 = world[0], y1 = world[1], cx1 = 0, cy1 = 0, cx2 = 0, cy2 = 0, x2 = 0, y2 = 0;
+	pathLength = curveCount > 0 ? _curves[curveCount - 1] : 0;
+	float x1 = 0, y1 = 0, cx1 = 0, cy1 = 0, cx2 = 0, cy2 = 0, x2 = 0, y2 = 0;
 	float tmpx, tmpy, dddfx, dddfy, ddfx, ddfy, dfx, dfy;
-	for (int i = 0, w = 2; i < curveCount; i++, w += 6) {
-		cx1 = world[w];
-		cy1 = world[w + 1];
-		cx2 = world[w + 2];
-		cy2 = world[w + 3];
-		x2 = world[w + 4];
-		y2 = world[w + 5];
-		tmpx = (x1 - cx1 * 2 + cx2) * 0.1875f;
-		tmpy = (y1 - cy1 * 2 + cy2) * 0.1875f;
-		dddfx = ((cx1 - cx2) * 3 - x1 + x2) * 0.09375f;
-		dddfy = ((cy1 - cy2) * 3 - y1 + y2) * 0.09375f;
-		ddfx = tmpx * 2 + dddfx;
-		ddfy = tmpy * 2 + dddfy;
-		dfx = (cx1 - x1) * 0.75f + tmpx + dddfx * 0.16666667f;
-		dfy = (cy1 - y1) * 0.75f + tmpy + dddfy * 0.16666667f;
-		pathLength += MathUtil::sqrt(dfx * dfx + dfy * dfy);
-		dfx += ddfx;
-		dfy += ddfy;
-		ddfx += dddfx;
-		ddfy += dddfy;
-		pathLength += MathUtil::sqrt(dfx * dfx + dfy * dfy);
-		dfx += ddfx;
-		dfy += ddfy;
-		pathLength += MathUtil::sqrt(dfx * dfx + dfy * dfy);
-		dfx += ddfx + dddfx;
-		dfy += ddfy + dddfy;
-		pathLength += MathUtil::sqrt(dfx * dfx + dfy * dfy);
-		_curves[i] = pathLength;
-		x1 = x2;
-		y1 = y2;
-	}
 
 	if (percentPosition)
 		position *= pathLength;
@@ -403,7 +380,7 @@ PathConstraint::computeWorldPositions(PathAttachment &path, int spacesCount, boo
 			_spaces[i] *= pathLength;
 	}
 
-	float curveLength = 0;
+	float curveLength = 0, *segments = NULL;
 	for (int i = 0, o = 0, curve = 0, segment = 0; i < spacesCount; i++, o += 3) {
 		float space = _spaces[i];
 		position += space;
@@ -446,44 +423,48 @@ PathConstraint::computeWorldPositions(PathAttachment &path, int spacesCount, boo
 			cy2 = world[ii + 5];
 			x2 = world[ii + 6];
 			y2 = world[ii + 7];
-			tmpx = (x1 - cx1 * 2 + cx2) * 0.03f;
-			tmpy = (y1 - cy1 * 2 + cy2) * 0.03f;
-			dddfx = ((cx1 - cx2) * 3 - x1 + x2) * 0.006f;
-			dddfy = ((cy1 - cy2) * 3 - y1 + y2) * 0.006f;
-			ddfx = tmpx * 2 + dddfx;
-			ddfy = tmpy * 2 + dddfy;
-			dfx = (cx1 - x1) * 0.3f + tmpx + dddfx * 0.16666667f;
-			dfy = (cy1 - y1) * 0.3f + tmpy + dddfy * 0.16666667f;
-			curveLength = MathUtil::sqrt(dfx * dfx + dfy * dfy);
-			_segments[0] = curveLength;
-			for (ii = 1; ii < 8; ii++) {
+			segments = _segments.buffer() + curve * 10;
+			if (segments[0] < 0) {
+				tmpx = (x1 - cx1 * 2 + cx2) * 0.03f;
+				tmpy = (y1 - cy1 * 2 + cy2) * 0.03f;
+				dddfx = ((cx1 - cx2) * 3 - x1 + x2) * 0.006f;
+				dddfy = ((cy1 - cy2) * 3 - y1 + y2) * 0.006f;
+				ddfx = tmpx * 2 + dddfx;
+				ddfy = tmpy * 2 + dddfy;
+				dfx = (cx1 - x1) * 0.3f + tmpx + dddfx * 0.16666667f;
+				dfy = (cy1 - y1) * 0.3f + tmpy + dddfy * 0.16666667f;
+				curveLength = MathUtil::sqrt(dfx * dfx + dfy * dfy);
+				segments[0] = curveLength;
+				for (ii = 1; ii < 8; ii++) {
+					dfx += ddfx;
+					dfy += ddfy;
+					ddfx += dddfx;
+					ddfy += dddfy;
+					curveLength += MathUtil::sqrt(dfx * dfx + dfy * dfy);
+					segments[ii] = curveLength;
+				}
 				dfx += ddfx;
 				dfy += ddfy;
-				ddfx += dddfx;
-				ddfy += dddfy;
 				curveLength += MathUtil::sqrt(dfx * dfx + dfy * dfy);
-				_segments[ii] = curveLength;
+				segments[8] = curveLength;
+				dfx += ddfx + dddfx;
+				dfy += ddfy + dddfy;
+				curveLength += MathUtil::sqrt(dfx * dfx + dfy * dfy);
+				segments[9] = curveLength;
 			}
-			dfx += ddfx;
-			dfy += ddfy;
-			curveLength += MathUtil::sqrt(dfx * dfx + dfy * dfy);
-			_segments[8] = curveLength;
-			dfx += ddfx + dddfx;
-			dfy += ddfy + dddfy;
-			curveLength += MathUtil::sqrt(dfx * dfx + dfy * dfy);
-			_segments[9] = curveLength;
+			curveLength = segments[9];
 			segment = 0;
 		}
 
 		// Weight by segment length.
 		p *= curveLength;
 		for (;; segment++) {
-			float length = _segments[segment];
+			float length = segments[segment];
 			if (p > length) continue;
 			if (segment == 0)
 				p /= length;
 			else {
-				float prev = _segments[segment - 1];
+				float prev = segments[segment - 1];
 				p = segment + (p - prev) / (length - prev);
 			}
 			break;
@@ -500,9 +481,10 @@ void PathConstraint::addBeforePosition(float p, Vector<float> &temp, int i, Vect
 	float y1 = temp[i + 1];
 	float dx = temp[i + 2] - x1;
 	float dy = temp[i + 3] - y1;
-	float r = MathUtil::atan2(dy, dx);
-	output[o] = x1 + p * MathUtil::cos(r);
-	output[o + 1] = y1 + p * MathUtil::sin(r);
+	float r = MathUtil::atan2(dy, dx), sin, cos;
+	MathUtil::sinCos(r, sin, cos);
+	output[o] = x1 + p * cos;
+	output[o + 1] = y1 + p * sin;
 	output[o + 2] = r;
 }
 
@@ -511,9 +493,10 @@ void PathConstraint::addAfterPosition(float p, Vector<float> &temp, int i, Vecto
 	float y1 = temp[i + 3];
 	float dx = x1 - temp[i];
 	float dy = y1 - temp[i + 1];
-	float r = MathUtil::atan2(dy, dx);
-	output[o] = x1 + p * MathUtil::cos(r);
-	output[o + 1] = y1 + p * MathUtil::sin(r);
+	float r = MathUtil::atan2(dy, dx), sin, cos;
+	MathUtil::sinCos(r, sin, cos);
+	output[o] = x1 + p * cos;
+	output[o + 1] = y1 + p * sin;
 	output[o + 2] = r;
 }
 
@@ -540,6 +523,77 @@ void PathConstraint::addCurvePosition(float p, float x1, float y1, float cx1, fl
 	}
 }
 
+bool PathConstraint::updateCachedInputs(PathAttachment &path) {
+	if (!_geometryCacheEnabled) {
+		_cachedPath = NULL;
+		return false;
+	}
+
+	Slot &target = *_target;
+	bool same = true;
+	if (_cachedPath != &path || _cachedTarget != &target) {
+		_cachedPath = &path;
+		_cachedTarget = &target;
+		_cachedBones.clear();
+		Vector<size_t> &bones = path.getBones();
+		if (bones.size() == 0)
+			_cachedBones.add(&target.getBone());
+		else {
+			Vector<Bone *> &skeletonBones = target.getBone().getSkeleton().getBones();
+			for (size_t i = 0, n = bones.size(); i < n;) {
+				size_t end = i + 1 + bones[i];
+				for (i++; i < end; i++) {
+					Bone *bone = skeletonBones[bones[i]];
+					if (!_cachedBones.contains(bone)) _cachedBones.add(bone);
+				}
+			}
+		}
+		same = false;
+	}
+
+	size_t deformLength = target.getDeformLength();
+	size_t inputsCount = _cachedBones.size() * 6 + deformLength;
+	if (_cachedInputs.size() != inputsCount) {
+		_cachedInputs.setSize(inputsCount, 0);
+		same = false;
+	}
+	float *inputs = _cachedInputs.buffer();
+	for (size_t i = 0, n = _cachedBones.size(); i < n; i++, inputs += 6) {
+		Bone &bone = *_cachedBones[i];
+		if (inputs[0] != bone._a || inputs[1] != bone._b || inputs[2] != bone._c || inputs[3] != bone._d ||
+			inputs[4] != bone._worldX || inputs[5] != bone._worldY) {
+			inputs[0] = bone._a;
+			inputs[1] = bone._b;
+			inputs[2] = bone._c;
+			inputs[3] = bone._d;
+			inputs[4] = bone._worldX;
+			inputs[5] = bone._worldY;
+			same = false;
+		}
+	}
+	const float *deformValues = target.getDeformVertices();
+	for (size_t i = 0; i < deformLength; i++) {
+		if (inputs[i] != deformValues[i]) {
+			inputs[i] = deformValues[i];
+			same = false;
+		}
+	}
+	return same;
+}
+
+void PathConstraint::setGeometryCacheEnabled(bool inValue) {
+	_geometryCacheEnabled = inValue;
+	_cachedPath = NULL;
+}
+
+bool PathConstraint::isGeometryCacheEnabled() {
+	return _geometryCacheEnabled;
+}
+
+void PathConstraint::invalidateGeometryCache() {
+	_cachedPath = NULL;
+}
+
 bool PathConstraint::isActive() {
 	return _active;
 }
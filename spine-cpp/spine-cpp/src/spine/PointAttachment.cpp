@@ -49,8 +49,8 @@ void PointAttachment::computeWorldPosition(Bone &bone, float &ox, float &oy) {
 }
 
 float PointAttachment::computeWorldRotation(Bone &bone) {
-	float cos = MathUtil::cosDeg(_rotation);
-	float sin = MathUtil::sinDeg(_rotation);
+	float sin, cos;
+	MathUtil::sinCosDeg(_rotation, sin, cos);
 	float ix = cos * bone._a + sin * bone._b;
 	float iy = cos * bone._c + sin * bone._d;
 
@@ -0,0 +1,563 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifdef SPINE_UE4
+#include "SpinePluginPrivatePCH.h"
+#endif
+
+#include <spine/ProfilingExtension.h>
+
+#include <string.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#if !defined(SPINE_NO_THREADS)
+#include <pthread.h>
+#endif
+#endif
+
+using namespace spine;
+
+ProfilingSpineExtension *ProfilingSpineExtension::_timerExtension = NULL;
+
+static size_t hashPointer(const void *pointer, int line) {
+	size_t hash = (size_t) pointer ^ (size_t) line;
+	hash ^= hash >> 16;
+	hash *= 0x45d9f3b;
+	hash ^= hash >> 16;
+	return hash;
+}
+
+static unsigned int currentThread() {
+#if defined(SPINE_NO_THREADS)
+	return 0;
+#elif defined(_WIN32)
+	return (unsigned int) GetCurrentThreadId();
+#else
+	pthread_t self = pthread_self();
+	size_t id = 0;
+	memcpy(&id, &self, sizeof(self) < sizeof(id) ? sizeof(self) : sizeof(id));
+	return (unsigned int) (id ^ ((id >> 16) >> 16));
+#endif
+}
+
+static void writeString(FILE *file, const char *value) {
+	fputc('"', file);
+	for (; *value; value++) {
+		if (*value == '"' || *value == '\\') fputc('\\', file);
+		fputc(*value, file);
+	}
+	fputc('"', file);
+}
+
+ProfilingSpineExtension::ProfilingSpineExtension(SpineExtension *extension) : _extension(extension),
+	_allocations(NULL),
+	_allocationsCapacity(0),
+	_allocationsCount(0),
+	_siteKeys(NULL),
+	_siteKeysCapacity(0),
+	_siteKeysCount(0),
+	_sites(NULL),
+	_sitesCapacity(0),
+	_sitesCount(0),
+	_timers(NULL),
+	_timersCapacity(0),
+	_timersCount(0),
+	_traceEvents(NULL),
+	_traceEventsCapacity(0),
+	_traceEventsCount(0),
+	_maxTraceEvents(65536),
+	_liveAllocations(0),
+	_liveBytes(0),
+	_peakLiveBytes(0),
+	_untrackedFrees(0),
+	_frameCount(0),
+	_frameAllocations(0),
+	_frameBytes(0),
+	_maxFrameAllocations(0),
+	_frameAllocationBudget((size_t) -1),
+	_framesOverBudget(0),
+	_frameStart(0) {
+}
+
+ProfilingSpineExtension::~ProfilingSpineExtension() {
+	if (_timerExtension == this) _timerExtension = NULL;
+	if (_allocations) _extension->_free(_allocations, __FILE__, __LINE__);
+	if (_siteKeys) _extension->_free(_siteKeys, __FILE__, __LINE__);
+	if (_sites) _extension->_free(_sites, __FILE__, __LINE__);
+	if (_timers) _extension->_free(_timers, __FILE__, __LINE__);
+	if (_traceEvents) _extension->_free(_traceEvents, __FILE__, __LINE__);
+}
+
+void ProfilingSpineExtension::beginFrame() {
+	MutexLock lock(_mutex);
+	_frameAllocations = 0;
+	_frameBytes = 0;
+	if (_timerExtension == this) _frameStart = now();
+}
+
+void ProfilingSpineExtension::endFrame() {
+	MutexLock lock(_mutex);
+	_frameCount++;
+	if (_frameAllocations > _maxFrameAllocations) _maxFrameAllocations = _frameAllocations;
+	if (_frameAllocations > _frameAllocationBudget) _framesOverBudget++;
+	if (_timerExtension == this) {
+		double end = now();
+		addTraceEvent("frame", _frameStart, end - _frameStart, 0, false);
+		addTraceEvent("allocations", end, 0, _frameAllocations, true);
+	}
+}
+
+size_t ProfilingSpineExtension::getFrameCount() {
+	MutexLock lock(_mutex);
+	return _frameCount;
+}
+
+size_t ProfilingSpineExtension::getFrameAllocations() {
+	MutexLock lock(_mutex);
+	return _frameAllocations;
+}
+
+size_t ProfilingSpineExtension::getFrameBytes() {
+	MutexLock lock(_mutex);
+	return _frameBytes;
+}
+
+size_t ProfilingSpineExtension::getMaxFrameAllocations() {
+	MutexLock lock(_mutex);
+	return _maxFrameAllocations;
+}
+
+void ProfilingSpineExtension::setFrameAllocationBudget(size_t budget) {
+	MutexLock lock(_mutex);
+	_frameAllocationBudget = budget;
+}
+
+size_t ProfilingSpineExtension::getFrameAllocationBudget() {
+	MutexLock lock(_mutex);
+	return _frameAllocationBudget;
+}
+
+size_t ProfilingSpineExtension::getFramesOverBudget() {
+	MutexLock lock(_mutex);
+	return _framesOverBudget;
+}
+
+size_t ProfilingSpineExtension::getCallSiteCount() {
+	MutexLock lock(_mutex);
+	return _sitesCount;
+}
+
+const ProfilingSpineExtension::CallSite &ProfilingSpineExtension::getCallSite(size_t index) {
+	MutexLock lock(_mutex);
+	return _sites[index];
+}
+
+size_t ProfilingSpineExtension::getLiveAllocations() {
+	MutexLock lock(_mutex);
+	return _liveAllocations;
+}
+
+size_t ProfilingSpineExtension::getLiveBytes() {
+	MutexLock lock(_mutex);
+	return _liveBytes;
+}
+
+size_t ProfilingSpineExtension::getPeakLiveBytes() {
+	MutexLock lock(_mutex);
+	return _peakLiveBytes;
+}
+
+size_t ProfilingSpineExtension::getUntrackedFrees() {
+	MutexLock lock(_mutex);
+	return _untrackedFrees;
+}
+
+size_t ProfilingSpineExtension::reportLeaks() {
+	MutexLock lock(_mutex);
+	for (size_t i = 0; i < _sitesCount; i++) {
+		CallSite &site = _sites[i];
+		if (site.liveAllocations == 0) continue;
+		printf("%s:%i: %lu allocations, %lu bytes\n", site.file, site.line, (unsigned long) site.liveAllocations,
+			(unsigned long) site.liveBytes);
+	}
+	printf("live allocations: %lu, live bytes: %lu, peak live bytes: %lu\n", (unsigned long) _liveAllocations,
+		(unsigned long) _liveBytes, (unsigned long) _peakLiveBytes);
+	return _liveAllocations;
+}
+
+void ProfilingSpineExtension::reset() {
+	MutexLock lock(_mutex);
+	for (size_t i = 0; i < _sitesCount; i++) {
+		CallSite &site = _sites[i];
+		site.allocations = 0;
+		site.reallocations = 0;
+		site.frees = 0;
+		site.bytes = 0;
+		site.peakLiveBytes = site.liveBytes;
+	}
+	for (size_t i = 0; i < _timersCount; i++) {
+		Timer &timer = _timers[i];
+		timer.count = 0;
+		timer.total = timer.min = timer.max = 0;
+	}
+	_traceEventsCount = 0;
+	_peakLiveBytes = _liveBytes;
+	_untrackedFrees = 0;
+	_frameCount = 0;
+	_frameAllocations = 0;
+	_frameBytes = 0;
+	_maxFrameAllocations = 0;
+	_framesOverBudget = 0;
+}
+
+void ProfilingSpineExtension::setTimersEnabled(bool enabled) {
+	MutexLock lock(_mutex);
+	if (!enabled) {
+		if (_timerExtension == this) _timerExtension = NULL;
+		return;
+	}
+	if (_traceEventsCapacity != _maxTraceEvents) {
+		_traceEvents = (TraceEvent *) _extension->_realloc(_traceEvents, sizeof(TraceEvent) * _maxTraceEvents, __FILE__,
+			__LINE__);
+		_traceEventsCapacity = _maxTraceEvents;
+		if (_traceEventsCount > _traceEventsCapacity) _traceEventsCount = _traceEventsCapacity;
+	}
+	_timerExtension = this;
+}
+
+bool ProfilingSpineExtension::isTimersEnabled() {
+	return _timerExtension == this;
+}
+
+void ProfilingSpineExtension::setMaxTraceEvents(size_t maxTraceEvents) {
+	MutexLock lock(_mutex);
+	_maxTraceEvents = maxTraceEvents;
+}
+
+size_t ProfilingSpineExtension::getTimerCount() {
+	MutexLock lock(_mutex);
+	return _timersCount;
+}
+
+const ProfilingSpineExtension::Timer &ProfilingSpineExtension::getTimer(size_t index) {
+	MutexLock lock(_mutex);
+	return _timers[index];
+}
+
+void ProfilingSpineExtension::addTimer(const char *name, double start, double end) {
+	MutexLock lock(_mutex);
+	double duration = end - start;
+	// There are few timed scopes, so they are searched linearly. The same literal can have different addresses in
+	// different translation units.
+	Timer *timer = NULL;
+	for (size_t i = 0; i < _timersCount; i++) {
+		if (_timers[i].name == name || strcmp(_timers[i].name, name) == 0) {
+			timer = _timers + i;
+			break;
+		}
+	}
+	if (!timer) {
+		if (_timersCount == _timersCapacity) _timers = grow(_timers, _timersCapacity);
+		timer = _timers + _timersCount++;
+		timer->name = name;
+		timer->count = 0;
+	}
+	if (timer->count == 0) {
+		timer->total = 0;
+		timer->min = timer->max = duration;
+	}
+	timer->count++;
+	timer->total += duration;
+	if (duration < timer->min) timer->min = duration;
+	if (duration > timer->max) timer->max = duration;
+	addTraceEvent(name, start, duration, 0, false);
+}
+
+void ProfilingSpineExtension::writeJson(FILE *file) {
+	MutexLock lock(_mutex);
+	fprintf(file, "{\n\t\"frames\": {\"count\": %lu, \"maxAllocations\": %lu, \"overBudget\": %lu, \"budget\": ",
+		(unsigned long) _frameCount, (unsigned long) _maxFrameAllocations, (unsigned long) _framesOverBudget);
+	if (_frameAllocationBudget == (size_t) -1)
+		fprintf(file, "null},\n");
+	else
+		fprintf(file, "%lu},\n", (unsigned long) _frameAllocationBudget);
+	fprintf(file, "\t\"memory\": {\"liveAllocations\": %lu, \"liveBytes\": %lu, \"peakLiveBytes\": %lu, \"untrackedFrees\": %lu},\n",
+		(unsigned long) _liveAllocations, (unsigned long) _liveBytes, (unsigned long) _peakLiveBytes,
+		(unsigned long) _untrackedFrees);
+	fprintf(file, "\t\"callSites\": [");
+	for (size_t i = 0; i < _sitesCount; i++) {
+		CallSite &site = _sites[i];
+		fprintf(file, i == 0 ? "\n\t\t{\"file\": " : ",\n\t\t{\"file\": ");
+		writeString(file, site.file);
+		fprintf(file, ", \"line\": %i, \"allocations\": %lu, \"reallocations\": %lu, \"frees\": %lu, \"bytes\": %lu, "
+			"\"liveAllocations\": %lu, \"liveBytes\": %lu, \"peakLiveBytes\": %lu}", site.line,
+			(unsigned long) site.allocations, (unsigned long) site.reallocations, (unsigned long) site.frees,
+			(unsigned long) site.bytes, (unsigned long) site.liveAllocations, (unsigned long) site.liveBytes,
+			(unsigned long) site.peakLiveBytes);
+	}
+	fprintf(file, "\n\t],\n\t\"timers\": [");
+	for (size_t i = 0; i < _timersCount; i++) {
+		Timer &timer = _timers[i];
+		fprintf(file, i == 0 ? "\n\t\t{\"name\": " : ",\n\t\t{\"name\": ");
+		writeString(file, timer.name);
+		fprintf(file, ", \"count\": %lu, \"totalUs\": %.3f, \"meanUs\": %.3f, \"minUs\": %.3f, \"maxUs\": %.3f}",
+			(unsigned long) timer.count, timer.total, timer.count ? timer.total / timer.count : 0.0, timer.min, timer.max);
+	}
+	fprintf(file, "\n\t]\n}\n");
+}
+
+void ProfilingSpineExtension::writeChromeTrace(FILE *file) {
+	MutexLock lock(_mutex);
+	fprintf(file, "{\"traceEvents\": [");
+	for (size_t i = 0; i < _traceEventsCount; i++) {
+		TraceEvent &event = _traceEvents[i];
+		fprintf(file, i == 0 ? "\n{\"name\": " : ",\n{\"name\": ");
+		writeString(file, event.name);
+		if (event.counter)
+			fprintf(file, ", \"ph\": \"C\", \"ts\": %.3f, \"pid\": 1, \"tid\": %u, \"args\": {\"value\": %lu}}", event.start,
+				event.thread, (unsigned long) event.value);
+		else
+			fprintf(file, ", \"ph\": \"X\", \"ts\": %.3f, \"dur\": %.3f, \"pid\": 1, \"tid\": %u}", event.start,
+				event.duration, event.thread);
+	}
+	fprintf(file, "\n]}\n");
+}
+
+double ProfilingSpineExtension::now() {
+#ifdef _WIN32
+	LARGE_INTEGER frequency, counter;
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&counter);
+	return (double) counter.QuadPart * 1e6 / (double) frequency.QuadPart;
+#else
+	timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (double) now.tv_sec * 1e6 + (double) now.tv_nsec * 1e-3;
+#endif
+}
+
+ProfilingSpineExtension *ProfilingSpineExtension::getTimerExtension() {
+	return _timerExtension;
+}
+
+void *ProfilingSpineExtension::_alloc(size_t size, const char *file, int line) {
+	MutexLock lock(_mutex);
+	void *result = _extension->_alloc(size, file, line);
+	if (!result) return result;
+	size_t site = findSite(file, line);
+	_sites[site].allocations++;
+	_sites[site].bytes += size;
+	_frameAllocations++;
+	_frameBytes += size;
+	track(result, size, site);
+	return result;
+}
+
+void *ProfilingSpineExtension::_calloc(size_t size, const char *file, int line) {
+	MutexLock lock(_mutex);
+	void *result = _extension->_calloc(size, file, line);
+	if (!result) return result;
+	size_t site = findSite(file, line);
+	_sites[site].allocations++;
+	_sites[site].bytes += size;
+	_frameAllocations++;
+	_frameBytes += size;
+	track(result, size, site);
+	return result;
+}
+
+void *ProfilingSpineExtension::_realloc(void *ptr, size_t size, const char *file, int line) {
+	MutexLock lock(_mutex);
+	void *result = _extension->_realloc(ptr, size, file, line);
+	if (!result && size) return result;
+	size_t oldSize, oldSite;
+	if (ptr && untrack(ptr, oldSize, oldSite)) _sites[oldSite].frees++;
+	if (!result) return result;
+	size_t site = findSite(file, line);
+	_sites[site].reallocations++;
+	_sites[site].bytes += size;
+	_frameAllocations++;
+	_frameBytes += size;
+	track(result, size, site);
+	return result;
+}
+
+void ProfilingSpineExtension::_free(void *mem, const char *file, int line) {
+	MutexLock lock(_mutex);
+	if (mem) {
+		size_t size, site;
+		if (untrack(mem, size, site))
+			_sites[site].frees++;
+		else
+			_untrackedFrees++;
+	}
+	_extension->_free(mem, file, line);
+}
+
+char *ProfilingSpineExtension::_readFile(const String &path, int *length) {
+	return _extension->_readFile(path, length);
+}
+
+size_t ProfilingSpineExtension::findSite(const char *file, int line) {
+	size_t mask = _siteKeysCapacity - 1;
+	if (_siteKeysCapacity) {
+		for (size_t i = hashPointer(file, line) & mask;; i = (i + 1) & mask) {
+			SiteKey &key = _siteKeys[i];
+			if (!key.file) break;
+			if (key.file == file && key.line == line) return key.site;
+		}
+	}
+
+	// A new file pointer. The same header has a different __FILE__ pointer in each translation unit, so sites are
+	// merged by name.
+	size_t site = _sitesCount;
+	for (size_t i = 0; i < _sitesCount; i++) {
+		if (_sites[i].line == line && strcmp(_sites[i].file, file) == 0) {
+			site = i;
+			break;
+		}
+	}
+	if (site == _sitesCount) {
+		if (_sitesCount == _sitesCapacity) _sites = grow(_sites, _sitesCapacity);
+		CallSite &callSite = _sites[_sitesCount++];
+		memset(&callSite, 0, sizeof(CallSite));
+		callSite.file = file;
+		callSite.line = line;
+	}
+
+	if ((_siteKeysCount + 1) * 2 > _siteKeysCapacity) growSiteKeys();
+	mask = _siteKeysCapacity - 1;
+	size_t i = hashPointer(file, line) & mask;
+	while (_siteKeys[i].file) i = (i + 1) & mask;
+	_siteKeys[i].file = file;
+	_siteKeys[i].line = line;
+	_siteKeys[i].site = site;
+	_siteKeysCount++;
+	return site;
+}
+
+void ProfilingSpineExtension::track(void *address, size_t size, size_t site) {
+	if ((_allocationsCount + 1) * 2 > _allocationsCapacity) growAllocations();
+	size_t mask = _allocationsCapacity - 1;
+	size_t i = hashPointer(address, 0) & mask;
+	while (_allocations[i].address) i = (i + 1) & mask;
+	_allocations[i].address = address;
+	_allocations[i].size = size;
+	_allocations[i].site = site;
+	_allocationsCount++;
+
+	CallSite &callSite = _sites[site];
+	callSite.liveAllocations++;
+	callSite.liveBytes += size;
+	if (callSite.liveBytes > callSite.peakLiveBytes) callSite.peakLiveBytes = callSite.liveBytes;
+	_liveAllocations++;
+	_liveBytes += size;
+	if (_liveBytes > _peakLiveBytes) _peakLiveBytes = _liveBytes;
+}
+
+bool ProfilingSpineExtension::untrack(void *address, size_t &size, size_t &site) {
+	if (!_allocationsCapacity) return false;
+	size_t mask = _allocationsCapacity - 1;
+	size_t i = hashPointer(address, 0) & mask;
+	for (;; i = (i + 1) & mask) {
+		if (!_allocations[i].address) return false;
+		if (_allocations[i].address == address) break;
+	}
+	size = _allocations[i].size;
+	site = _allocations[i].site;
+
+	// Shift the following entries of the probe sequence back, so lookups need no tombstones.
+	for (size_t j = (i + 1) & mask; _allocations[j].address; j = (j + 1) & mask) {
+		size_t home = hashPointer(_allocations[j].address, 0) & mask;
+		if (((j - home) & mask) >= ((j - i) & mask)) {
+			_allocations[i] = _allocations[j];
+			i = j;
+		}
+	}
+	_allocations[i].address = NULL;
+	_allocationsCount--;
+
+	CallSite &callSite = _sites[site];
+	callSite.liveAllocations--;
+	callSite.liveBytes -= size;
+	_liveAllocations--;
+	_liveBytes -= size;
+	return true;
+}
+
+void ProfilingSpineExtension::growAllocations() {
+	Allocation *old = _allocations;
+	size_t oldCapacity = _allocationsCapacity;
+	_allocationsCapacity = oldCapacity ? oldCapacity << 1 : 1024;
+	_allocations = (Allocation *) _extension->_calloc(sizeof(Allocation) * _allocationsCapacity, __FILE__, __LINE__);
+	size_t mask = _allocationsCapacity - 1;
+	for (size_t i = 0; i < oldCapacity; i++) {
+		if (!old[i].address) continue;
+		size_t ii = hashPointer(old[i].address, 0) & mask;
+		while (_allocations[ii].address) ii = (ii + 1) & mask;
+		_allocations[ii] = old[i];
+	}
+	if (old) _extension->_free(old, __FILE__, __LINE__);
+}
+
+void ProfilingSpineExtension::growSiteKeys() {
+	SiteKey *old = _siteKeys;
+	size_t oldCapacity = _siteKeysCapacity;
+	_siteKeysCapacity = oldCapacity ? oldCapacity << 1 : 256;
+	_siteKeys = (SiteKey *) _extension->_calloc(sizeof(SiteKey) * _siteKeysCapacity, __FILE__, __LINE__);
+	size_t mask = _siteKeysCapacity - 1;
+	for (size_t i = 0; i < oldCapacity; i++) {
+		if (!old[i].file) continue;
+		size_t ii = hashPointer(old[i].file, old[i].line) & mask;
+		while (_siteKeys[ii].file) ii = (ii + 1) & mask;
+		_siteKeys[ii] = old[i];
+	}
+	if (old) _extension->_free(old, __FILE__, __LINE__);
+}
+
+template<typename T>
+T *ProfilingSpineExtension::grow(T *items, size_t &capacity) {
+	capacity = capacity ? capacity << 1 : 64;
+	return (T *) _extension->_realloc(items, sizeof(T) * capacity, __FILE__, __LINE__);
+}
+
+void ProfilingSpineExtension::addTraceEvent(const char *name, double start, double duration, size_t value, bool counter) {
+	if (_traceEventsCount == _traceEventsCapacity) return;
+	TraceEvent &event = _traceEvents[_traceEventsCount++];
+	event.name = name;
+	event.start = start;
+	event.duration = duration;
+	event.value = value;
+	event.thread = currentThread();
+	event.counter = counter;
+}
@@ -0,0 +1,106 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifdef SPINE_UE4
+#include "SpinePluginPrivatePCH.h"
+#endif
+
+#include <spine/QuantizedFrames.h>
+
+#include <spine/MathUtil.h>
+
+using namespace spine;
+
+QuantizedFrames::QuantizedFrames(const float *frames, int frameCount, int entries, const float *times) : _times(times),
+	_frameCount(frameCount), _valueCount(entries - 1), _maxError(0) {
+	assert(_valueCount > 0 && _valueCount <= MAX_VALUES);
+
+	for (int i = 0; i < _valueCount; i++) {
+		float min = frames[i + 1], max = min;
+		for (int frame = 1; frame < frameCount; frame++) {
+			float value = frames[frame * entries + i + 1];
+			min = MathUtil::min(min, value);
+			max = MathUtil::max(max, value);
+		}
+		float step = (max - min) / 65534;
+		_steps[i] = step;
+		if (min <= 0 && max >= 0 && step != 0) {
+			_offsets[i] = 0;
+			_biases[i] = (int) MathUtil::clamp(-min / step + 0.5f, 0, 65535);
+		} else {
+			_offsets[i] = min;
+			_biases[i] = 0;
+		}
+	}
+
+	_values.ensureCapacity(frameCount * _valueCount);
+	_values.setSize(frameCount * _valueCount, 0);
+	for (int frame = 0; frame < frameCount; frame++) {
+		for (int i = 0; i < _valueCount; i++) {
+			float value = frames[frame * entries + i + 1];
+			unsigned short &quantized = _values[frame * _valueCount + i];
+			if (_steps[i] != 0) {
+				quantized = (unsigned short) MathUtil::clamp((value - _offsets[i]) / _steps[i] + _biases[i] + 0.5f, 0, 65535);
+			}
+			_maxError = MathUtil::max(_maxError, MathUtil::abs(_offsets[i] + (quantized - _biases[i]) * _steps[i] - value));
+		}
+	}
+}
+
+int QuantizedFrames::decode(float time, float *window, int &outFirstFrame) {
+	int first = 0, count = _frameCount < 2 ? _frameCount : 2;
+	if (count == 2 && time >= _times[1]) {
+		int low = 1, high = _frameCount - 1;
+		if (time >= _times[high])
+			first = high - 1;
+		else {
+			// _times[low] <= time < _times[high].
+			while (high - low > 1) {
+				int current = (low + high) >> 1;
+				if (_times[current] <= time)
+					low = current;
+				else
+					high = current;
+			}
+			first = low;
+		}
+	}
+
+	int entries = _valueCount + 1;
+	for (int i = 0; i < count; i++) {
+		float *frame = window + i * entries;
+		const unsigned short *values = _values.buffer() + (first + i) * _valueCount;
+		frame[0] = _times[first + i];
+		for (int ii = 0; ii < _valueCount; ii++)
+			frame[ii + 1] = _offsets[ii] + (values[ii] - _biases[ii]) * _steps[ii];
+	}
+	outFirstFrame = first;
+	return count * entries;
+}
@@ -34,6 +34,7 @@
 #include <spine/RegionAttachment.h>
 
 #include <spine/Bone.h>
+#include <spine/SimdUtil.h>
 
 #include <assert.h>
 
@@ -82,8 +83,8 @@ void RegionAttachment::updateOffset() {
 	float localY = -_height / 2 * _scaleY + _regionOffsetY * regionScaleY;
 	float localX2 = localX + _regionWidth * regionScaleX;
 	float localY2 = localY + _regionHeight * regionScaleY;
-	float cos = MathUtil::cosDeg(_rotation);
-	float sin = MathUtil::sinDeg(_rotation);
+	float sin, cos;
+	MathUtil::sinCosDeg(_rotation, sin, cos);
 	float localXCos = localX * cos + _x;
 	float localXSin = localX * sin;
 	float localYCos = localY * cos + _y;
@@ -131,32 +132,25 @@ void RegionAttachment::computeWorldVertices(Bone &bone, Vector<float> &worldVert
 }
 
 void RegionAttachment::computeWorldVertices(Bone &bone, float* worldVertices, size_t offset, size_t stride) {
-	float x = bone.getWorldX(), y = bone.getWorldY();
-	float a = bone.getA(), b = bone.getB(), c = bone.getC(), d = bone.getD();
-	float offsetX, offsetY;
-
-	offsetX = _vertexOffset[BRX];
-	offsetY = _vertexOffset[BRY];
-	worldVertices[offset] = offsetX * a + offsetY * b + x; // br
-	worldVertices[offset + 1] = offsetX * c + offsetY * d + y;
+	// The offsets are stored bl, ul, ur, br but written br, bl, ul, ur.
+	float world[8];
+	SimdUtil::transform(_vertexOffset.buffer(), 4, bone.getA(), bone.getB(), bone.getC(), bone.getD(), bone.getWorldX(),
+		bone.getWorldY(), world, 2);
+
+	worldVertices[offset] = world[BRX]; // br
+	worldVertices[offset + 1] = world[BRY];
 	offset += stride;
 
-	offsetX = _vertexOffset[BLX];
-	offsetY = _vertexOffset[BLY];
-	worldVertices[offset] = offsetX * a + offsetY * b + x; // bl
-	worldVertices[offset + 1] = offsetX * c + offsetY * d + y;
+	worldVertices[offset] = world[BLX]; // bl
+	worldVertices[offset + 1] = world[BLY];
 	offset += stride;
 
-	offsetX = _vertexOffset[ULX];
-	offsetY = _vertexOffset[ULY];
-	worldVertices[offset] = offsetX * a + offsetY * b + x; // ul
-	worldVertices[offset + 1] = offsetX * c + offsetY * d + y;
+	worldVertices[offset] = world[ULX]; // ul
+	worldVertices[offset + 1] = world[ULY];
 	offset += stride;
 
-	offsetX = _vertexOffset[URX];
-	offsetY = _vertexOffset[URY];
-	worldVertices[offset] = offsetX * a + offsetY * b + x; // ur
-	worldVertices[offset + 1] = offsetX * c + offsetY * d + y;
+	worldVertices[offset] = world[URX]; // ur
+	worldVertices[offset + 1] = world[URY];
 }
 
 float RegionAttachment::getX() {
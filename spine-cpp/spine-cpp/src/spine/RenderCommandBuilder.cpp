@@ -0,0 +1,240 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifdef SPINE_UE4
+#include "SpinePluginPrivatePCH.h"
+#endif
+
+#include <spine/RenderCommandBuilder.h>
+
+#include <spine/Atlas.h>
+#include <spine/Bone.h>
+#include <spine/ClippingAttachment.h>
+#include <spine/MeshAttachment.h>
+#include <spine/RegionAttachment.h>
+#include <spine/Skeleton.h>
+#include <spine/Slot.h>
+#include <spine/SlotData.h>
+#include <spine/VertexEffect.h>
+
+#include <string.h>
+
+using namespace spine;
+
+static unsigned int toByte(float value) {
+	if (value <= 0) return 0;
+	if (value >= 1) return 255;
+	return (unsigned int) (value * 255 + 0.5f);
+}
+
+static void *getTexture(void *rendererObject) {
+	return rendererObject ? ((AtlasRegion *) rendererObject)->page->getRendererObject() : NULL;
+}
+
+RenderCommandBuilder::RenderCommandBuilder() : _usePremultipliedAlpha(false), _useTwoColorTint(false),
+	_vertexEffect(NULL) {
+	unsigned short quadIndices[] = {0, 1, 2, 2, 3, 0};
+	for (int i = 0; i < 6; i++)
+		_quadIndices.add(quadIndices[i]);
+}
+
+unsigned int RenderCommandBuilder::packColor(float r, float g, float b, float a) {
+	return toByte(r) | (toByte(g) << 8) | (toByte(b) << 16) | (toByte(a) << 24);
+}
+
+void RenderCommandBuilder::clear() {
+	_commands.clear();
+	_positions.clear();
+	_uvs.clear();
+	_colors.clear();
+	_darkColors.clear();
+	_indices.clear();
+}
+
+DrawCommand &RenderCommandBuilder::nextCommand(void *texture, BlendMode blendMode, size_t vertexCount) {
+	if (_commands.size() > 0) {
+		DrawCommand &last = _commands[_commands.size() - 1];
+		if (last.texture == texture && last.blendMode == blendMode && last.vertexCount + vertexCount <= (size_t) MaxVertices)
+			return last;
+	}
+	DrawCommand command;
+	command.texture = texture;
+	command.blendMode = blendMode;
+	command.firstVertex = _colors.size();
+	command.vertexCount = 0;
+	command.firstIndex = _indices.size();
+	command.indexCount = 0;
+	_commands.add(command);
+	return _commands[_commands.size() - 1];
+}
+
+void RenderCommandBuilder::add(Skeleton &skeleton) {
+	Color &skeletonColor = skeleton.getColor();
+	if (skeletonColor.a == 0) return;
+
+	if (_vertexEffect) _vertexEffect->begin(skeleton);
+
+	Vector<Slot *> &drawOrder = skeleton.getDrawOrder();
+	for (size_t i = 0, n = drawOrder.size(); i < n; ++i) {
+		Slot &slot = *drawOrder[i];
+		Attachment *attachment = slot.getAttachment();
+		if (!attachment || slot.getColor().a == 0 || !slot.getBone().isActive()) {
+			_clipper.clipEnd(slot);
+			continue;
+		}
+
+		RegionAttachment *region = NULL;
+		MeshAttachment *mesh = NULL;
+		size_t verticesCount;
+		float *uvs;
+		unsigned short *indices;
+		size_t indicesCount;
+		Color *attachmentColor;
+		void *texture;
+
+		if (attachment->getRTTI().isExactly(RegionAttachment::rtti)) {
+			region = (RegionAttachment *) attachment;
+			attachmentColor = &region->getColor();
+			verticesCount = 4;
+			uvs = region->getUVs().buffer();
+			indices = _quadIndices.buffer();
+			indicesCount = 6;
+			texture = getTexture(region->getRendererObject());
+		} else if (attachment->getRTTI().isExactly(MeshAttachment::rtti)) {
+			mesh = (MeshAttachment *) attachment;
+			attachmentColor = &mesh->getColor();
+			verticesCount = mesh->getWorldVerticesLength() >> 1;
+			uvs = mesh->getUVs().buffer();
+			indices = mesh->getTriangles().buffer();
+			indicesCount = mesh->getTriangles().size();
+			texture = getTexture(mesh->getRendererObject());
+		} else if (attachment->getRTTI().isExactly(ClippingAttachment::rtti)) {
+			_clipper.clipStart(slot, (ClippingAttachment *) attachment);
+			continue;
+		} else {
+			_clipper.clipEnd(slot);
+			continue;
+		}
+		if (attachmentColor->a == 0) {
+			_clipper.clipEnd(slot);
+			continue;
+		}
+
+		// Without clipping the world vertices are computed directly into the positions, otherwise into a scratch buffer
+		// that is clipped.
+		size_t firstVertex = _colors.size();
+		float *vertices;
+		if (_clipper.isClipping()) {
+			_worldVertices.setSize(verticesCount << 1, 0);
+			if (region)
+				region->computeWorldVertices(slot.getBone(), _worldVertices, 0, 2);
+			else
+				mesh->computeWorldVertices(slot, 0, verticesCount << 1, _worldVertices, 0, 2);
+			_clipper.clipTriangles(_worldVertices.buffer(), indices, indicesCount, uvs, 2);
+			vertices = _clipper.getClippedVertices().buffer();
+			verticesCount = _clipper.getClippedVertices().size() >> 1;
+			uvs = _clipper.getClippedUVs().buffer();
+			indices = _clipper.getClippedTriangles().buffer();
+			indicesCount = _clipper.getClippedTriangles().size();
+			if (indicesCount == 0) {
+				_clipper.clipEnd(slot);
+				continue;
+			}
+			_positions.setSize((firstVertex + verticesCount) << 1, 0);
+			memcpy(_positions.buffer() + (firstVertex << 1), vertices, (verticesCount << 1) * sizeof(float));
+		} else {
+			_positions.setSize((firstVertex + verticesCount) << 1, 0);
+			if (region)
+				region->computeWorldVertices(slot.getBone(), _positions, firstVertex << 1, 2);
+			else
+				mesh->computeWorldVertices(slot, 0, verticesCount << 1, _positions, firstVertex << 1, 2);
+		}
+		// The colors are not appended yet, so a new command starts at firstVertex.
+		DrawCommand &command = nextCommand(texture, slot.getData().getBlendMode(), verticesCount);
+		_uvs.setSize((firstVertex + verticesCount) << 1, 0);
+		memcpy(_uvs.buffer() + (firstVertex << 1), uvs, (verticesCount << 1) * sizeof(float));
+
+		Color &slotColor = slot.getColor();
+		Color light(skeletonColor.r * slotColor.r * attachmentColor->r, skeletonColor.g * slotColor.g * attachmentColor->g,
+			skeletonColor.b * slotColor.b * attachmentColor->b, skeletonColor.a * slotColor.a * attachmentColor->a);
+		Color dark(0, 0, 0, _usePremultipliedAlpha ? 1.0f : 0.0f);
+		if (slot.hasDarkColor()) {
+			Color &slotDark = slot.getDarkColor();
+			dark.r = slotDark.r;
+			dark.g = slotDark.g;
+			dark.b = slotDark.b;
+		}
+		if (_usePremultipliedAlpha) {
+			light.r *= light.a;
+			light.g *= light.a;
+			light.b *= light.a;
+		}
+
+		_colors.setSize(firstVertex + verticesCount, 0);
+		unsigned int *colors = _colors.buffer() + firstVertex, *darkColors = NULL;
+		if (_useTwoColorTint) {
+			_darkColors.setSize(firstVertex + verticesCount, 0);
+			darkColors = _darkColors.buffer() + firstVertex;
+		}
+		if (_vertexEffect) {
+			float *positions = _positions.buffer() + (firstVertex << 1), *vertexUVs = _uvs.buffer() + (firstVertex << 1);
+			for (size_t ii = 0; ii < verticesCount; ii++) {
+				Color vertexLight = light, vertexDark = dark;
+				_vertexEffect->transform(positions[ii << 1], positions[(ii << 1) + 1], vertexUVs[ii << 1],
+					vertexUVs[(ii << 1) + 1], vertexLight, vertexDark);
+				colors[ii] = packColor(vertexLight.r, vertexLight.g, vertexLight.b, vertexLight.a);
+				if (darkColors) darkColors[ii] = packColor(vertexDark.r, vertexDark.g, vertexDark.b, vertexDark.a);
+			}
+		} else {
+			unsigned int color = packColor(light.r, light.g, light.b, light.a);
+			for (size_t ii = 0; ii < verticesCount; ii++)
+				colors[ii] = color;
+			if (darkColors) {
+				unsigned int darkColor = packColor(dark.r, dark.g, dark.b, dark.a);
+				for (size_t ii = 0; ii < verticesCount; ii++)
+					darkColors[ii] = darkColor;
+			}
+		}
+
+		size_t firstIndex = _indices.size();
+		_indices.setSize(firstIndex + indicesCount, 0);
+		unsigned short *commandIndices = _indices.buffer() + firstIndex;
+		unsigned short offset = (unsigned short) (firstVertex - command.firstVertex);
+		for (size_t ii = 0; ii < indicesCount; ii++)
+			commandIndices[ii] = (unsigned short) (offset + indices[ii]);
+		command.vertexCount += verticesCount;
+		command.indexCount += indicesCount;
+
+		_clipper.clipEnd(slot);
+	}
+	_clipper.clipEnd();
+
+	if (_vertexEffect) _vertexEffect->end();
+}
@@ -40,34 +40,53 @@
 #include <spine/BoneData.h>
 #include <spine/Animation.h>
 #include <spine/TimelineType.h>
+#include <spine/QuantizedFrames.h>
 
 using namespace spine;
 
 RTTI_IMPL(RotateTimeline, CurveTimeline)
 
-RotateTimeline::RotateTimeline(int frameCount) : CurveTimeline(frameCount), _boneIndex(0) {
+RotateTimeline::RotateTimeline(int frameCount) : CurveTimeline(frameCount), _boneIndex(0), _quantized(NULL) {
 	_frames.setSize(frameCount << 1, 0);
 }
 
+RotateTimeline::~RotateTimeline() {
+	delete _quantized;
+}
+
 void RotateTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
 	MixBlend blend, MixDirection direction
 ) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
-	SP_UNUSED(direction);
 
 	Bone *bone = skeleton.getBones()[_boneIndex];
 	if (!bone->_active) return;
 
-	if (time < _frames[0]) {
+	if (_quantized) {
+		float window[QuantizedFrames::MAX_WINDOW_SIZE];
+		int firstFrame, size = _quantized->decode(time, window, firstFrame);
+		applyFrames(*bone, window, size, getCurve(firstFrame), time, alpha, blend, direction, NULL);
+		return;
+	}
+
+	applyFrames(*bone, _frames.buffer(), (int)_frames.size(), getCurves().buffer(), time, alpha, blend, direction, NULL);
+}
+
+void RotateTimeline::applyFrames(Bone &bone, const float *frames, int size, const float *curves, float time, float alpha,
+	MixBlend blend, MixDirection direction, int *cursor
+) {
+	SP_UNUSED(direction);
+
+	if (time < frames[0]) {
 		switch (blend) {
 		case MixBlend_Setup: {
-			bone->_rotation = bone->_data._rotation;
+			bone._rotation = bone._data._rotation;
 			break;
 		}
 		case MixBlend_First: {
-			float r = bone->_data._rotation - bone->_rotation;
-			bone->_rotation += (r - (16384 - (int) (16384.499999999996 - r / 360)) * 360) * alpha;
+			float r = bone._data._rotation - bone._rotation;
+			bone._rotation += (r - (16384 - (int) (16384.499999999996 - r / 360)) * 360) * alpha;
 			break;
 		}
 		default: {
@@ -78,41 +97,41 @@ void RotateTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vecto
 		return;
 	}
 
-	if (time >= _frames[_frames.size() - ENTRIES]) {
-		float r = _frames[_frames.size() + PREV_ROTATION];
+	if (time >= frames[size - ENTRIES]) {
+		float r = frames[size + PREV_ROTATION];
 		switch (blend) {
 			case MixBlend_Setup:
-				bone->_rotation = bone->_data._rotation + r * alpha;
+				bone._rotation = bone._data._rotation + r * alpha;
 				break;
 			case MixBlend_First:
 			case MixBlend_Replace:
-				r += bone->_data._rotation - bone->_rotation;
+				r += bone._data._rotation - bone._rotation;
 				r -= (16384 - (int)(16384.499999999996 - r / 360)) * 360;
 				// Fall through.
 			case MixBlend_Add:
-				bone->_rotation += r * alpha;
+				bone._rotation += r * alpha;
 		}
 		return;
 	}
 
 	// Interpolate between the previous frame and the current frame.
-	int frame = Animation::binarySearch(_frames, time, ENTRIES);
-	float prevRotation = _frames[frame + PREV_ROTATION];
-	float frameTime = _frames[frame];
-	float percent = getCurvePercent((frame >> 1) - 1,
-		1 - (time - frameTime) / (_frames[frame + PREV_TIME] - frameTime));
-	float r = _frames[frame + ROTATION] - prevRotation;
+	int frame = Animation::search(frames, size, time, ENTRIES, cursor);
+	float prevRotation = frames[frame + PREV_ROTATION];
+	float frameTime = frames[frame];
+	float percent = getCurvePercent(curves, (frame >> 1) - 1,
+		1 - (time - frameTime) / (frames[frame + PREV_TIME] - frameTime));
+	float r = frames[frame + ROTATION] - prevRotation;
 	r = prevRotation + (r - (16384 - (int)(16384.499999999996 - r / 360)) * 360) * percent;
 	switch (blend) {
 		case MixBlend_Setup:
-			bone->_rotation = bone->_data._rotation + (r - (16384 - (int)(16384.499999999996 - r / 360)) * 360) * alpha;
+			bone._rotation = bone._data._rotation + (r - (16384 - (int)(16384.499999999996 - r / 360)) * 360) * alpha;
 			break;
 		case MixBlend_First:
 		case MixBlend_Replace:
-			r += bone->_data._rotation - bone->_rotation;
+			r += bone._data._rotation - bone._rotation;
 			// Fall through.
 		case MixBlend_Add:
-			bone->_rotation += (r - (16384 - (int)(16384.499999999996 - r / 360)) * 360) * alpha;
+			bone._rotation += (r - (16384 - (int)(16384.499999999996 - r / 360)) * 360) * alpha;
 	}
 }
 
@@ -40,6 +40,7 @@
 #include <spine/SlotData.h>
 #include <spine/Bone.h>
 #include <spine/BoneData.h>
+#include <spine/QuantizedFrames.h>
 
 using namespace spine;
 
@@ -59,7 +60,20 @@ void ScaleTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 
 	if (!bone._active) return;
 
-	if (time < _frames[0]) {
+	if (_quantized) {
+		float window[QuantizedFrames::MAX_WINDOW_SIZE];
+		int firstFrame, size = _quantized->decode(time, window, firstFrame);
+		applyFrames(bone, window, size, getCurve(firstFrame), time, alpha, blend, direction, NULL);
+		return;
+	}
+
+	applyFrames(bone, _frames.buffer(), (int)_frames.size(), getCurves().buffer(), time, alpha, blend, direction, NULL);
+}
+
+void ScaleTimeline::applyFrames(Bone &bone, const float *frames, int size, const float *curves, float time, float alpha,
+	MixBlend blend, MixDirection direction, int *cursor
+) {
+	if (time < frames[0]) {
 		switch (blend) {
 		case MixBlend_Setup:
 			bone._scaleX = bone._data._scaleX;
@@ -74,21 +88,21 @@ void ScaleTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 	}
 
 	float x, y;
-	if (time >= _frames[_frames.size() - ENTRIES]) {
+	if (time >= frames[size - ENTRIES]) {
 		// Time is after last frame.
-		x = _frames[_frames.size() + PREV_X] * bone._data._scaleX;
-		y = _frames[_frames.size() + PREV_Y] * bone._data._scaleY;
+		x = frames[size + PREV_X] * bone._data._scaleX;
+		y = frames[size + PREV_Y] * bone._data._scaleY;
 	} else {
 		// Interpolate between the previous frame and the current frame.
-		int frame = Animation::binarySearch(_frames, time, ENTRIES);
-		x = _frames[frame + PREV_X];
-		y = _frames[frame + PREV_Y];
-		float frameTime = _frames[frame];
-		float percent = getCurvePercent(frame / ENTRIES - 1,
-			1 - (time - frameTime) / (_frames[frame + PREV_TIME] - frameTime));
-
-		x = (x + (_frames[frame + X] - x) * percent) * bone._data._scaleX;
-		y = (y + (_frames[frame + Y] - y) * percent) * bone._data._scaleY;
+		int frame = Animation::search(frames, size, time, ENTRIES, cursor);
+		x = frames[frame + PREV_X];
+		y = frames[frame + PREV_Y];
+		float frameTime = frames[frame];
+		float percent = getCurvePercent(curves, frame / ENTRIES - 1,
+			1 - (time - frameTime) / (frames[frame + PREV_TIME] - frameTime));
+
+		x = (x + (frames[frame + X] - x) * percent) * bone._data._scaleX;
+		y = (y + (frames[frame + Y] - y) * percent) * bone._data._scaleY;
 	}
 
 	if (alpha == 1) {
@@ -40,6 +40,7 @@
 #include <spine/SlotData.h>
 #include <spine/Bone.h>
 #include <spine/BoneData.h>
+#include <spine/QuantizedFrames.h>
 
 using namespace spine;
 
@@ -53,13 +54,27 @@ void ShearTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 ) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
-	SP_UNUSED(direction);
 
 	Bone *boneP = skeleton._bones[_boneIndex];
 	Bone &bone = *boneP;
 	if (!bone._active) return;
 
-	if (time < _frames[0]) {
+	if (_quantized) {
+		float window[QuantizedFrames::MAX_WINDOW_SIZE];
+		int firstFrame, size = _quantized->decode(time, window, firstFrame);
+		applyFrames(bone, window, size, getCurve(firstFrame), time, alpha, blend, direction, NULL);
+		return;
+	}
+
+	applyFrames(bone, _frames.buffer(), (int)_frames.size(), getCurves().buffer(), time, alpha, blend, direction, NULL);
+}
+
+void ShearTimeline::applyFrames(Bone &bone, const float *frames, int size, const float *curves, float time, float alpha,
+	MixBlend blend, MixDirection direction, int *cursor
+) {
+	SP_UNUSED(direction);
+
+	if (time < frames[0]) {
 		switch (blend) {
 		case MixBlend_Setup:
 			bone._shearX = bone._data._shearX;
@@ -74,21 +89,21 @@ void ShearTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector
 	}
 
 	float x, y;
-	if (time >= _frames[_frames.size() - ENTRIES]) {
+	if (time >= frames[size - ENTRIES]) {
 		// Time is after last frame.
-		x = _frames[_frames.size() + PREV_X];
-		y = _frames[_frames.size() + PREV_Y];
+		x = frames[size + PREV_X];
+		y = frames[size + PREV_Y];
 	} else {
 		// Interpolate between the previous frame and the current frame.
-		int frame = Animation::binarySearch(_frames, time, ENTRIES);
-		x = _frames[frame + PREV_X];
-		y = _frames[frame + PREV_Y];
-		float frameTime = _frames[frame];
-		float percent = getCurvePercent(frame / ENTRIES - 1,
-			1 - (time - frameTime) / (_frames[frame + PREV_TIME] - frameTime));
-
-		x = x + (_frames[frame + X] - x) * percent;
-		y = y + (_frames[frame + Y] - y) * percent;
+		int frame = Animation::search(frames, size, time, ENTRIES, cursor);
+		x = frames[frame + PREV_X];
+		y = frames[frame + PREV_Y];
+		float frameTime = frames[frame];
+		float percent = getCurvePercent(curves, frame / ENTRIES - 1,
+			1 - (time - frameTime) / (frames[frame + PREV_TIME] - frameTime));
+
+		x = x + (frames[frame + X] - x) * percent;
+		y = y + (frames[frame + Y] - y) * percent;
 	}
 
 	switch (blend) {
@@ -0,0 +1,537 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifdef SPINE_UE4
+#include "SpinePluginPrivatePCH.h"
+#endif
+
+#include <spine/SimdUtil.h>
+
+#include <spine/MathUtil.h>
+
+#if defined(SPINE_SIMD_AVX2)
+#include <immintrin.h>
+#elif defined(SPINE_SIMD_SSE2)
+#include <emmintrin.h>
+#elif defined(SPINE_SIMD_NEON)
+#include <arm_neon.h>
+#endif
+
+using namespace spine;
+
+const int SimdUtil::MatrixSize;
+
+const char *SimdUtil::getInstructionSet() {
+#if defined(SPINE_SIMD_AVX2)
+	return "avx2";
+#elif defined(SPINE_SIMD_SSE2)
+	return "sse2";
+#elif defined(SPINE_SIMD_NEON)
+	return "neon";
+#else
+	return "scalar";
+#endif
+}
+
+void SimdUtil::transform(const float *vertices, size_t count, float a, float b, float c, float d, float x, float y,
+	float *worldVertices, size_t stride) {
+	size_t i = 0;
+
+#if defined(SPINE_SIMD_AVX2)
+	if (stride == 2) {
+		__m256 ac = _mm256_setr_ps(a, c, a, c, a, c, a, c);
+		__m256 bd = _mm256_setr_ps(b, d, b, d, b, d, b, d);
+		__m256 xy = _mm256_setr_ps(x, y, x, y, x, y, x, y);
+		for (; i + 8 <= count; i += 8) {
+			__m256 v0 = _mm256_loadu_ps(vertices + (i << 1));
+			__m256 v1 = _mm256_loadu_ps(vertices + (i << 1) + 8);
+			__m256 w0 = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_moveldup_ps(v0), ac), _mm256_mul_ps(_mm256_movehdup_ps(v0), bd)), xy);
+			__m256 w1 = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_moveldup_ps(v1), ac), _mm256_mul_ps(_mm256_movehdup_ps(v1), bd)), xy);
+			_mm256_storeu_ps(worldVertices + (i << 1), w0);
+			_mm256_storeu_ps(worldVertices + (i << 1) + 8, w1);
+		}
+	}
+#endif
+
+#if defined(SPINE_SIMD_SSE2)
+	{
+		__m128 ac = _mm_setr_ps(a, c, a, c);
+		__m128 bd = _mm_setr_ps(b, d, b, d);
+		__m128 xy = _mm_setr_ps(x, y, x, y);
+		if (stride == 2) {
+			for (; i + 4 <= count; i += 4) {
+				__m128 v0 = _mm_loadu_ps(vertices + (i << 1));
+				__m128 v1 = _mm_loadu_ps(vertices + (i << 1) + 4);
+				__m128 w0 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(v0, v0, _MM_SHUFFLE(2, 2, 0, 0)), ac),
+					_mm_mul_ps(_mm_shuffle_ps(v0, v0, _MM_SHUFFLE(3, 3, 1, 1)), bd)), xy);
+				__m128 w1 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(v1, v1, _MM_SHUFFLE(2, 2, 0, 0)), ac),
+					_mm_mul_ps(_mm_shuffle_ps(v1, v1, _MM_SHUFFLE(3, 3, 1, 1)), bd)), xy);
+				_mm_storeu_ps(worldVertices + (i << 1), w0);
+				_mm_storeu_ps(worldVertices + (i << 1) + 4, w1);
+			}
+		}
+		for (; i + 2 <= count; i += 2) {
+			__m128 v = _mm_loadu_ps(vertices + (i << 1));
+			__m128 w = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 0, 0)), ac),
+				_mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 1, 1)), bd)), xy);
+			_mm_storel_pi((__m64 *) (worldVertices + i * stride), w);
+			_mm_storeh_pi((__m64 *) (worldVertices + (i + 1) * stride), w);
+		}
+	}
+#elif defined(SPINE_SIMD_NEON)
+	{
+		float acValues[4] = {a, c, a, c}, bdValues[4] = {b, d, b, d}, xyValues[4] = {x, y, x, y};
+		float32x4_t ac = vld1q_f32(acValues);
+		float32x4_t bd = vld1q_f32(bdValues);
+		float32x4_t xy = vld1q_f32(xyValues);
+		for (; i + 2 <= count; i += 2) {
+			float32x4_t v = vld1q_f32(vertices + (i << 1));
+			float32x4x2_t vv = vtrnq_f32(v, v);
+			float32x4_t w = vaddq_f32(vaddq_f32(vmulq_f32(vv.val[0], ac), vmulq_f32(vv.val[1], bd)), xy);
+			if (stride == 2) {
+				vst1q_f32(worldVertices + (i << 1), w);
+			} else {
+				vst1_f32(worldVertices + i * stride, vget_low_f32(w));
+				vst1_f32(worldVertices + (i + 1) * stride, vget_high_f32(w));
+			}
+		}
+	}
+#endif
+
+	for (; i < count; i++) {
+		float vx = vertices[i << 1];
+		float vy = vertices[(i << 1) + 1];
+		worldVertices[i * stride] = vx * a + vy * b + x;
+		worldVertices[i * stride + 1] = vx * c + vy * d + y;
+	}
+}
+
+void SimdUtil::transformWeighted(const float *matrices, const int *influenceCounts, size_t count, const float *vertices,
+	const float *deform, float *worldVertices, size_t stride) {
+	// Both coordinates of a vertex are computed in the two low lanes, accumulating the influences in order.
+	for (size_t i = 0; i < count; i++) {
+		int n = influenceCounts[i];
+#if defined(SPINE_SIMD_SSE2)
+		__m128 w = _mm_setzero_ps();
+		for (int ii = 0; ii < n; ii++, matrices += MatrixSize, vertices += 3) {
+			float vx = vertices[0], vy = vertices[1];
+			if (deform) {
+				vx += deform[0];
+				vy += deform[1];
+				deform += 2;
+			}
+			__m128 ac = _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *) matrices);
+			__m128 bd = _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *) (matrices + 2));
+			__m128 xy = _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *) (matrices + 4));
+			__m128 p = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(vx), ac), _mm_mul_ps(_mm_set1_ps(vy), bd)), xy);
+			w = _mm_add_ps(w, _mm_mul_ps(p, _mm_set1_ps(vertices[2])));
+		}
+		_mm_storel_pi((__m64 *) (worldVertices + i * stride), w);
+#elif defined(SPINE_SIMD_NEON)
+		float32x2_t w = vdup_n_f32(0);
+		for (int ii = 0; ii < n; ii++, matrices += MatrixSize, vertices += 3) {
+			float vx = vertices[0], vy = vertices[1];
+			if (deform) {
+				vx += deform[0];
+				vy += deform[1];
+				deform += 2;
+			}
+			float32x2_t p = vadd_f32(vadd_f32(vmul_n_f32(vld1_f32(matrices), vx), vmul_n_f32(vld1_f32(matrices + 2), vy)),
+				vld1_f32(matrices + 4));
+			w = vadd_f32(w, vmul_n_f32(p, vertices[2]));
+		}
+		vst1_f32(worldVertices + i * stride, w);
+#else
+		float wx = 0, wy = 0;
+		for (int ii = 0; ii < n; ii++, matrices += MatrixSize, vertices += 3) {
+			float vx = vertices[0], vy = vertices[1];
+			if (deform) {
+				vx += deform[0];
+				vy += deform[1];
+				deform += 2;
+			}
+			float weight = vertices[2];
+			wx += (vx * matrices[0] + vy * matrices[2] + matrices[4]) * weight;
+			wy += (vx * matrices[1] + vy * matrices[3] + matrices[5]) * weight;
+		}
+		worldVertices[i * stride] = wx;
+		worldVertices[i * stride + 1] = wy;
+#endif
+	}
+}
+
+void SimdUtil::bounds(const float *vertices, size_t count, float &minX, float &minY, float &maxX, float &maxY) {
+	size_t i = 0;
+
+#if defined(SPINE_SIMD_SSE2)
+	if (count >= 2) {
+		__m128 minV = _mm_setr_ps(minX, minY, minX, minY);
+		__m128 maxV = _mm_setr_ps(maxX, maxY, maxX, maxY);
+		for (; i + 2 <= count; i += 2) {
+			__m128 v = _mm_loadu_ps(vertices + (i << 1));
+			minV = _mm_min_ps(minV, v);
+			maxV = _mm_max_ps(maxV, v);
+		}
+		minV = _mm_min_ps(minV, _mm_movehl_ps(minV, minV));
+		maxV = _mm_max_ps(maxV, _mm_movehl_ps(maxV, maxV));
+		float values[4];
+		_mm_storeu_ps(values, minV);
+		minX = values[0];
+		minY = values[1];
+		_mm_storeu_ps(values, maxV);
+		maxX = values[0];
+		maxY = values[1];
+	}
+#elif defined(SPINE_SIMD_NEON)
+	if (count >= 2) {
+		float minValues[4] = {minX, minY, minX, minY}, maxValues[4] = {maxX, maxY, maxX, maxY};
+		float32x4_t minV = vld1q_f32(minValues);
+		float32x4_t maxV = vld1q_f32(maxValues);
+		for (; i + 2 <= count; i += 2) {
+			float32x4_t v = vld1q_f32(vertices + (i << 1));
+			minV = vminq_f32(minV, v);
+			maxV = vmaxq_f32(maxV, v);
+		}
+		float32x2_t minXY = vmin_f32(vget_low_f32(minV), vget_high_f32(minV));
+		float32x2_t maxXY = vmax_f32(vget_low_f32(maxV), vget_high_f32(maxV));
+		minX = vget_lane_f32(minXY, 0);
+		minY = vget_lane_f32(minXY, 1);
+		maxX = vget_lane_f32(maxXY, 0);
+		maxY = vget_lane_f32(maxXY, 1);
+	}
+#endif
+
+	for (; i < count; i++) {
+		float vx = vertices[i << 1], vy = vertices[(i << 1) + 1];
+		if (vx < minX) minX = vx;
+		if (vy < minY) minY = vy;
+		if (vx > maxX) maxX = vx;
+		if (vy > maxY) maxY = vy;
+	}
+}
+
+void SimdUtil::insidePolygon(const float *xs, const float *ys, size_t count, const float *polygon, size_t polygonLength,
+	unsigned char *inside) {
+	size_t i = 0, edgesLength = polygonLength - 2;
+
+#if defined(SPINE_SIMD_AVX2)
+	for (; i + 8 <= count; i += 8) {
+		__m256 x = _mm256_loadu_ps(xs + i), y = _mm256_loadu_ps(ys + i);
+		__m256 mask = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+		for (size_t ii = 0; ii < edgesLength; ii += 2) {
+			__m256 edgeX2 = _mm256_set1_ps(polygon[ii + 2]), edgeY2 = _mm256_set1_ps(polygon[ii + 3]);
+			__m256 deltaX = _mm256_set1_ps(polygon[ii] - polygon[ii + 2]);
+			__m256 deltaY = _mm256_set1_ps(polygon[ii + 1] - polygon[ii + 3]);
+			__m256 side = _mm256_sub_ps(_mm256_mul_ps(deltaX, _mm256_sub_ps(y, edgeY2)), _mm256_mul_ps(deltaY, _mm256_sub_ps(x, edgeX2)));
+			mask = _mm256_and_ps(mask, _mm256_cmp_ps(side, _mm256_setzero_ps(), _CMP_GT_OQ));
+		}
+		int bits = _mm256_movemask_ps(mask);
+		for (int ii = 0; ii < 8; ii++)
+			inside[i + ii] = (unsigned char) ((bits >> ii) & 1);
+	}
+#endif
+
+#if defined(SPINE_SIMD_SSE2)
+	for (; i + 4 <= count; i += 4) {
+		__m128 x = _mm_loadu_ps(xs + i), y = _mm_loadu_ps(ys + i);
+		__m128 mask = _mm_castsi128_ps(_mm_set1_epi32(-1));
+		for (size_t ii = 0; ii < edgesLength; ii += 2) {
+			__m128 edgeX2 = _mm_set1_ps(polygon[ii + 2]), edgeY2 = _mm_set1_ps(polygon[ii + 3]);
+			__m128 deltaX = _mm_set1_ps(polygon[ii] - polygon[ii + 2]);
+			__m128 deltaY = _mm_set1_ps(polygon[ii + 1] - polygon[ii + 3]);
+			__m128 side = _mm_sub_ps(_mm_mul_ps(deltaX, _mm_sub_ps(y, edgeY2)), _mm_mul_ps(deltaY, _mm_sub_ps(x, edgeX2)));
+			mask = _mm_and_ps(mask, _mm_cmpgt_ps(side, _mm_setzero_ps()));
+		}
+		int bits = _mm_movemask_ps(mask);
+		inside[i] = (unsigned char) (bits & 1);
+		inside[i + 1] = (unsigned char) ((bits >> 1) & 1);
+		inside[i + 2] = (unsigned char) ((bits >> 2) & 1);
+		inside[i + 3] = (unsigned char) ((bits >> 3) & 1);
+	}
+#elif defined(SPINE_SIMD_NEON)
+	for (; i + 4 <= count; i += 4) {
+		float32x4_t x = vld1q_f32(xs + i), y = vld1q_f32(ys + i);
+		uint32x4_t mask = vdupq_n_u32(0xffffffff);
+		for (size_t ii = 0; ii < edgesLength; ii += 2) {
+			float32x4_t edgeX2 = vdupq_n_f32(polygon[ii + 2]), edgeY2 = vdupq_n_f32(polygon[ii + 3]);
+			float32x4_t deltaX = vdupq_n_f32(polygon[ii] - polygon[ii + 2]);
+			float32x4_t deltaY = vdupq_n_f32(polygon[ii + 1] - polygon[ii + 3]);
+			float32x4_t side = vsubq_f32(vmulq_f32(deltaX, vsubq_f32(y, edgeY2)), vmulq_f32(deltaY, vsubq_f32(x, edgeX2)));
+			mask = vandq_u32(mask, vcgtq_f32(side, vdupq_n_f32(0)));
+		}
+		inside[i] = (unsigned char) (vgetq_lane_u32(mask, 0) & 1);
+		inside[i + 1] = (unsigned char) (vgetq_lane_u32(mask, 1) & 1);
+		inside[i + 2] = (unsigned char) (vgetq_lane_u32(mask, 2) & 1);
+		inside[i + 3] = (unsigned char) (vgetq_lane_u32(mask, 3) & 1);
+	}
+#endif
+
+	for (; i < count; i++) {
+		float x = xs[i], y = ys[i];
+		unsigned char result = 1;
+		for (size_t ii = 0; ii < edgesLength; ii += 2) {
+			float edgeX2 = polygon[ii + 2], edgeY2 = polygon[ii + 3];
+			float deltaX = polygon[ii] - edgeX2, deltaY = polygon[ii + 1] - edgeY2;
+			if (!(deltaX * (y - edgeY2) - deltaY * (x - edgeX2) > 0)) {
+				result = 0;
+				break;
+			}
+		}
+		inside[i] = result;
+	}
+}
+
+void SimdUtil::curveLengths(const float *curves, size_t count, float *lengths) {
+	size_t i = 0;
+	float length = 0;
+
+#if defined(SPINE_SIMD_SSE2) || (defined(SPINE_SIMD_NEON) && (defined(__aarch64__) || defined(_M_ARM64)))
+	// The 4 segment lengths of 4 curves are computed at once. They are summed in the same order as the scalar path, so
+	// the lengths are identical.
+	float segments[4][4];
+	for (; i + 4 <= count; i += 4) {
+		const float *c = curves + i * 6;
+#if defined(SPINE_SIMD_SSE2)
+		// Gather the same coordinate of 4 curves into each register.
+		__m128 x1 = _mm_set_ps(c[18], c[12], c[6], c[0]), y1 = _mm_set_ps(c[19], c[13], c[7], c[1]);
+		__m128 cx1 = _mm_set_ps(c[20], c[14], c[8], c[2]), cy1 = _mm_set_ps(c[21], c[15], c[9], c[3]);
+		__m128 cx2 = _mm_set_ps(c[22], c[16], c[10], c[4]), cy2 = _mm_set_ps(c[23], c[17], c[11], c[5]);
+		__m128 x2 = _mm_set_ps(c[24], c[18], c[12], c[6]), y2 = _mm_set_ps(c[25], c[19], c[13], c[7]);
+		const __m128 two = _mm_set1_ps(2), three = _mm_set1_ps(3);
+		__m128 tmpx = _mm_mul_ps(_mm_add_ps(_mm_sub_ps(x1, _mm_mul_ps(cx1, two)), cx2), _mm_set1_ps(0.1875f));
+		__m128 tmpy = _mm_mul_ps(_mm_add_ps(_mm_sub_ps(y1, _mm_mul_ps(cy1, two)), cy2), _mm_set1_ps(0.1875f));
+		__m128 dddfx = _mm_mul_ps(_mm_add_ps(_mm_sub_ps(_mm_mul_ps(_mm_sub_ps(cx1, cx2), three), x1), x2), _mm_set1_ps(0.09375f));
+		__m128 dddfy = _mm_mul_ps(_mm_add_ps(_mm_sub_ps(_mm_mul_ps(_mm_sub_ps(cy1, cy2), three), y1), y2), _mm_set1_ps(0.09375f));
+		__m128 ddfx = _mm_add_ps(_mm_mul_ps(tmpx, two), dddfx), ddfy = _mm_add_ps(_mm_mul_ps(tmpy, two), dddfy);
+		__m128 dfx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_sub_ps(cx1, x1), _mm_set1_ps(0.75f)), tmpx),
+			_mm_mul_ps(dddfx, _mm_set1_ps(0.16666667f)));
+		__m128 dfy = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_sub_ps(cy1, y1), _mm_set1_ps(0.75f)), tmpy),
+			_mm_mul_ps(dddfy, _mm_set1_ps(0.16666667f)));
+		_mm_storeu_ps(segments[0], _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dfx, dfx), _mm_mul_ps(dfy, dfy))));
+		dfx = _mm_add_ps(dfx, ddfx);
+		dfy = _mm_add_ps(dfy, ddfy);
+		ddfx = _mm_add_ps(ddfx, dddfx);
+		ddfy = _mm_add_ps(ddfy, dddfy);
+		_mm_storeu_ps(segments[1], _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dfx, dfx), _mm_mul_ps(dfy, dfy))));
+		dfx = _mm_add_ps(dfx, ddfx);
+		dfy = _mm_add_ps(dfy, ddfy);
+		_mm_storeu_ps(segments[2], _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dfx, dfx), _mm_mul_ps(dfy, dfy))));
+		dfx = _mm_add_ps(dfx, _mm_add_ps(ddfx, dddfx));
+		dfy = _mm_add_ps(dfy, _mm_add_ps(ddfy, dddfy));
+		_mm_storeu_ps(segments[3], _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dfx, dfx), _mm_mul_ps(dfy, dfy))));
+#else
+		float gathered[8][4];
+		for (int lane = 0; lane < 4; lane++)
+			for (int k = 0; k < 8; k++)
+				gathered[k][lane] = c[lane * 6 + k];
+		float32x4_t x1 = vld1q_f32(gathered[0]), y1 = vld1q_f32(gathered[1]);
+		float32x4_t cx1 = vld1q_f32(gathered[2]), cy1 = vld1q_f32(gathered[3]);
+		float32x4_t cx2 = vld1q_f32(gathered[4]), cy2 = vld1q_f32(gathered[5]);
+		float32x4_t x2 = vld1q_f32(gathered[6]), y2 = vld1q_f32(gathered[7]);
+		const float32x4_t two = vdupq_n_f32(2), three = vdupq_n_f32(3);
+		float32x4_t tmpx = vmulq_f32(vaddq_f32(vsubq_f32(x1, vmulq_f32(cx1, two)), cx2), vdupq_n_f32(0.1875f));
+		float32x4_t tmpy = vmulq_f32(vaddq_f32(vsubq_f32(y1, vmulq_f32(cy1, two)), cy2), vdupq_n_f32(0.1875f));
+		float32x4_t dddfx = vmulq_f32(vaddq_f32(vsubq_f32(vmulq_f32(vsubq_f32(cx1, cx2), three), x1), x2), vdupq_n_f32(0.09375f));
+		float32x4_t dddfy = vmulq_f32(vaddq_f32(vsubq_f32(vmulq_f32(vsubq_f32(cy1, cy2), three), y1), y2), vdupq_n_f32(0.09375f));
+		float32x4_t ddfx = vaddq_f32(vmulq_f32(tmpx, two), dddfx), ddfy = vaddq_f32(vmulq_f32(tmpy, two), dddfy);
+		float32x4_t dfx = vaddq_f32(vaddq_f32(vmulq_f32(vsubq_f32(cx1, x1), vdupq_n_f32(0.75f)), tmpx),
+			vmulq_f32(dddfx, vdupq_n_f32(0.16666667f)));
+		float32x4_t dfy = vaddq_f32(vaddq_f32(vmulq_f32(vsubq_f32(cy1, y1), vdupq_n_f32(0.75f)), tmpy),
+			vmulq_f32(dddfy, vdupq_n_f32(0.16666667f)));
+		vst1q_f32(segments[0], vsqrtq_f32(vaddq_f32(vmulq_f32(dfx, dfx), vmulq_f32(dfy, dfy))));
+		dfx = vaddq_f32(dfx, ddfx);
+		dfy = vaddq_f32(dfy, ddfy);
+		ddfx = vaddq_f32(ddfx, dddfx);
+		ddfy = vaddq_f32(ddfy, dddfy);
+		vst1q_f32(segments[1], vsqrtq_f32(vaddq_f32(vmulq_f32(dfx, dfx), vmulq_f32(dfy, dfy))));
+		dfx = vaddq_f32(dfx, ddfx);
+		dfy = vaddq_f32(dfy, ddfy);
+		vst1q_f32(segments[2], vsqrtq_f32(vaddq_f32(vmulq_f32(dfx, dfx), vmulq_f32(dfy, dfy))));
+		dfx = vaddq_f32(dfx, vaddq_f32(ddfx, dddfx));
+		dfy = vaddq_f32(dfy, vaddq_f32(ddfy, dddfy));
+		vst1q_f32(segments[3], vsqrtq_f32(vaddq_f32(vmulq_f32(dfx, dfx), vmulq_f32(dfy, dfy))));
+#endif
+		for (int lane = 0; lane < 4; lane++) {
+			length += segments[0][lane];
+			length += segments[1][lane];
+			length += segments[2][lane];
+			length += segments[3][lane];
+			lengths[i + lane] = length;
+		}
+	}
+#endif
+
+	for (; i < count; i++) {
+		const float *c = curves + i * 6;
+		float x1 = c[0], y1 = c[1], cx1 = c[2], cy1 = c[3], cx2 = c[4], cy2 = c[5], x2 = c[6], y2 = c[7];
+		float tmpx = (x1 - cx1 * 2 + cx2) * 0.1875f;
+		float tmpy = (y1 - cy1 * 2 + cy2) * 0.1875f;
+		float dddfx = ((cx1 - cx2) * 3 - x1 + x2) * 0.09375f;
+		float dddfy = ((cy1 - cy2) * 3 - y1 + y2) * 0.09375f;
+		float ddfx = tmpx * 2 + dddfx;
+		float ddfy = tmpy * 2 + dddfy;
+		float dfx = (cx1 - x1) * 0.75f + tmpx + dddfx * 0.16666667f;
+		float dfy = (cy1 - y1) * 0.75f + tmpy + dddfy * 0.16666667f;
+		length += MathUtil::sqrt(dfx * dfx + dfy * dfy);
+		dfx += ddfx;
+		dfy += ddfy;
+		ddfx += dddfx;
+		ddfy += dddfy;
+		length += MathUtil::sqrt(dfx * dfx + dfy * dfy);
+		dfx += ddfx;
+		dfy += ddfy;
+		length += MathUtil::sqrt(dfx * dfx + dfy * dfy);
+		dfx += ddfx + dddfx;
+		dfy += ddfy + dddfy;
+		length += MathUtil::sqrt(dfx * dfx + dfy * dfy);
+		lengths[i] = length;
+	}
+}
+
+void SimdUtil::lerp(const float *from, const float *to, float alpha, float *out, size_t count) {
+	size_t i = 0;
+
+#if defined(SPINE_SIMD_AVX2)
+	{
+		__m256 a = _mm256_set1_ps(alpha);
+		for (; i + 8 <= count; i += 8) {
+			__m256 f = _mm256_loadu_ps(from + i);
+			_mm256_storeu_ps(out + i, _mm256_add_ps(f, _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(to + i), f), a)));
+		}
+	}
+#endif
+
+#if defined(SPINE_SIMD_SSE2)
+	{
+		__m128 a = _mm_set1_ps(alpha);
+		for (; i + 4 <= count; i += 4) {
+			__m128 f = _mm_loadu_ps(from + i);
+			_mm_storeu_ps(out + i, _mm_add_ps(f, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(to + i), f), a)));
+		}
+	}
+#elif defined(SPINE_SIMD_NEON)
+	{
+		float32x4_t a = vdupq_n_f32(alpha);
+		for (; i + 4 <= count; i += 4) {
+			float32x4_t f = vld1q_f32(from + i);
+			vst1q_f32(out + i, vaddq_f32(f, vmulq_f32(vsubq_f32(vld1q_f32(to + i), f), a)));
+		}
+	}
+#endif
+
+	for (; i < count; i++) {
+		float f = from[i];
+		out[i] = f + (to[i] - f) * alpha;
+	}
+}
+
+void SimdUtil::add(const float *values, const float *base, float alpha, float *out, size_t count) {
+	size_t i = 0;
+
+#if defined(SPINE_SIMD_AVX2)
+	{
+		__m256 a = _mm256_set1_ps(alpha);
+		if (base) {
+			for (; i + 8 <= count; i += 8) {
+				__m256 v = _mm256_sub_ps(_mm256_loadu_ps(values + i), _mm256_loadu_ps(base + i));
+				_mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_loadu_ps(out + i), _mm256_mul_ps(v, a)));
+			}
+		} else {
+			for (; i + 8 <= count; i += 8)
+				_mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_loadu_ps(out + i), _mm256_mul_ps(_mm256_loadu_ps(values + i), a)));
+		}
+	}
+#endif
+
+#if defined(SPINE_SIMD_SSE2)
+	{
+		__m128 a = _mm_set1_ps(alpha);
+		if (base) {
+			for (; i + 4 <= count; i += 4) {
+				__m128 v = _mm_sub_ps(_mm_loadu_ps(values + i), _mm_loadu_ps(base + i));
+				_mm_storeu_ps(out + i, _mm_add_ps(_mm_loadu_ps(out + i), _mm_mul_ps(v, a)));
+			}
+		} else {
+			for (; i + 4 <= count; i += 4)
+				_mm_storeu_ps(out + i, _mm_add_ps(_mm_loadu_ps(out + i), _mm_mul_ps(_mm_loadu_ps(values + i), a)));
+		}
+	}
+#elif defined(SPINE_SIMD_NEON)
+	{
+		float32x4_t a = vdupq_n_f32(alpha);
+		if (base) {
+			for (; i + 4 <= count; i += 4) {
+				float32x4_t v = vsubq_f32(vld1q_f32(values + i), vld1q_f32(base + i));
+				vst1q_f32(out + i, vaddq_f32(vld1q_f32(out + i), vmulq_f32(v, a)));
+			}
+		} else {
+			for (; i + 4 <= count; i += 4)
+				vst1q_f32(out + i, vaddq_f32(vld1q_f32(out + i), vmulq_f32(vld1q_f32(values + i), a)));
+		}
+	}
+#endif
+
+	if (base) {
+		for (; i < count; i++)
+			out[i] += (values[i] - base[i]) * alpha;
+	} else {
+		for (; i < count; i++)
+			out[i] += values[i] * alpha;
+	}
+}
+
+void SimdUtil::scale(const float *values, float scale, float *out, size_t count) {
+	size_t i = 0;
+
+#if defined(SPINE_SIMD_AVX2)
+	{
+		__m256 s = _mm256_set1_ps(scale);
+		for (; i + 8 <= count; i += 8)
+			_mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_loadu_ps(values + i), s));
+	}
+#endif
+
+#if defined(SPINE_SIMD_SSE2)
+	{
+		__m128 s = _mm_set1_ps(scale);
+		for (; i + 4 <= count; i += 4)
+			_mm_storeu_ps(out + i, _mm_mul_ps(_mm_loadu_ps(values + i), s));
+	}
+#elif defined(SPINE_SIMD_NEON)
+	{
+		float32x4_t s = vdupq_n_f32(scale);
+		for (; i + 4 <= count; i += 4)
+			vst1q_f32(out + i, vmulq_f32(vld1q_f32(values + i), s));
+	}
+#endif
+
+	for (; i < count; i++)
+		out[i] = values[i] * scale;
+}
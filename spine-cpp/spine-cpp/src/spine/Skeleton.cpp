@@ -35,6 +35,7 @@
 
 #include <spine/SkeletonData.h>
 #include <spine/Bone.h>
+#include <spine/BonePoseBuffer.h>
 #include <spine/Slot.h>
 #include <spine/IkConstraint.h>
 #include <spine/PathConstraint.h>
@@ -52,6 +53,9 @@
 #include <spine/PathAttachment.h>
 
 #include <spine/ContainerUtil.h>
+#include <spine/ProfilingExtension.h>
+#include <spine/SimdUtil.h>
+#include <spine/SkeletonUpdateOrder.h>
 
 #include <float.h>
 
@@ -59,7 +63,10 @@ using namespace spine;
 
 Skeleton::Skeleton(SkeletonData *skeletonData) :
 		_data(skeletonData),
+		_constraintOrder(NULL),
+		_poseBuffer(NULL),
 		_skin(NULL),
+		_attachmentCacheStamp(1),
 		_color(1, 1, 1, 1),
 		_time(0),
 		_scaleX(1),
@@ -130,13 +137,125 @@ Skeleton::~Skeleton() {
 	ContainerUtil::cleanUpVectorOfPointers(_ikConstraints);
 	ContainerUtil::cleanUpVectorOfPointers(_transformConstraints);
 	ContainerUtil::cleanUpVectorOfPointers(_pathConstraints);
+	delete _poseBuffer;
+}
+
+static inline bool getBit(const unsigned int *bits, size_t index) {
+	return ((bits[index >> 5] >> (index & 31)) & 1) != 0;
+}
+
+static inline void setBit(unsigned int *bits, size_t index) {
+	bits[index >> 5] |= 1u << (index & 31);
 }
 
 void Skeleton::updateCache() {
-	_updateCache.clear();
-	_updateCacheReset.clear();
+	SkeletonData &data = *_data;
+	// Held while sorting too, so the constraint order is not rebuilt by another skeleton while it is read.
+	MutexLock lock(data._updateOrderMutex);
+	data.validateConstraintOrder();
+	if (!constraintsMatchData()) {
+		updateOwnConstraintOrder();
+		_constraintOrder = &_ownConstraintOrder;
+		updateCacheKey();
+		sortUpdateCache();
+		if (_poseBuffer) _poseBuffer->build(*this);
+		return;
+	}
+	_constraintOrder = &data._constraintOrder;
+	size_t constraintCount = data._constraintOrder.size();
+
+	updateCacheKey();
+	size_t keyLength = _updateCacheKey.size();
+	const unsigned int *key = _updateCacheKey.buffer();
+	size_t hash = 2166136261u;
+	for (size_t i = 0; i < keyLength; i++)
+		hash = (hash ^ key[i]) * 16777619u;
+
+	size_t boneCount = _bones.size();
+	bool cached = false;
+	for (size_t i = 0, n = data._updateOrders.size(); i < n; i++) {
+		SkeletonUpdateOrder &order = *data._updateOrders[i];
+		if (order._hash != hash || order._key.size() != keyLength) continue;
+		if (memcmp(order._key.buffer(), key, keyLength * sizeof(unsigned int)) != 0) continue;
+
+		const unsigned int *active = order._active.buffer();
+		for (size_t ii = 0; ii < boneCount; ii++)
+			_bones[ii]->_active = getBit(active, ii);
+		for (size_t ii = 0; ii < constraintCount; ii++) {
+			int code = data._constraintOrder[ii];
+			if (code != -1) getConstraint(code)->setActive(getBit(active, boneCount + ii));
+		}
 
-	for (size_t i = 0, n = _bones.size(); i < n; ++i) {
+		_updateCache.clear();
+		_updateCache.ensureCapacity(order._updateCache.size());
+		for (size_t ii = 0, nn = order._updateCache.size(); ii < nn; ii++) {
+			int code = order._updateCache[ii];
+			if (code & 1)
+				_updateCache.add(getConstraint(data._constraintOrder[code >> 1]));
+			else
+				_updateCache.add(_bones[code >> 1]);
+		}
+		_updateCacheReset.clear();
+		for (size_t ii = 0, nn = order._updateCacheReset.size(); ii < nn; ii++)
+			_updateCacheReset.add(_bones[order._updateCacheReset[ii]]);
+		cached = true;
+		break;
+	}
+
+	if (!cached) {
+		sortUpdateCache();
+
+		if (data._maxUpdateOrders > 0) {
+			SkeletonUpdateOrder *order;
+			if (data._updateOrders.size() < data._maxUpdateOrders) {
+				order = new(__FILE__, __LINE__) SkeletonUpdateOrder();
+				data._updateOrders.add(order);
+			} else {
+				order = data._updateOrders[data._nextUpdateOrder];
+				data._nextUpdateOrder = (data._nextUpdateOrder + 1) % data._maxUpdateOrders;
+			}
+			order->_hash = hash;
+			order->_key.clear();
+			order->_key.addAll(_updateCacheKey);
+
+			order->_active.clear();
+			order->_active.setSize((boneCount + constraintCount + 31) >> 5, 0);
+			unsigned int *active = order->_active.buffer();
+			for (size_t i = 0; i < boneCount; i++)
+				if (_bones[i]->_active) setBit(active, i);
+			for (size_t i = 0; i < constraintCount; i++) {
+				int code = data._constraintOrder[i];
+				if (code != -1 && getConstraint(code)->isActive()) setBit(active, boneCount + i);
+			}
+
+			order->_updateCache.clear();
+			for (size_t i = 0, n = _updateCache.size(); i < n; i++) {
+				Updatable *updatable = _updateCache[i];
+				if (updatable->getRTTI().isExactly(Bone::rtti))
+					order->_updateCache.add(((Bone *) updatable)->_data.getIndex() << 1);
+				else if (updatable->getRTTI().isExactly(IkConstraint::rtti))
+					order->_updateCache.add((int) (((IkConstraint *) updatable)->_data.getOrder() << 1) | 1);
+				else if (updatable->getRTTI().isExactly(TransformConstraint::rtti))
+					order->_updateCache.add((int) (((TransformConstraint *) updatable)->_data.getOrder() << 1) | 1);
+				else
+					order->_updateCache.add((int) (((PathConstraint *) updatable)->_data.getOrder() << 1) | 1);
+			}
+			order->_updateCacheReset.clear();
+			for (size_t i = 0, n = _updateCacheReset.size(); i < n; i++)
+				order->_updateCacheReset.add(_updateCacheReset[i]->_data.getIndex());
+		}
+	}
+
+	if (_poseBuffer) _poseBuffer->build(*this);
+}
+
+void Skeleton::updateCacheKey() {
+	size_t boneCount = _bones.size(), constraintCount = _constraintOrder->size();
+	size_t boneWords = (boneCount + 31) >> 5;
+	_updateCacheKey.clear();
+	_updateCacheKey.setSize(boneWords + ((constraintCount + 31) >> 5), 0);
+
+	for (size_t i = 0; i < boneCount; ++i) {
 		Bone* bone = _bones[i];
 		bone->_sorted = bone->_data.isSkinRequired();
 		bone->_active = !bone->_sorted;
@@ -152,51 +271,153 @@ void Skeleton::updateCache() {
 				bone = bone->_parent;
 			} while (bone);
 		}
-	}
 
-	size_t ikCount = _ikConstraints.size();
-	size_t transformCount = _transformConstraints.size();
-	size_t pathCount = _pathConstraints.size();
+		Vector<ConstraintData*>& skinConstraints = _skin->getConstraints();
+		for (size_t i = 0, n = skinConstraints.size(); i < n; i++) {
+			size_t order = skinConstraints[i]->getOrder();
+			if (order < constraintCount) setBit(_updateCacheKey.buffer() + boneWords, order);
+		}
+	}
 
-	size_t constraintCount = ikCount + transformCount + pathCount;
+	unsigned int *key = _updateCacheKey.buffer();
+	for (size_t i = 0; i < boneCount; ++i)
+		if (_bones[i]->_active) setBit(key, i);
 
-	size_t i = 0;
-	continue_outer:
-	for (; i < constraintCount; ++i) {
-		for (size_t ii = 0; ii < ikCount; ++ii) {
-			IkConstraint *constraint = _ikConstraints[ii];
-			if (constraint->getData().getOrder() == i) {
-				sortIkConstraint(constraint);
-				i++;
-				goto continue_outer;
-			}
+	// The bones sorted for each path constraint's attachments, in the order sortPathConstraint() sorts them.
+	for (size_t i = 0, n = _pathConstraints.size(); i < n; i++) {
+		Slot *slot = _pathConstraints[i]->getTarget();
+		size_t slotIndex = slot->getData().getIndex();
+		Bone &slotBone = slot->getBone();
+		if (_skin != NULL) {
+			_slotAttachments.clear();
+			_skin->findAttachmentsForSlot(slotIndex, _slotAttachments);
+			for (size_t ii = 0, nn = _slotAttachments.size(); ii < nn; ii++)
+				addPathAttachmentKey(_slotAttachments[ii], slotBone);
 		}
+		_slotAttachments.clear();
+		if (_data->_defaultSkin != NULL && _data->_defaultSkin != _skin)
+			_data->_defaultSkin->findAttachmentsForSlot(slotIndex, _slotAttachments);
+		for (size_t ii = 0, nn = _data->_skins.size(); ii < nn; ii++)
+			_data->_skins[ii]->findAttachmentsForSlot(slotIndex, _slotAttachments);
+		for (size_t ii = 0, nn = _slotAttachments.size(); ii < nn; ii++)
+			addPathAttachmentKey(_slotAttachments[ii], slotBone);
+		addPathAttachmentKey(slot->getAttachment(), slotBone);
+		_updateCacheKey.add(0xffffffff);
+	}
+}
 
-		for (size_t ii = 0; ii < transformCount; ++ii) {
-			TransformConstraint *constraint = _transformConstraints[ii];
-			if (constraint->getData().getOrder() == i) {
-				sortTransformConstraint(constraint);
-				i++;
-				goto continue_outer;
-			}
+void Skeleton::addPathAttachmentKey(Attachment *attachment, Bone &slotBone) {
+	if (attachment == NULL || !attachment->getRTTI().instanceOf(PathAttachment::rtti)) return;
+	Vector<size_t> &pathBones = static_cast<PathAttachment *>(attachment)->getBones();
+	if (pathBones.size() == 0)
+		_updateCacheKey.add((unsigned int) slotBone._data.getIndex());
+	else {
+		for (size_t i = 0, n = pathBones.size(); i < n;) {
+			size_t nn = pathBones[i++];
+			nn += i;
+			while (i < nn)
+				_updateCacheKey.add((unsigned int) pathBones[i++]);
 		}
+	}
+}
 
-		for (size_t ii = 0; ii < pathCount; ++ii) {
-			PathConstraint *constraint = _pathConstraints[ii];
-			if (constraint->getData().getOrder() == i) {
-				sortPathConstraint(constraint);
-				i++;
-				goto continue_outer;
-			}
+void Skeleton::sortUpdateCache() {
+	_updateCache.clear();
+	_updateCacheReset.clear();
+	_updateCacheBones.clear();
+	_updateCacheBones.setSize((_bones.size() + 31) >> 5, 0);
+
+	Vector<int> &constraintOrder = *_constraintOrder;
+	for (size_t i = 0, n = constraintOrder.size(); i < n; ++i) {
+		int code = constraintOrder[i];
+		if (code == -1) continue;
+		switch (code & 3) {
+			case 1:
+				sortIkConstraint(_ikConstraints[code >> 2]);
+				break;
+			case 2:
+				sortTransformConstraint(_transformConstraints[code >> 2]);
+				break;
+			default:
+				sortPathConstraint(_pathConstraints[code >> 2]);
 		}
 	}
 
-	size_t n = _bones.size();
-	for (i = 0; i < n; ++i) {
+	for (size_t i = 0, n = _bones.size(); i < n; ++i) {
 		sortBone(_bones[i]);
 	}
 }
 
+bool Skeleton::isSkinConstraint(ConstraintData &constraint) {
+	size_t order = constraint.getOrder();
+	if (order >= _constraintOrder->size()) return false;
+	return getBit(_updateCacheKey.buffer() + ((_bones.size() + 31) >> 5), order);
+}
+
+static bool sameBones(Vector<Bone *> &bones, Vector<BoneData *> &data) {
+	if (bones.size() != data.size()) return false;
+	for (size_t i = 0, n = bones.size(); i < n; i++)
+		if (&bones[i]->getData() != data[i]) return false;
+	return true;
+}
+
+bool Skeleton::constraintsMatchData() {
+	SkeletonData &data = *_data;
+	if (_ikConstraints.size() != data._ikConstraints.size() || _transformConstraints.size() != data._transformConstraints.size() ||
+		_pathConstraints.size() != data._pathConstraints.size())
+		return false;
+	for (size_t i = 0, n = _ikConstraints.size(); i < n; i++) {
+		IkConstraint &constraint = *_ikConstraints[i];
+		if (&constraint._data != data._ikConstraints[i] || &constraint._target->_data != constraint._data._target) return false;
+		if (!sameBones(constraint._bones, constraint._data._bones)) return false;
+	}
+	for (size_t i = 0, n = _transformConstraints.size(); i < n; i++) {
+		TransformConstraint &constraint = *_transformConstraints[i];
+		if (&constraint._data != data._transformConstraints[i] || &constraint._target->_data != constraint._data._target) return false;
+		if (!sameBones(constraint._bones, constraint._data._bones)) return false;
+	}
+	for (size_t i = 0, n = _pathConstraints.size(); i < n; i++) {
+		PathConstraint &constraint = *_pathConstraints[i];
+		if (&constraint._data != data._pathConstraints[i] || &constraint._target->_data != constraint._data._target) return false;
+		if (!sameBones(constraint._bones, constraint._data._bones)) return false;
+	}
+	return true;
+}
+
+void Skeleton::updateOwnConstraintOrder() {
+	size_t ikCount = _ikConstraints.size(), transformCount = _transformConstraints.size();
+	size_t count = ikCount + transformCount + _pathConstraints.size();
+	_ownConstraintOrder.clear();
+	_ownConstraintOrder.setSize(count, -1);
+	for (size_t i = 0; i < count; i++) {
+		ConstraintData *data;
+		int code;
+		if (i < ikCount) {
+			data = &_ikConstraints[i]->_data;
+			code = (int) (i << 2) | 1;
+		} else if (i < ikCount + transformCount) {
+			data = &_transformConstraints[i - ikCount]->_data;
+			code = (int) ((i - ikCount) << 2) | 2;
+		} else {
+			data = &_pathConstraints[i - ikCount - transformCount]->_data;
+			code = (int) ((i - ikCount - transformCount) << 2) | 3;
+		}
+		size_t order = data->getOrder();
+		if (order < count && _ownConstraintOrder[order] == -1) _ownConstraintOrder[order] = code;
+	}
+}
+
+Updatable *Skeleton::getConstraint(int code) {
+	switch (code & 3) {
+		case 1:
+			return _ikConstraints[code >> 2];
+		case 2:
+			return _transformConstraints[code >> 2];
+		default:
+			return _pathConstraints[code >> 2];
+	}
+}
+
 void Skeleton::printUpdateCache() {
 	for (size_t i = 0; i < _updateCache.size(); i++) {
 		Updatable *updatable = _updateCache[i];
@@ -213,6 +434,7 @@ void Skeleton::printUpdateCache() {
 }
 
 void Skeleton::updateWorldTransform() {
+	SP_PROFILE_SCOPE("Skeleton::updateWorldTransform");
 	for (size_t i = 0, n = _updateCacheReset.size(); i < n; ++i) {
 		Bone *boneP = _updateCacheReset[i];
 		Bone &bone = *boneP;
@@ -226,11 +448,31 @@ void Skeleton::updateWorldTransform() {
 		bone._appliedValid = true;
 	}
 
+	if (_poseBuffer) {
+		_poseBuffer->updateWorldTransform(*this);
+		return;
+	}
+
 	for (size_t i = 0, n = _updateCache.size(); i < n; ++i) {
 		_updateCache[i]->update();
 	}
 }
 
+void Skeleton::setPoseBufferEnabled(bool enabled) {
+	if (enabled == (_poseBuffer != NULL)) return;
+	if (enabled) {
+		_poseBuffer = new(__FILE__, __LINE__) BonePoseBuffer();
+		_poseBuffer->build(*this);
+	} else {
+		delete _poseBuffer;
+		_poseBuffer = NULL;
+	}
+}
+
+BonePoseBuffer *Skeleton::getPoseBuffer() {
+	return _poseBuffer;
+}
+
 void Skeleton::setToSetupPose() {
 	setBonesToSetupPose();
 	setSlotsToSetupPose();
@@ -286,20 +528,28 @@ void Skeleton::setSlotsToSetupPose() {
 	}
 }
 
+// Skeleton items are created in SkeletonData order, so the data name index gives the index of the skeleton's items.
+template<typename T>
+static T *itemAt(Vector<T *> &items, int index) {
+	return index == -1 || index >= (int) items.size() ? NULL : items[index];
+}
+
 Bone *Skeleton::findBone(const String &boneName) {
-	return ContainerUtil::findWithDataName(_bones, boneName);
+	return itemAt(_bones, _data->findBoneIndex(boneName));
 }
 
 int Skeleton::findBoneIndex(const String &boneName) {
-	return ContainerUtil::findIndexWithDataName(_bones, boneName);
+	int index = _data->findBoneIndex(boneName);
+	return index < (int) _bones.size() ? index : -1;
 }
 
 Slot *Skeleton::findSlot(const String &slotName) {
-	return ContainerUtil::findWithDataName(_slots, slotName);
+	return itemAt(_slots, _data->findSlotIndex(slotName));
 }
 
 int Skeleton::findSlotIndex(const String &slotName) {
-	return ContainerUtil::findIndexWithDataName(_slots, slotName);
+	int index = _data->findSlotIndex(slotName);
+	return index < (int) _slots.size() ? index : -1;
 }
 
 void Skeleton::setSkin(const String &skinName) {
@@ -308,6 +558,8 @@ void Skeleton::setSkin(const String &skinName) {
 }
 
 void Skeleton::setSkin(Skin *newSkin) {
+	// The skin's attachments may have changed even if the skin is the same.
+	clearAttachmentCache();
 	if (_skin == newSkin) return;
 	if (newSkin != NULL) {
 		if (_skin != NULL) {
@@ -336,6 +588,25 @@ Attachment *Skeleton::getAttachment(const String &slotName, const String &attach
 	return getAttachment(_data->findSlotIndex(slotName), attachmentName);
 }
 
+Attachment *Skeleton::getAttachment(int slotIndex, int attachmentHandle, const String &attachmentName) {
+	if (attachmentHandle < 0) return getAttachment(slotIndex, attachmentName);
+
+	if (attachmentHandle >= (int) _attachmentCache.size()) {
+		size_t count = MathUtil::max(_data->getAttachmentHandleCount(), (size_t) attachmentHandle + 1);
+		_attachmentCache.setSize(count, NULL);
+		_attachmentCacheStamps.setSize(count, 0);
+	}
+	if (_attachmentCacheStamps[attachmentHandle] != _attachmentCacheStamp) {
+		_attachmentCache[attachmentHandle] = getAttachment(slotIndex, attachmentName);
+		_attachmentCacheStamps[attachmentHandle] = _attachmentCacheStamp;
+	}
+	return _attachmentCache[attachmentHandle];
+}
+
+void Skeleton::clearAttachmentCache() {
+	_attachmentCacheStamp++;
+}
+
 Attachment *Skeleton::getAttachment(int slotIndex, const String &attachmentName) {
 	if (attachmentName.isEmpty()) return NULL;
 
@@ -374,41 +645,35 @@ void Skeleton::setAttachment(const String &slotName, const String &attachmentNam
 }
 
 IkConstraint *Skeleton::findIkConstraint(const String &constraintName) {
-	assert(constraintName.length() > 0);
-
-	for (size_t i = 0, n = _ikConstraints.size(); i < n; ++i) {
-		IkConstraint *ikConstraint = _ikConstraints[i];
-		if (ikConstraint->_data.getName() == constraintName) {
-			return ikConstraint;
-		}
-	}
-	return NULL;
+	return getIkConstraint(_data->findIkConstraintHandle(constraintName));
 }
 
 TransformConstraint *Skeleton::findTransformConstraint(const String &constraintName) {
-	assert(constraintName.length() > 0);
+	return getTransformConstraint(_data->findTransformConstraintHandle(constraintName));
+}
 
-	for (size_t i = 0, n = _transformConstraints.size(); i < n; ++i) {
-		TransformConstraint *transformConstraint = _transformConstraints[i];
-		if (transformConstraint->_data.getName() == constraintName) {
-			return transformConstraint;
-		}
-	}
+PathConstraint *Skeleton::findPathConstraint(const String &constraintName) {
+	return getPathConstraint(_data->findPathConstraintHandle(constraintName));
+}
 
-	return NULL;
+Bone *Skeleton::getBone(BoneHandle handle) {
+	return itemAt(_bones, handle.getIndex());
 }
 
-PathConstraint *Skeleton::findPathConstraint(const String &constraintName) {
-	assert(constraintName.length() > 0);
+Slot *Skeleton::getSlot(SlotHandle handle) {
+	return itemAt(_slots, handle.getIndex());
+}
 
-	for (size_t i = 0, n = _pathConstraints.size(); i < n; ++i) {
-		PathConstraint *constraint = _pathConstraints[i];
-		if (constraint->_data.getName() == constraintName) {
-			return constraint;
-		}
-	}
+IkConstraint *Skeleton::getIkConstraint(IkConstraintHandle handle) {
+	return itemAt(_ikConstraints, handle.getIndex());
+}
 
-	return NULL;
+TransformConstraint *Skeleton::getTransformConstraint(TransformConstraintHandle handle) {
+	return itemAt(_transformConstraints, handle.getIndex());
+}
+
+PathConstraint *Skeleton::getPathConstraint(PathConstraintHandle handle) {
+	return itemAt(_pathConstraints, handle.getIndex());
 }
 
 void Skeleton::update(float delta) {
@@ -446,15 +711,7 @@ void Skeleton::getBounds(float &outX, float &outY, float &outWidth, float &outHe
 			mesh->computeWorldVertices(*slot, 0, verticesLength, outVertexBuffer, 0);
 		}
 
-		for (size_t ii = 0; ii < verticesLength; ii += 2) {
-			float vx = outVertexBuffer[ii];
-			float vy = outVertexBuffer[ii + 1];
-
-			minX = MathUtil::min(minX, vx);
-			minY = MathUtil::min(minY, vy);
-			maxX = MathUtil::max(maxX, vx);
-			maxY = MathUtil::max(maxY, vy);
-		}
+		SimdUtil::bounds(outVertexBuffer.buffer(), verticesLength >> 1, minX, minY, maxX, maxY);
 	}
 
 	outX = minX;
@@ -479,6 +736,10 @@ Vector<Updatable *> &Skeleton::getUpdateCacheList() {
 	return _updateCache;
 }
 
+Vector<Bone *> &Skeleton::getUpdateCacheResetList() {
+	return _updateCacheReset;
+}
+
 Vector<Slot *> &Skeleton::getSlots() {
 	return _slots;
 }
@@ -553,7 +814,7 @@ void Skeleton::setScaleY(float inValue) {
 }
 
 void Skeleton::sortIkConstraint(IkConstraint *constraint) {
-	constraint->_active = constraint->_target->_active && (!constraint->_data.isSkinRequired() || (_skin && _skin->_constraints.contains(&constraint->_data)));
+	constraint->_active = constraint->_target->_active && (!constraint->_data.isSkinRequired() || isSkinConstraint(constraint->_data));
 	if (!constraint->_active) return;
 
 	Bone *target = constraint->getTarget();
@@ -565,7 +826,7 @@ void Skeleton::sortIkConstraint(IkConstraint *constraint) {
 
 	if (constrained.size() > 1) {
 		Bone *child = constrained[constrained.size() - 1];
-		if (!_updateCache.contains(child)) _updateCacheReset.add(child);
+		if (!getBit(_updateCacheBones.buffer(), child->_data.getIndex())) _updateCacheReset.add(child);
 	}
 
 	_updateCache.add(constraint);
@@ -575,7 +836,7 @@ void Skeleton::sortIkConstraint(IkConstraint *constraint) {
 }
 
 void Skeleton::sortPathConstraint(PathConstraint *constraint) {
-	constraint->_active = constraint->_target->_bone._active && (!constraint->_data.isSkinRequired() || (_skin && _skin->_constraints.contains(&constraint->_data)));
+	constraint->_active = constraint->_target->_bone._active && (!constraint->_data.isSkinRequired() || isSkinConstraint(constraint->_data));
 	if (!constraint->_active) return;
 
 	Slot *slot = constraint->getTarget();
@@ -606,7 +867,7 @@ void Skeleton::sortPathConstraint(PathConstraint *constraint) {
 }
 
 void Skeleton::sortTransformConstraint(TransformConstraint *constraint) {
-	constraint->_active = constraint->_target->_active && (!constraint->_data.isSkinRequired() || (_skin && _skin->_constraints.contains(&constraint->_data)));
+	constraint->_active = constraint->_target->_active && (!constraint->_data.isSkinRequired() || isSkinConstraint(constraint->_data));
 	if (!constraint->_active) return;
 
 	sortBone(constraint->getTarget());
@@ -617,7 +878,7 @@ void Skeleton::sortTransformConstraint(TransformConstraint *constraint) {
 		for (size_t i = 0; i < boneCount; i++) {
 			Bone *child = constrained[i];
 			sortBone(child->getParent());
-			if (!_updateCache.contains(child)) _updateCacheReset.add(child);
+			if (!getBit(_updateCacheBones.buffer(), child->_data.getIndex())) _updateCacheReset.add(child);
 		}
 	} else {
 		for (size_t i = 0; i < boneCount; ++i) {
@@ -634,15 +895,10 @@ void Skeleton::sortTransformConstraint(TransformConstraint *constraint) {
 }
 
 void Skeleton::sortPathConstraintAttachment(Skin *skin, size_t slotIndex, Bone &slotBone) {
-	Skin::AttachmentMap::Entries attachments = skin->getAttachments();
-
-	while (attachments.hasNext()) {
-		Skin::AttachmentMap::Entry entry = attachments.next();
-		if (entry._slotIndex == slotIndex) {
-			Attachment *value = entry._attachment;
-			sortPathConstraintAttachment(value, slotBone);
-		}
-	}
+	_slotAttachments.clear();
+	skin->findAttachmentsForSlot(slotIndex, _slotAttachments);
+	for (size_t i = 0, n = _slotAttachments.size(); i < n; i++)
+		sortPathConstraintAttachment(_slotAttachments[i], slotBone);
 }
 
 void Skeleton::sortPathConstraintAttachment(Attachment *attachment, Bone &slotBone) {
@@ -666,6 +922,7 @@ void Skeleton::sortBone(Bone *bone) {
 	Bone *parent = bone->_parent;
 	if (parent != NULL) sortBone(parent);
 	bone->_sorted = true;
+	setBit(_updateCacheBones.buffer(), bone->_data.getIndex());
 	_updateCache.add(bone);
 }
 
@@ -0,0 +1,210 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifdef SPINE_UE4
+#include "SpinePluginPrivatePCH.h"
+#endif
+
+#include <spine/SkeletonBatchUpdater.h>
+
+#include <spine/AnimationState.h>
+#include <spine/Skeleton.h>
+
+using namespace spine;
+
+SkeletonBatchUpdater::SkeletonBatchUpdater(int workerCount) :
+	_generation(0),
+	_busyWorkers(0),
+	_shutdown(false),
+	_delta(0) {
+	if (workerCount < 0) workerCount = Thread::getProcessorCount() - 1;
+
+	for (int i = 0; i <= workerCount; i++) {
+		Worker *worker = new(__FILE__, __LINE__) Worker();
+		worker->updater = this;
+		worker->index = i;
+		worker->start = worker->end = 0;
+		if (i > 0 && !worker->thread.start(runWorker, worker)) {
+			delete worker;
+			break;
+		}
+		_workers.add(worker);
+	}
+}
+
+SkeletonBatchUpdater::~SkeletonBatchUpdater() {
+	_mutex.lock();
+	_shutdown = true;
+	_workAvailable.broadcast();
+	_mutex.unlock();
+	for (size_t i = 0; i < _workers.size(); i++) {
+		_workers[i]->thread.join();
+		delete _workers[i];
+	}
+}
+
+void SkeletonBatchUpdater::add(Skeleton *skeleton, AnimationState *state) {
+	assert(skeleton != NULL);
+	Entry entry;
+	entry.skeleton = skeleton;
+	entry.state = state;
+	entry.drainDisabled = false;
+	_entries.add(entry);
+}
+
+bool SkeletonBatchUpdater::remove(Skeleton *skeleton) {
+	for (size_t i = 0; i < _entries.size(); i++) {
+		if (_entries[i].skeleton == skeleton) {
+			_entries.removeAt(i);
+			return true;
+		}
+	}
+	return false;
+}
+
+void SkeletonBatchUpdater::clear() {
+	_entries.clear();
+}
+
+size_t SkeletonBatchUpdater::size() {
+	return _entries.size();
+}
+
+int SkeletonBatchUpdater::getWorkerCount() {
+	return (int) _workers.size() - 1;
+}
+
+void SkeletonBatchUpdater::update(float delta) {
+	size_t entryCount = _entries.size(), workerCount = _workers.size();
+	if (entryCount == 0) return;
+
+	// Queue all callbacks until the workers are done, unless the application disabled the queue itself.
+	for (size_t i = 0; i < entryCount; i++) {
+		Entry &entry = _entries[i];
+		if (!entry.state) continue;
+		entry.drainDisabled = entry.state->_queue->_drainDisabled;
+		entry.state->_queue->_drainDisabled = true;
+	}
+
+	for (size_t i = 0; i < workerCount; i++) {
+		_workers[i]->start = entryCount * i / workerCount;
+		_workers[i]->end = entryCount * (i + 1) / workerCount;
+	}
+
+	_mutex.lock();
+	_delta = delta;
+	_busyWorkers = (int) workerCount - 1;
+	_generation++;
+	_workAvailable.broadcast();
+	_mutex.unlock();
+
+	work(*_workers[0]);
+
+	_mutex.lock();
+	while (_busyWorkers > 0)
+		_workDone.wait(_mutex);
+	_mutex.unlock();
+
+	for (size_t i = 0; i < entryCount; i++) {
+		Entry &entry = _entries[i];
+		if (!entry.state || entry.drainDisabled) continue;
+		entry.state->_queue->_drainDisabled = false;
+		entry.state->_queue->drain();
+	}
+}
+
+void SkeletonBatchUpdater::runWorker(void *argument) {
+	Worker &worker = *(Worker *) argument;
+	SkeletonBatchUpdater &updater = *worker.updater;
+	int generation = 0;
+	while (true) {
+		updater._mutex.lock();
+		while (!updater._shutdown && updater._generation == generation)
+			updater._workAvailable.wait(updater._mutex);
+		if (updater._shutdown) {
+			updater._mutex.unlock();
+			return;
+		}
+		generation = updater._generation;
+		updater._mutex.unlock();
+
+		updater.work(worker);
+
+		updater._mutex.lock();
+		if (--updater._busyWorkers == 0) updater._workDone.signal();
+		updater._mutex.unlock();
+	}
+}
+
+void SkeletonBatchUpdater::work(Worker &worker) {
+	size_t index;
+	while (next(worker, index) || steal(worker, index))
+		updateEntry(_entries[index]);
+}
+
+bool SkeletonBatchUpdater::next(Worker &worker, size_t &outIndex) {
+	MutexLock lock(worker.mutex);
+	if (worker.start == worker.end) return false;
+	outIndex = worker.start++;
+	return true;
+}
+
+bool SkeletonBatchUpdater::steal(Worker &thief, size_t &outIndex) {
+	// Take the back half of the first worker that has entries left. Only one mutex is held at a time, and the
+	// thief's own range is empty, so nobody else touches it until it is refilled.
+	size_t workerCount = _workers.size();
+	for (size_t i = 1; i < workerCount; i++) {
+		Worker &victim = *_workers[(thief.index + i) % workerCount];
+		size_t start, count;
+		{
+			MutexLock lock(victim.mutex);
+			count = (victim.end - victim.start + 1) >> 1;
+			if (count == 0) continue;
+			start = victim.end - count;
+			victim.end = start;
+		}
+		MutexLock lock(thief.mutex);
+		thief.start = start + 1;
+		thief.end = start + count;
+		outIndex = start;
+		return true;
+	}
+	return false;
+}
+
+void SkeletonBatchUpdater::updateEntry(Entry &entry) {
+	Skeleton &skeleton = *entry.skeleton;
+	skeleton.update(_delta);
+	if (entry.state) {
+		entry.state->update(_delta);
+		entry.state->apply(skeleton);
+	}
+	skeleton.updateWorldTransform();
+}
@@ -73,6 +73,7 @@
 #include <spine/DrawOrderTimeline.h>
 #include <spine/EventTimeline.h>
 #include <spine/Event.h>
+#include <spine/ProfilingExtension.h>
 
 using namespace spine;
 
@@ -93,13 +94,19 @@ const int SkeletonBinary::CURVE_LINEAR = 0;
 const int SkeletonBinary::CURVE_STEPPED = 1;
 const int SkeletonBinary::CURVE_BEZIER = 2;
 
+/// Names are immutable once their owner is constructed, which copies them. Replaces the copy with the name read from the
+/// input, which loading in place is a view of the buffer.
+static void takeName(const String &ownerName, const String &name) {
+	const_cast<String &>(ownerName).own(name);
+}
+
 SkeletonBinary::SkeletonBinary(Atlas *atlasArray) : _attachmentLoader(
-		new(__FILE__, __LINE__) AtlasAttachmentLoader(atlasArray)), _error(), _scale(1), _ownsLoader(true) {
+		new(__FILE__, __LINE__) AtlasAttachmentLoader(atlasArray)), _error(), _scale(1), _useArena(false), _curveMode(CurveMode_Sampled), _ownsLoader(true) {
 
 }
 
 SkeletonBinary::SkeletonBinary(AttachmentLoader *attachmentLoader) : _attachmentLoader(attachmentLoader), _error(),
-	_scale(1), _ownsLoader(false)
+	_scale(1), _useArena(false), _curveMode(CurveMode_Sampled), _ownsLoader(false)
 {
 	assert(_attachmentLoader != NULL);
 }
@@ -112,16 +119,29 @@ SkeletonBinary::~SkeletonBinary() {
 }
 
 SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, const int length) {
+	return readSkeletonData(binary, length, false, false);
+}
+
+SkeletonData *SkeletonBinary::readSkeletonDataInPlace(unsigned char *binary, int length, bool ownsBinary) {
+	return readSkeletonData(binary, length, true, ownsBinary);
+}
+
+SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, int length, bool inPlace, bool ownsBinary) {
+	SP_PROFILE_SCOPE("SkeletonBinary::readSkeletonData");
 	bool nonessential;
 	SkeletonData *skeletonData;
 
 	DataInput *input = new(__FILE__, __LINE__) DataInput();
 	input->cursor = binary;
 	input->end = binary + length;
+	input->inPlace = inPlace;
 
 	_linkedMeshes.clear();
 
 	skeletonData = new(__FILE__, __LINE__) SkeletonData();
+	if (_useArena || inPlace) skeletonData->_arena.setArena(new(__FILE__, __LINE__) Arena(length * 4));
+	if (inPlace) skeletonData->getArena()->addRegion((void *) binary, length, ownsBinary);
+	ArenaScope arenaScope(skeletonData->getArena());
 
 	char *skeletonData_hash = readString(input);
 	skeletonData->_hash.own(skeletonData_hash);
@@ -157,9 +177,10 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 	int numBones = readVarint(input, true);
 	skeletonData->_bones.setSize(numBones, 0);
 	for (int i = 0; i < numBones; ++i) {
-		const char *name = readString(input);
+		String name(readString(input), true);
 		BoneData *parent = i == 0 ? 0 : skeletonData->_bones[readVarint(input, true)];
-		BoneData *data = new(__FILE__, __LINE__) BoneData(i, String(name, true), parent);
+		BoneData *data = new(__FILE__, __LINE__) BoneData(i, name, parent);
+		takeName(data->getName(), name);
 		data->_rotation = readFloat(input);
 		data->_x = readFloat(input) * _scale;
 		data->_y = readFloat(input) * _scale;
@@ -178,9 +199,10 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 	int slotsCount = readVarint(input, true);
 	skeletonData->_slots.setSize(slotsCount, 0);
 	for (int i = 0; i < slotsCount; ++i) {
-		const char *slotName = readString(input);
+		String slotName(readString(input), true);
 		BoneData *boneData = skeletonData->_bones[readVarint(input, true)];
-		SlotData *slotData = new(__FILE__, __LINE__) SlotData(i, String(slotName, true), *boneData);
+		SlotData *slotData = new(__FILE__, __LINE__) SlotData(i, slotName, *boneData);
+		takeName(slotData->getName(), slotName);
 
 		readColor(input, slotData->getColor());
 		unsigned char r = readByte(input);
@@ -191,7 +213,7 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 			slotData->getDarkColor().set(r / 255.0f, g / 255.0f, b / 255.0f, 1);
 			slotData->setHasDarkColor(true);
 		}
-		slotData->_attachmentName = readStringRef(input, skeletonData);
+		setStringRef(input, slotData->_attachmentName, readStringRef(input, skeletonData));
 		slotData->_blendMode = static_cast<BlendMode>(readVarint(input, true));
 		skeletonData->_slots[i] = slotData;
 	}
@@ -200,8 +222,9 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 	int ikConstraintsCount = readVarint(input, true);
 	skeletonData->_ikConstraints.setSize(ikConstraintsCount, 0);
 	for (int i = 0; i < ikConstraintsCount; ++i) {
-		const char *name = readString(input);
-		IkConstraintData *data = new(__FILE__, __LINE__) IkConstraintData(String(name, true));
+		String name(readString(input), true);
+		IkConstraintData *data = new(__FILE__, __LINE__) IkConstraintData(name);
+		takeName(data->getName(), name);
 		data->setOrder(readVarint(input, true));
 		data->setSkinRequired(readBoolean(input));
 		int bonesCount = readVarint(input, true);
@@ -222,8 +245,9 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 	int transformConstraintsCount = readVarint(input, true);
 	skeletonData->_transformConstraints.setSize(transformConstraintsCount, 0);
 	for (int i = 0; i < transformConstraintsCount; ++i) {
-		const char *name = readString(input);
-		TransformConstraintData *data = new(__FILE__, __LINE__) TransformConstraintData(String(name, true));
+		String name(readString(input), true);
+		TransformConstraintData *data = new(__FILE__, __LINE__) TransformConstraintData(name);
+		takeName(data->getName(), name);
 		data->setOrder(readVarint(input, true));
 		data->setSkinRequired(readBoolean(input));
 		int bonesCount = readVarint(input, true);
@@ -250,8 +274,9 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 	int pathConstraintsCount = readVarint(input, true);
 	skeletonData->_pathConstraints.setSize(pathConstraintsCount, 0);
 	for (int i = 0; i < pathConstraintsCount; ++i) {
-		const char *name = readString(input);
-		PathConstraintData *data = new(__FILE__, __LINE__) PathConstraintData(String(name, true));
+		String name(readString(input), true);
+		PathConstraintData *data = new(__FILE__, __LINE__) PathConstraintData(name);
+		takeName(data->getName(), name);
 		data->setOrder(readVarint(input, true));
 		data->setSkinRequired(readBoolean(input));
 		int bonesCount = readVarint(input, true);
@@ -283,6 +308,7 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 	/* Skins. */
 	for (size_t i = 0, n = (size_t)readVarint(input, true); i < n; ++i)
 		skeletonData->_skins.add(readSkin(input, false, skeletonData, nonessential));
+	skeletonData->updateNameIndex();
 
 	/* Linked meshes. */
 	for (int i = 0, n = _linkedMeshes.size(); i < n; ++i) {
@@ -316,6 +342,7 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 	for (int i = 0; i < eventsCount; ++i) {
 		const char *name = readStringRef(input, skeletonData);
 		EventData *eventData = new(__FILE__, __LINE__) EventData(String(name));
+		if (input->inPlace) takeName(eventData->getName(), String(name, true));
 		eventData->_intValue = readVarint(input, false);
 		eventData->_floatValue = readFloat(input);
 		eventData->_stringValue.own(readString(input));
@@ -341,6 +368,10 @@ SkeletonData *SkeletonBinary::readSkeletonData(const unsigned char *binary, cons
 		skeletonData->_animations[i] = animation;
 	}
 
+	skeletonData->updateNameIndex();
+	skeletonData->updateAttachmentHandles();
+	skeletonData->updateConstraintOrder();
+
 	delete input;
 	return skeletonData;
 }
@@ -359,6 +390,7 @@ SkeletonData *SkeletonBinary::readSkeletonDataFile(const String &path) {
 }
 
 void SkeletonBinary::setError(const char *value1, const char *value2) {
+	ArenaScope noArena(NULL);
 	char message[256];
 	int length;
 	strcpy(message, value1);
@@ -371,6 +403,14 @@ char *SkeletonBinary::readString(DataInput *input) {
 	int length = readVarint(input, true);
 	char *string;
 	if (length == 0) return NULL;
+	if (input->inPlace) {
+		// Move the characters over the last byte of the length to make room for the terminator.
+		string = (char *) input->cursor - 1;
+		memmove(string, input->cursor, length - 1);
+		input->cursor += length - 1;
+		string[length - 1] = '\0';
+		return string;
+	}
 	string = SpineExtension::alloc<char>(length, __FILE__, __LINE__);
 	memcpy(string, input->cursor, length - 1);
 	input->cursor += length - 1;
@@ -378,6 +418,14 @@ char *SkeletonBinary::readString(DataInput *input) {
 	return string;
 }
 
+void SkeletonBinary::setStringRef(DataInput *input, String &string, const char *value) {
+	// Strings read in place stay in the buffer as long as the skeleton data, so they can be shared instead of copied.
+	if (input->inPlace)
+		string.own(value);
+	else
+		string = value;
+}
+
 char* SkeletonBinary::readStringRef(DataInput* input, SkeletonData* skeletonData) {
 	int index = readVarint(input, true);
 	return index == 0 ? NULL : skeletonData->_strings[index - 1];
@@ -553,6 +601,8 @@ Attachment *SkeletonBinary::readAttachment(DataInput *input, Skin *skin, int slo
 			mesh->_height = readFloat(input) * _scale;
 		}
 
+		// Linked meshes are owned by the loader, not the skeleton data.
+		ArenaScope noArena(NULL);
 		LinkedMesh *linkedMesh = new(__FILE__, __LINE__) LinkedMesh(mesh, String(skinName), slotIndex,
 																	String(parent), inheritDeform);
 		_linkedMeshes.add(linkedMesh);
@@ -595,6 +645,7 @@ Attachment *SkeletonBinary::readAttachment(DataInput *input, Skin *skin, int slo
 		ClippingAttachment *clip = _attachmentLoader->newClippingAttachment(*skin, name);
 		readVertices(input, static_cast<VertexAttachment *>(clip), vertexCount);
 		clip->_endSlot = skeletonData->_slots[endSlotIndex];
+		clip->updateConvexPolygons();
 		if (nonessential) {
 			/* Skip color. */
 			readInt(input);
@@ -633,30 +684,33 @@ void SkeletonBinary::readVertices(DataInput *input, VertexAttachment *attachment
 	}
 }
 
+void SkeletonBinary::readFloats(DataInput *input, float *values, int n, float scale) {
+	union {
+		unsigned int intValue;
+		float floatValue;
+	} intToFloat;
+	const unsigned char *bytes = input->cursor;
+	for (int i = 0; i < n; ++i, bytes += 4) {
+		intToFloat.intValue = ((unsigned int) bytes[0] << 24) | ((unsigned int) bytes[1] << 16) | ((unsigned int) bytes[2] << 8) | bytes[3];
+		values[i] = intToFloat.floatValue * scale;
+	}
+	input->cursor = bytes;
+}
+
 void SkeletonBinary::readFloatArray(DataInput *input, int n, float scale, Vector<float> &array) {
 	array.setSize(n, 0);
-
-	int i;
-	if (scale == 1) {
-		for (i = 0; i < n; ++i) {
-			array[i] = readFloat(input);
-		}
-	} else {
-		for (i = 0; i < n; ++i) {
-			array[i] = readFloat(input) * scale;
-		}
-	}
+	readFloats(input, array.buffer(), n, scale);
 }
 
 void SkeletonBinary::readShortArray(DataInput *input, Vector<unsigned short> &array) {
 	int n = readVarint(input, true);
 	array.setSize(n, 0);
 
-	int i;
-	for (i = 0; i < n; ++i) {
-		array[i] = readByte(input) << 8;
-		array[i] |= readByte(input);
-	}
+	unsigned short *values = array.buffer();
+	const unsigned char *bytes = input->cursor;
+	for (int i = 0; i < n; ++i, bytes += 2)
+		values[i] = (unsigned short) ((bytes[0] << 8) | bytes[1]);
+	input->cursor = bytes;
 }
 
 Animation *SkeletonBinary::readAnimation(const String &name, DataInput *input, SkeletonData *skeletonData) {
@@ -919,14 +973,7 @@ Animation *SkeletonBinary::readAnimation(const String &name, DataInput *input, S
 					} else {
 						deform.setSize(deformLength, 0);
 						size_t start = (size_t)readVarint(input, true);
-						end += start;
-						if (scale == 1) {
-							for (size_t v = start; v < end; ++v)
-								deform[v] = readFloat(input);
-						} else {
-							for (size_t v = start; v < end; ++v)
-								deform[v] = readFloat(input) * scale;
-						}
+						readFloats(input, deform.buffer() + start, (int) end, scale);
 
 						if (!weighted) {
 							for (size_t v = 0, vn = deform.size(); v < vn; ++v)
@@ -1028,7 +1075,7 @@ void SkeletonBinary::readCurve(DataInput *input, int frameIndex, CurveTimeline *
 		float cy1 = readFloat(input);
 		float cx2 = readFloat(input);
 		float cy2 = readFloat(input);
-		timeline->setCurve(frameIndex, cx1, cy1, cx2, cy2);
+		timeline->setCurve(frameIndex, cx1, cy1, cx2, cy2, _curveMode);
 		break;
 	}
 	}
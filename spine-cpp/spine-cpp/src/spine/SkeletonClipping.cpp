@@ -34,7 +34,11 @@
 #include <spine/SkeletonClipping.h>
 
 #include <spine/Slot.h>
+#include <spine/Bone.h>
 #include <spine/ClippingAttachment.h>
+#include <spine/ContainerUtil.h>
+#include <spine/ProfilingExtension.h>
+#include <spine/SimdUtil.h>
 
 using namespace spine;
 
@@ -45,6 +49,10 @@ SkeletonClipping::SkeletonClipping() : _clipAttachment(NULL) {
 	_clippedUVs.ensureCapacity(128);
 }
 
+SkeletonClipping::~SkeletonClipping() {
+	ContainerUtil::cleanUpVectorOfPointers(_polygonStorage);
+}
+
 size_t SkeletonClipping::clipStart(Slot &slot, ClippingAttachment *clip) {
 	if (_clipAttachment != NULL) {
 		return 0;
@@ -52,21 +60,72 @@ size_t SkeletonClipping::clipStart(Slot &slot, ClippingAttachment *clip) {
 
 	_clipAttachment = clip;
 
-	int n = clip->getWorldVerticesLength();
-	_clippingPolygon.setSize(n, 0);
-	clip->computeWorldVertices(slot, 0, n, _clippingPolygon, 0, 2);
-	makeClockwise(_clippingPolygon);
-	_clippingPolygons = &_triangulator.decompose(_clippingPolygon, _triangulator.triangulate(_clippingPolygon));
-
-	for (size_t i = 0; i < _clippingPolygons->size(); ++i) {
-		Vector<float> *polygonP = (*_clippingPolygons)[i];
-		Vector<float> &polygon = *polygonP;
-		makeClockwise(polygon);
-		polygon.add(polygon[0]);
-		polygon.add(polygon[1]);
+	Vector<int> &sizes = clip->_convexPolygonSizes;
+	if (sizes.size() > 0 && slot.getDeformLength() == 0) {
+		// Transform the cached decomposition. A transform that flips makes the polygons counter clockwise.
+		Bone &bone = slot.getBone();
+		float a = bone.getA(), b = bone.getB(), c = bone.getC(), d = bone.getD();
+		bool flip = a * d - b * c < 0;
+		while (_polygonStorage.size() < sizes.size())
+			_polygonStorage.add(new(__FILE__, __LINE__) Vector<float>());
+		_transformedPolygons.clear();
+		const float *vertices = clip->_convexPolygons.buffer();
+		for (size_t i = 0; i < sizes.size(); ++i) {
+			Vector<float> &polygon = *_polygonStorage[i];
+			_transformedPolygons.add(&polygon);
+			size_t n = sizes[i];
+			polygon.setSize(n + 2, 0);
+			SimdUtil::transform(vertices, n >> 1, a, b, c, d, bone.getWorldX(), bone.getWorldY(), polygon.buffer(), 2);
+			vertices += n;
+			if (flip) {
+				for (size_t ii = 0, last = n - 2, half = n >> 1; ii < half; ii += 2) {
+					float x = polygon[ii], y = polygon[ii + 1];
+					polygon[ii] = polygon[last - ii];
+					polygon[ii + 1] = polygon[last - ii + 1];
+					polygon[last - ii] = x;
+					polygon[last - ii + 1] = y;
+				}
+			}
+			polygon[n] = polygon[0];
+			polygon[n + 1] = polygon[1];
+		}
+		_clippingPolygons = &_transformedPolygons;
+	} else {
+		int n = clip->getWorldVerticesLength();
+		_clippingPolygon.setSize(n, 0);
+		clip->computeWorldVertices(slot, 0, n, _clippingPolygon, 0, 2);
+		makeClockwise(_clippingPolygon);
+		_clippingPolygons = &_triangulator.decompose(_clippingPolygon, _triangulator.triangulate(_clippingPolygon));
+
+		for (size_t i = 0; i < _clippingPolygons->size(); ++i) {
+			Vector<float> *polygonP = (*_clippingPolygons)[i];
+			Vector<float> &polygon = *polygonP;
+			makeClockwise(polygon);
+			polygon.add(polygon[0]);
+			polygon.add(polygon[1]);
+		}
+	}
+
+	size_t polygonsCount = _clippingPolygons->size();
+	_clippingBounds.setSize(polygonsCount * 4, 0);
+	for (size_t i = 0; i < polygonsCount; ++i) {
+		Vector<float> &polygon = *(*_clippingPolygons)[i];
+		float minX = polygon[0], minY = polygon[1], maxX = minX, maxY = minY;
+		for (size_t ii = 2, n = polygon.size(); ii < n; ii += 2) {
+			float x = polygon[ii], y = polygon[ii + 1];
+			minX = MathUtil::min(minX, x);
+			minY = MathUtil::min(minY, y);
+			maxX = MathUtil::max(maxX, x);
+			maxY = MathUtil::max(maxY, y);
+		}
+		float *bounds = _clippingBounds.buffer() + i * 4;
+		bounds[0] = minX;
+		bounds[1] = minY;
+		bounds[2] = maxX;
+		bounds[3] = maxY;
 	}
 
-	return (*_clippingPolygons).size();
+	return polygonsCount;
 }
 
 void SkeletonClipping::clipEnd(Slot &slot) {
@@ -82,6 +141,7 @@ void SkeletonClipping::clipEnd() {
 	_clippingPolygons = NULL;
 	_clippedVertices.clear();
 	_clippedUVs.clear();
+	_clippedAttributes.clear();
 	_clippedTriangles.clear();
 	_clippingPolygon.clear();
 }
@@ -90,97 +150,159 @@ void SkeletonClipping::clipTriangles(Vector<float> &vertices, Vector<unsigned sh
 	clipTriangles(vertices.buffer(), triangles.buffer(), triangles.size(), uvs.buffer(), stride);
 }
 
-void SkeletonClipping::clipTriangles(float *vertices, unsigned short *triangles,
-	size_t trianglesLength, float *uvs, size_t stride
+void SkeletonClipping::clipTriangles(float *vertices, unsigned short *triangles, size_t trianglesLength, float *uvs,
+	size_t stride
 ) {
-	Vector<float> &clipOutput = _clipOutput;
-	Vector<float> &clippedVertices = _clippedVertices;
-	Vector<unsigned short> &clippedTriangles = _clippedTriangles;
+	clipTriangles(vertices, triangles, trianglesLength, uvs, stride, NULL, 0);
+}
+
+/// Returns where count more elements can be written after length, growing the buffer geometrically. The buffer's size is
+/// its capacity while clipping and is truncated to the written length at the end.
+template<typename T>
+static inline T *reserveOutput(Vector<T> &buffer, size_t length, size_t count) {
+	if (length + count > buffer.size()) buffer.setSize(MathUtil::max(buffer.size() << 1, length + count), 0);
+	return buffer.buffer() + length;
+}
+
+void SkeletonClipping::clipTriangles(float *vertices, unsigned short *triangles, size_t trianglesLength, float *uvs,
+	size_t stride, float *attributes, size_t attributeCount
+) {
+	SP_PROFILE_SCOPE("SkeletonClipping::clipTriangles");
 	Vector<Vector<float> *> &polygons = *_clippingPolygons;
-	size_t polygonsCount = (*_clippingPolygons).size();
+	size_t polygonsCount = polygons.size();
+
+	// Classify each vertex against every polygon up front, several vertices at a time, instead of each triangle corner.
+	size_t vertexCount = 0;
+	for (size_t i = 0; i < trianglesLength; i++)
+		vertexCount = MathUtil::max(vertexCount, (size_t) triangles[i] + 1);
+	_vertexXs.setSize(vertexCount, 0);
+	_vertexYs.setSize(vertexCount, 0);
+	float *xs = _vertexXs.buffer(), *ys = _vertexYs.buffer();
+	for (size_t i = 0; i < vertexCount; i++) {
+		xs[i] = vertices[i * stride];
+		ys[i] = vertices[i * stride + 1];
+	}
+	_insideFlags.setSize(vertexCount * polygonsCount, 0);
+	size_t maxPolygonLength = 0;
+	for (size_t p = 0; p < polygonsCount; p++) {
+		Vector<float> &polygon = *polygons[p];
+		SimdUtil::insidePolygon(xs, ys, vertexCount, polygon.buffer(), polygon.size(), _insideFlags.buffer() + p * vertexCount);
+		maxPolygonLength = MathUtil::max(maxPolygonLength, polygon.size());
+	}
+	_clipOutput.setSize(maxPolygonLength + 6, 0);
+	_scratch.setSize(maxPolygonLength + 6, 0);
+	float *clipOutput = _clipOutput.buffer();
 
+	size_t verticesLength = 0, attributesLength = 0, trianglesOutputLength = 0;
 	size_t index = 0;
-	clippedVertices.clear();
-	_clippedUVs.clear();
-	clippedTriangles.clear();
-
-	size_t i = 0;
-	continue_outer:
-	for (; i < trianglesLength; i += 3) {
-		int vertexOffset = triangles[i] * stride;
+	for (size_t i = 0; i < trianglesLength; i += 3) {
+		int t1 = triangles[i], t2 = triangles[i + 1], t3 = triangles[i + 2];
+		int vertexOffset = t1 * stride;
 		float x1 = vertices[vertexOffset], y1 = vertices[vertexOffset + 1];
 		float u1 = uvs[vertexOffset], v1 = uvs[vertexOffset + 1];
 
-		vertexOffset = triangles[i + 1] * stride;
+		vertexOffset = t2 * stride;
 		float x2 = vertices[vertexOffset], y2 = vertices[vertexOffset + 1];
 		float u2 = uvs[vertexOffset], v2 = uvs[vertexOffset + 1];
 
-		vertexOffset = triangles[i + 2] * stride;
+		vertexOffset = t3 * stride;
 		float x3 = vertices[vertexOffset], y3 = vertices[vertexOffset + 1];
 		float u3 = uvs[vertexOffset], v3 = uvs[vertexOffset + 1];
 
+		float minX = MathUtil::min(x1, MathUtil::min(x2, x3)), maxX = MathUtil::max(x1, MathUtil::max(x2, x3));
+		float minY = MathUtil::min(y1, MathUtil::min(y2, y3)), maxY = MathUtil::max(y1, MathUtil::max(y2, y3));
+
 		for (size_t p = 0; p < polygonsCount; p++) {
-			size_t s = clippedVertices.size();
-			if (clip(x1, y1, x2, y2, x3, y3, &(*polygons[p]), &clipOutput)) {
-				size_t clipOutputLength = clipOutput.size();
-				if (clipOutputLength == 0) continue;
-				float d0 = y2 - y3, d1 = x3 - x2, d2 = x1 - x3, d4 = y3 - y1;
-				float d = 1 / (d0 * d2 + d1 * (y1 - y3));
-
-				size_t clipOutputCount = clipOutputLength >> 1;
-				clippedVertices.setSize(s + clipOutputCount * 2, 0);
-				_clippedUVs.setSize(s + clipOutputCount * 2, 0);
-				for (size_t ii = 0; ii < clipOutputLength; ii += 2) {
-					float x = clipOutput[ii], y = clipOutput[ii + 1];
-					clippedVertices[s] = x;
-					clippedVertices[s + 1] = y;
-					float c0 = x - x3, c1 = y - y3;
-					float a = (d0 * c0 + d1 * c1) * d;
-					float b = (d4 * c0 + d2 * c1) * d;
-					float c = 1 - a - b;
-					_clippedUVs[s] = u1 * a + u2 * b + u3 * c;
-					_clippedUVs[s + 1] = v1 * a + v2 * b + v3 * c;
-					s += 2;
+			// Triangles outside the polygon's bounds are clipped away entirely.
+			const float *bounds = _clippingBounds.buffer() + p * 4;
+			if (maxX < bounds[0] || maxY < bounds[1] || minX > bounds[2] || minY > bounds[3]) continue;
+
+			const unsigned char *inside = _insideFlags.buffer() + p * vertexCount;
+			if (inside[t1] && inside[t2] && inside[t3]) {
+				// Entirely within this polygon, so no other polygon can overlap it.
+				float *outVertices = reserveOutput(_clippedVertices, verticesLength, 6);
+				outVertices[0] = x1;
+				outVertices[1] = y1;
+				outVertices[2] = x2;
+				outVertices[3] = y2;
+				outVertices[4] = x3;
+				outVertices[5] = y3;
+
+				float *outUVs = reserveOutput(_clippedUVs, verticesLength, 6);
+				outUVs[0] = u1;
+				outUVs[1] = v1;
+				outUVs[2] = u2;
+				outUVs[3] = v2;
+				outUVs[4] = u3;
+				outUVs[5] = v3;
+				verticesLength += 6;
+
+				if (attributeCount > 0) {
+					float *outAttributes = reserveOutput(_clippedAttributes, attributesLength, attributeCount * 3);
+					memcpy(outAttributes, attributes + t1 * attributeCount, attributeCount * sizeof(float));
+					memcpy(outAttributes + attributeCount, attributes + t2 * attributeCount, attributeCount * sizeof(float));
+					memcpy(outAttributes + attributeCount * 2, attributes + t3 * attributeCount, attributeCount * sizeof(float));
+					attributesLength += attributeCount * 3;
 				}
 
-				s = clippedTriangles.size();
-				clippedTriangles.setSize(s + 3 * (clipOutputCount - 2), 0);
-				clipOutputCount--;
-				for (size_t ii = 1; ii < clipOutputCount; ii++) {
-					clippedTriangles[s] = (unsigned short)(index);
-					clippedTriangles[s + 1] = (unsigned short)(index + ii);
-					clippedTriangles[s + 2] = (unsigned short)(index + ii + 1);
-					s += 3;
-				}
-				index += clipOutputCount + 1;
-			} else {
-				clippedVertices.setSize(s + 3 * 2, 0);
-				_clippedUVs.setSize(s + 3 * 2, 0);
-				clippedVertices[s] = x1;
-				clippedVertices[s + 1] = y1;
-				clippedVertices[s + 2] = x2;
-				clippedVertices[s + 3] = y2;
-				clippedVertices[s + 4] = x3;
-				clippedVertices[s + 5] = y3;
-
-				_clippedUVs[s] = u1;
-				_clippedUVs[s + 1] = v1;
-				_clippedUVs[s + 2] = u2;
-				_clippedUVs[s + 3] = v2;
-				_clippedUVs[s + 4] = u3;
-				_clippedUVs[s + 5] = v3;
-
-				s = clippedTriangles.size();
-				clippedTriangles.setSize(s + 3, 0);
-				clippedTriangles[s] = (unsigned short)index;
-				clippedTriangles[s + 1] = (unsigned short)(index + 1);
-				clippedTriangles[s + 2] = (unsigned short)(index + 2);
+				unsigned short *outTriangles = reserveOutput(_clippedTriangles, trianglesOutputLength, 3);
+				outTriangles[0] = (unsigned short) index;
+				outTriangles[1] = (unsigned short) (index + 1);
+				outTriangles[2] = (unsigned short) (index + 2);
+				trianglesOutputLength += 3;
 				index += 3;
-				i += 3;
-				goto continue_outer;
+				break;
+			}
+
+			Vector<float> &polygon = *polygons[p];
+			size_t clipOutputLength = clip(x1, y1, x2, y2, x3, y3, polygon.buffer(), polygon.size(), clipOutput, _scratch.buffer());
+			if (clipOutputLength == 0) continue;
+
+			float d0 = y2 - y3, d1 = x3 - x2, d2 = x1 - x3, d4 = y3 - y1;
+			float d = 1 / (d0 * d2 + d1 * (y1 - y3));
+
+			size_t clipOutputCount = clipOutputLength >> 1;
+			float *outVertices = reserveOutput(_clippedVertices, verticesLength, clipOutputLength);
+			float *outUVs = reserveOutput(_clippedUVs, verticesLength, clipOutputLength);
+			float *outAttributes = NULL, *attributes1 = NULL, *attributes2 = NULL, *attributes3 = NULL;
+			if (attributeCount > 0) {
+				outAttributes = reserveOutput(_clippedAttributes, attributesLength, attributeCount * clipOutputCount);
+				attributes1 = attributes + t1 * attributeCount;
+				attributes2 = attributes + t2 * attributeCount;
+				attributes3 = attributes + t3 * attributeCount;
+				attributesLength += attributeCount * clipOutputCount;
 			}
+			memcpy(outVertices, clipOutput, clipOutputLength * sizeof(float));
+			for (size_t ii = 0; ii < clipOutputLength; ii += 2) {
+				float c0 = clipOutput[ii] - x3, c1 = clipOutput[ii + 1] - y3;
+				float a = (d0 * c0 + d1 * c1) * d;
+				float b = (d4 * c0 + d2 * c1) * d;
+				float c = 1 - a - b;
+				outUVs[ii] = u1 * a + u2 * b + u3 * c;
+				outUVs[ii + 1] = v1 * a + v2 * b + v3 * c;
+				for (size_t iii = 0; iii < attributeCount; iii++)
+					outAttributes[iii] = attributes1[iii] * a + attributes2[iii] * b + attributes3[iii] * c;
+				outAttributes += attributeCount;
+			}
+			verticesLength += clipOutputLength;
+
+			unsigned short *outTriangles = reserveOutput(_clippedTriangles, trianglesOutputLength, 3 * (clipOutputCount - 2));
+			clipOutputCount--;
+			for (size_t ii = 1; ii < clipOutputCount; ii++) {
+				outTriangles[0] = (unsigned short) (index);
+				outTriangles[1] = (unsigned short) (index + ii);
+				outTriangles[2] = (unsigned short) (index + ii + 1);
+				outTriangles += 3;
+			}
+			trianglesOutputLength += 3 * (clipOutputCount - 1);
+			index += clipOutputCount + 1;
 		}
 	}
+
+	_clippedVertices.setSize(verticesLength, 0);
+	_clippedUVs.setSize(verticesLength, 0);
+	_clippedAttributes.setSize(attributesLength, 0);
+	_clippedTriangles.setSize(trianglesOutputLength, 0);
 }
 
 bool SkeletonClipping::isClipping() {
@@ -199,49 +321,47 @@ Vector<float> &SkeletonClipping::getClippedUVs() {
 	return _clippedUVs;
 }
 
-bool SkeletonClipping::clip(float x1, float y1, float x2, float y2, float x3, float y3, Vector<float> *clippingArea,
-	Vector<float> *output
-) {
-	Vector<float> *originalOutput = output;
-	bool clipped = false;
+Vector<float> &SkeletonClipping::getClippedAttributes() {
+	return _clippedAttributes;
+}
 
+size_t SkeletonClipping::clip(float x1, float y1, float x2, float y2, float x3, float y3, const float *clippingArea,
+	size_t clippingAreaLength, float *output, float *scratch
+) {
 	// Avoid copy at the end.
-	Vector<float> *input;
-	if (clippingArea->size() % 4 >= 2) {
+	float *input;
+	if (clippingAreaLength % 4 >= 2) {
 		input = output;
-		output = &_scratch;
+		output = scratch;
 	} else
-		input = &_scratch;
-
-	input->clear();
-	input->add(x1);
-	input->add(y1);
-	input->add(x2);
-	input->add(y2);
-	input->add(x3);
-	input->add(y3);
-	input->add(x1);
-	input->add(y1);
-	output->clear();
-
-	Vector<float> &clippingVertices = *clippingArea;
-	size_t clippingVerticesLast = clippingArea->size() - 4;
+		input = scratch;
+
+	input[0] = x1;
+	input[1] = y1;
+	input[2] = x2;
+	input[3] = y2;
+	input[4] = x3;
+	input[5] = y3;
+	input[6] = x1;
+	input[7] = y1;
+	size_t inputLength = 8;
+
+	size_t clippingVerticesLast = clippingAreaLength - 4;
 	for (size_t i = 0;; i += 2) {
-		float edgeX = clippingVertices[i], edgeY = clippingVertices[i + 1];
-		float edgeX2 = clippingVertices[i + 2], edgeY2 = clippingVertices[i + 3];
+		float edgeX = clippingArea[i], edgeY = clippingArea[i + 1];
+		float edgeX2 = clippingArea[i + 2], edgeY2 = clippingArea[i + 3];
 		float deltaX = edgeX - edgeX2, deltaY = edgeY - edgeY2;
 
-		Vector<float> &inputVertices = *input;
-		size_t inputVerticesLength = input->size() - 2, outputStart = output->size();
-		for (size_t ii = 0; ii < inputVerticesLength; ii += 2) {
-			float inputX = inputVertices[ii], inputY = inputVertices[ii + 1];
-			float inputX2 = inputVertices[ii + 2], inputY2 = inputVertices[ii + 3];
+		size_t outputLength = 0;
+		for (size_t ii = 0, n = inputLength - 2; ii < n; ii += 2) {
+			float inputX = input[ii], inputY = input[ii + 1];
+			float inputX2 = input[ii + 2], inputY2 = input[ii + 3];
 			bool side2 = deltaX * (inputY2 - edgeY2) - deltaY * (inputX2 - edgeX2) > 0;
 			if (deltaX * (inputY - edgeY2) - deltaY * (inputX - edgeX2) > 0) {
 				if (side2) {
 					// v1 inside, v2 inside
-					output->add(inputX2);
-					output->add(inputY2);
+					output[outputLength++] = inputX2;
+					output[outputLength++] = inputY2;
 					continue;
 				}
 				// v1 inside, v2 outside
@@ -249,11 +369,11 @@ bool SkeletonClipping::clip(float x1, float y1, float x2, float y2, float x3, fl
 				float s = c0 * (edgeX2 - edgeX) - c2 * (edgeY2 - edgeY);
 				if (MathUtil::abs(s) > 0.000001f) {
 					float ua = (c2 * (edgeY - inputY) - c0 * (edgeX - inputX)) / s;
-					output->add(edgeX + (edgeX2 - edgeX) * ua);
-					output->add(edgeY + (edgeY2 - edgeY) * ua);
+					output[outputLength++] = edgeX + (edgeX2 - edgeX) * ua;
+					output[outputLength++] = edgeY + (edgeY2 - edgeY) * ua;
 				} else {
-					output->add(edgeX);
-					output->add(edgeY);
+					output[outputLength++] = edgeX;
+					output[outputLength++] = edgeY;
 				}
 			} else if (side2) {
 				// v1 outside, v2 inside
@@ -261,44 +381,30 @@ bool SkeletonClipping::clip(float x1, float y1, float x2, float y2, float x3, fl
 				float s = c0 * (edgeX2 - edgeX) - c2 * (edgeY2 - edgeY);
 				if (MathUtil::abs(s) > 0.000001f) {
 					float ua = (c2 * (edgeY - inputY) - c0 * (edgeX - inputX)) / s;
-					output->add(edgeX + (edgeX2 - edgeX) * ua);
-					output->add(edgeY + (edgeY2 - edgeY) * ua);
+					output[outputLength++] = edgeX + (edgeX2 - edgeX) * ua;
+					output[outputLength++] = edgeY + (edgeY2 - edgeY) * ua;
 				} else {
-					output->add(edgeX);
-					output->add(edgeY);
+					output[outputLength++] = edgeX;
+					output[outputLength++] = edgeY;
 				}
-				output->add(inputX2);
-				output->add(inputY2);
+				output[outputLength++] = inputX2;
+				output[outputLength++] = inputY2;
 			}
-			clipped = true;
 		}
 
-		if (outputStart == output->size()) {
-			// All edges outside.
-			originalOutput->clear();
-			return true;
-		}
+		// All edges outside.
+		if (outputLength == 0) return 0;
 
-		output->add((*output)[0]);
-		output->add((*output)[1]);
+		output[outputLength] = output[0];
+		output[outputLength + 1] = output[1];
 
-		if (i == clippingVerticesLast) {
-			break;
-		}
-		Vector<float> *temp = output;
+		if (i == clippingVerticesLast) return outputLength;
+
+		float *temp = output;
 		output = input;
-		output->clear();
 		input = temp;
+		inputLength = outputLength + 2;
 	}
-
-	if (originalOutput != output) {
-		originalOutput->clear();
-		for (size_t i = 0, n = output->size() - 2; i < n; ++i)
-			originalOutput->add((*output)[i]);
-	} else
-		originalOutput->setSize(originalOutput->size() - 2, 0);
-
-	return clipped;
 }
 
 void SkeletonClipping::makeClockwise(Vector<float> &polygon) {
@@ -41,6 +41,8 @@
 #include <spine/IkConstraintData.h>
 #include <spine/TransformConstraintData.h>
 #include <spine/PathConstraintData.h>
+#include <spine/AttachmentTimeline.h>
+#include <spine/SkeletonUpdateOrder.h>
 
 #include <spine/ContainerUtil.h>
 
@@ -55,11 +57,17 @@ SkeletonData::SkeletonData() :
 		_height(0),
 		_version(),
 		_hash(),
+		_maxUpdateOrders(64),
+		_nextUpdateOrder(0),
 		_fps(0),
 		_imagesPath() {
 }
 
 SkeletonData::~SkeletonData() {
+	_arena.beginDestruction();
+
+	ContainerUtil::cleanUpVectorOfPointers(_updateOrders);
+
 	ContainerUtil::cleanUpVectorOfPointers(_bones);
 	ContainerUtil::cleanUpVectorOfPointers(_slots);
 	ContainerUtil::cleanUpVectorOfPointers(_skins);
@@ -77,47 +85,133 @@ SkeletonData::~SkeletonData() {
 }
 
 BoneData *SkeletonData::findBone(const String &boneName) {
-	return ContainerUtil::findWithName(_bones, boneName);
+	return ContainerUtil::findWithName(_bones, _boneNames, boneName);
 }
 
 int SkeletonData::findBoneIndex(const String &boneName) {
-	return ContainerUtil::findIndexWithName(_bones, boneName);
+	return ContainerUtil::findIndexWithName(_bones, _boneNames, boneName);
 }
 
 SlotData *SkeletonData::findSlot(const String &slotName) {
-	return ContainerUtil::findWithName(_slots, slotName);
+	return ContainerUtil::findWithName(_slots, _slotNames, slotName);
 }
 
 int SkeletonData::findSlotIndex(const String &slotName) {
-	return ContainerUtil::findIndexWithName(_slots, slotName);
+	return ContainerUtil::findIndexWithName(_slots, _slotNames, slotName);
 }
 
 Skin *SkeletonData::findSkin(const String &skinName) {
-	return ContainerUtil::findWithName(_skins, skinName);
+	return ContainerUtil::findWithName(_skins, _skinNames, skinName);
 }
 
 spine::EventData *SkeletonData::findEvent(const String &eventDataName) {
-	return ContainerUtil::findWithName(_events, eventDataName);
+	return ContainerUtil::findWithName(_events, _eventNames, eventDataName);
 }
 
 Animation *SkeletonData::findAnimation(const String &animationName) {
-	return ContainerUtil::findWithName(_animations, animationName);
+	return ContainerUtil::findWithName(_animations, _animationNames, animationName);
 }
 
 IkConstraintData *SkeletonData::findIkConstraint(const String &constraintName) {
-	return ContainerUtil::findWithName(_ikConstraints, constraintName);
+	return ContainerUtil::findWithName(_ikConstraints, _ikConstraintNames, constraintName);
 }
 
 TransformConstraintData *SkeletonData::findTransformConstraint(const String &constraintName) {
-	return ContainerUtil::findWithName(_transformConstraints, constraintName);
+	return ContainerUtil::findWithName(_transformConstraints, _transformConstraintNames, constraintName);
 }
 
 PathConstraintData *SkeletonData::findPathConstraint(const String &constraintName) {
-	return ContainerUtil::findWithName(_pathConstraints, constraintName);
+	return ContainerUtil::findWithName(_pathConstraints, _pathConstraintNames, constraintName);
 }
 
 int SkeletonData::findPathConstraintIndex(const String &pathConstraintName) {
-	return ContainerUtil::findIndexWithName(_pathConstraints, pathConstraintName);
+	return ContainerUtil::findIndexWithName(_pathConstraints, _pathConstraintNames, pathConstraintName);
+}
+
+void SkeletonData::updateNameIndex() {
+	_boneNames.update(_bones);
+	_slotNames.update(_slots);
+	_skinNames.update(_skins);
+	_eventNames.update(_events);
+	_animationNames.update(_animations);
+	_ikConstraintNames.update(_ikConstraints);
+	_transformConstraintNames.update(_transformConstraints);
+	_pathConstraintNames.update(_pathConstraints);
+}
+
+void SkeletonData::clearNameIndex() {
+	_boneNames.clear();
+	_slotNames.clear();
+	_skinNames.clear();
+	_eventNames.clear();
+	_animationNames.clear();
+	_ikConstraintNames.clear();
+	_transformConstraintNames.clear();
+	_pathConstraintNames.clear();
+}
+
+BoneHandle SkeletonData::findBoneHandle(const String &boneName) {
+	return BoneHandle(ContainerUtil::findIndexWithName(_bones, _boneNames, boneName));
+}
+
+SlotHandle SkeletonData::findSlotHandle(const String &slotName) {
+	return SlotHandle(ContainerUtil::findIndexWithName(_slots, _slotNames, slotName));
+}
+
+SkinHandle SkeletonData::findSkinHandle(const String &skinName) {
+	return SkinHandle(ContainerUtil::findIndexWithName(_skins, _skinNames, skinName));
+}
+
+EventHandle SkeletonData::findEventHandle(const String &eventDataName) {
+	return EventHandle(ContainerUtil::findIndexWithName(_events, _eventNames, eventDataName));
+}
+
+AnimationHandle SkeletonData::findAnimationHandle(const String &animationName) {
+	return AnimationHandle(ContainerUtil::findIndexWithName(_animations, _animationNames, animationName));
+}
+
+IkConstraintHandle SkeletonData::findIkConstraintHandle(const String &constraintName) {
+	return IkConstraintHandle(ContainerUtil::findIndexWithName(_ikConstraints, _ikConstraintNames, constraintName));
+}
+
+TransformConstraintHandle SkeletonData::findTransformConstraintHandle(const String &constraintName) {
+	return TransformConstraintHandle(ContainerUtil::findIndexWithName(_transformConstraints, _transformConstraintNames, constraintName));
+}
+
+PathConstraintHandle SkeletonData::findPathConstraintHandle(const String &constraintName) {
+	return PathConstraintHandle(ContainerUtil::findIndexWithName(_pathConstraints, _pathConstraintNames, constraintName));
+}
+
+BoneData *SkeletonData::getBone(BoneHandle handle) {
+	return handle.isValid() ? _bones[handle.getIndex()] : NULL;
+}
+
+SlotData *SkeletonData::getSlot(SlotHandle handle) {
+	return handle.isValid() ? _slots[handle.getIndex()] : NULL;
+}
+
+Skin *SkeletonData::getSkin(SkinHandle handle) {
+	return handle.isValid() ? _skins[handle.getIndex()] : NULL;
+}
+
+EventData *SkeletonData::getEvent(EventHandle handle) {
+	return handle.isValid() ? _events[handle.getIndex()] : NULL;
+}
+
+Animation *SkeletonData::getAnimation(AnimationHandle handle) {
+	return handle.isValid() ? _animations[handle.getIndex()] : NULL;
+}
+
+IkConstraintData *SkeletonData::getIkConstraint(IkConstraintHandle handle) {
+	return handle.isValid() ? _ikConstraints[handle.getIndex()] : NULL;
+}
+
+TransformConstraintData *SkeletonData::getTransformConstraint(TransformConstraintHandle handle) {
+	return handle.isValid() ? _transformConstraints[handle.getIndex()] : NULL;
+}
+
+PathConstraintData *SkeletonData::getPathConstraint(PathConstraintHandle handle) {
+	return handle.isValid() ? _pathConstraints[handle.getIndex()] : NULL;
 }
 
 const String &SkeletonData::getName() {
@@ -240,3 +334,129 @@ float SkeletonData::getFps() {
 void SkeletonData::setFps(float inValue) {
 	_fps = inValue;
 }
+
+size_t SkeletonData::getMaxUpdateOrders() {
+	return _maxUpdateOrders;
+}
+
+void SkeletonData::setMaxUpdateOrders(size_t inValue) {
+	_maxUpdateOrders = inValue;
+	clearUpdateOrders();
+}
+
+void SkeletonData::clearUpdateOrders() {
+	MutexLock lock(_updateOrderMutex);
+	ContainerUtil::cleanUpVectorOfPointers(_updateOrders);
+	_nextUpdateOrder = 0;
+	updateConstraintOrder();
+}
+
+void SkeletonData::validateConstraintOrder() {
+	if (_constraintOrder.size() == _ikConstraints.size() + _transformConstraints.size() + _pathConstraints.size()) return;
+	ContainerUtil::cleanUpVectorOfPointers(_updateOrders);
+	_nextUpdateOrder = 0;
+	updateConstraintOrder();
+}
+
+void SkeletonData::updateConstraintOrder() {
+	// When orders collide, the first IK, then transform, then path constraint wins, as when sorting searched for each order.
+	size_t ikCount = _ikConstraints.size(), transformCount = _transformConstraints.size();
+	size_t count = ikCount + transformCount + _pathConstraints.size();
+	// The order may have been allocated from the arena while loading.
+	ArenaScope arenaScope(getArena());
+	_constraintOrder.clear();
+	_constraintOrder.setSize(count, -1);
+	for (size_t i = 0; i < count; i++) {
+		ConstraintData *data;
+		int code;
+		if (i < ikCount) {
+			data = _ikConstraints[i];
+			code = (int) (i << 2) | 1;
+		} else if (i < ikCount + transformCount) {
+			data = _transformConstraints[i - ikCount];
+			code = (int) ((i - ikCount) << 2) | 2;
+		} else {
+			data = _pathConstraints[i - ikCount - transformCount];
+			code = (int) ((i - ikCount - transformCount) << 2) | 3;
+		}
+		size_t order = data->getOrder();
+		if (order < count && _constraintOrder[order] == -1) _constraintOrder[order] = code;
+	}
+}
+
+Arena *SkeletonData::getArena() {
+	return _arena.getArena();
+}
+
+void SkeletonData::updateAttachmentHandles() {
+	// The handle vectors may have been allocated from the arena while loading.
+	ArenaScope arenaScope(getArena());
+	Vector< Vector<String> > names;
+	names.setSize(_slots.size(), Vector<String>());
+	for (size_t i = 0, n = _skins.size(); i < n; i++) {
+		Skin::AttachmentMap::Entries entries = _skins[i]->getAttachments();
+		while (entries.hasNext()) {
+			Skin::AttachmentMap::Entry &entry = entries.next();
+			if (!names[entry._slotIndex].contains(entry._name)) names[entry._slotIndex].add(entry._name);
+		}
+	}
+	for (size_t i = 0, n = _slots.size(); i < n; i++) {
+		const String &name = _slots[i]->_attachmentName;
+		if (!name.isEmpty() && !names[i].contains(name)) names[i].add(name);
+	}
+	for (size_t i = 0, n = _animations.size(); i < n; i++) {
+		Vector<Timeline *> &timelines = _animations[i]->getTimelines();
+		for (size_t ii = 0, nn = timelines.size(); ii < nn; ii++) {
+			if (!timelines[ii]->getRTTI().isExactly(AttachmentTimeline::rtti)) continue;
+			AttachmentTimeline *timeline = static_cast<AttachmentTimeline *>(timelines[ii]);
+			Vector<String> &slotNames = names[timeline->_slotIndex];
+			for (size_t iii = 0, nnn = timeline->_attachmentNames.size(); iii < nnn; iii++) {
+				String &name = timeline->_attachmentNames[iii];
+				if (!name.isEmpty() && !slotNames.contains(name)) slotNames.add(name);
+			}
+		}
+	}
+
+	_slotAttachmentHandles.clear();
+	_attachmentHandleSlots.clear();
+	_attachmentHandleNames.clear();
+	for (size_t i = 0, n = _slots.size(); i < n; i++) {
+		_slotAttachmentHandles.add((int) _attachmentHandleNames.size());
+		for (size_t ii = 0, nn = names[i].size(); ii < nn; ii++) {
+			_attachmentHandleSlots.add((int) i);
+			_attachmentHandleNames.add(names[i][ii]);
+		}
+	}
+	_slotAttachmentHandles.add((int) _attachmentHandleNames.size());
+
+	for (size_t i = 0, n = _slots.size(); i < n; i++)
+		_slots[i]->_attachmentHandle = findAttachmentHandle((int) i, _slots[i]->_attachmentName);
+	for (size_t i = 0, n = _animations.size(); i < n; i++) {
+		Vector<Timeline *> &timelines = _animations[i]->getTimelines();
+		for (size_t ii = 0, nn = timelines.size(); ii < nn; ii++) {
+			if (!timelines[ii]->getRTTI().isExactly(AttachmentTimeline::rtti)) continue;
+			AttachmentTimeline *timeline = static_cast<AttachmentTimeline *>(timelines[ii]);
+			for (size_t iii = 0, nnn = timeline->_attachmentNames.size(); iii < nnn; iii++)
+				timeline->_attachmentHandles[iii] = findAttachmentHandle((int) timeline->_slotIndex, timeline->_attachmentNames[iii]);
+		}
+	}
+}
+
+int SkeletonData::findAttachmentHandle(int slotIndex, const String &attachmentName) {
+	if (attachmentName.isEmpty() || slotIndex + 1 >= (int) _slotAttachmentHandles.size()) return -1;
+	for (int i = _slotAttachmentHandles[slotIndex], n = _slotAttachmentHandles[slotIndex + 1]; i < n; i++)
+		if (_attachmentHandleNames[i] == attachmentName) return i;
+	return -1;
+}
+
+size_t SkeletonData::getAttachmentHandleCount() {
+	return _attachmentHandleNames.size();
+}
+
+int SkeletonData::getAttachmentHandleSlot(int attachmentHandle) {
+	return _attachmentHandleSlots[attachmentHandle];
+}
+
+const String &SkeletonData::getAttachmentHandleName(int attachmentHandle) {
+	return _attachmentHandleNames[attachmentHandle];
+}
@@ -0,0 +1,169 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifdef SPINE_UE4
+#include "SpinePluginPrivatePCH.h"
+#endif
+
+#include <spine/SkeletonInstance.h>
+
+#include <spine/SkeletonPose.h>
+#include <spine/SkeletonPoseCache.h>
+
+using namespace spine;
+
+SkeletonInstance::SkeletonInstance(SkeletonPoseCache *cache) :
+		_cache(cache),
+		_animation(NULL),
+		_skin(NULL),
+		_loop(false),
+		_time(0),
+		_timeScale(1),
+		_x(0),
+		_y(0),
+		_rotation(0),
+		_scaleX(1),
+		_scaleY(1),
+		_color(1, 1, 1, 1) {
+	assert(cache != NULL);
+}
+
+void SkeletonInstance::setAnimation(Animation *animation, bool loop) {
+	_animation = animation;
+	_loop = loop;
+	_time = 0;
+}
+
+Animation *SkeletonInstance::getAnimation() {
+	return _animation;
+}
+
+bool SkeletonInstance::getLoop() {
+	return _loop;
+}
+
+Skin *SkeletonInstance::getSkin() {
+	return _skin;
+}
+
+void SkeletonInstance::setSkin(Skin *inValue) {
+	_skin = inValue;
+}
+
+void SkeletonInstance::update(float delta) {
+	_time += delta * _timeScale;
+}
+
+float SkeletonInstance::getTime() {
+	return _time;
+}
+
+void SkeletonInstance::setTime(float inValue) {
+	_time = inValue;
+}
+
+float SkeletonInstance::getTimeScale() {
+	return _timeScale;
+}
+
+void SkeletonInstance::setTimeScale(float inValue) {
+	_timeScale = inValue;
+}
+
+SkeletonPose *SkeletonInstance::getPose() {
+	return _cache->getPose(_animation, _time, _loop, _skin);
+}
+
+void SkeletonInstance::computeWorldVertices(SkeletonPose &pose, size_t slotIndex, float *worldVertices, size_t offset,
+	size_t stride
+) {
+	float sine, cosine;
+	MathUtil::sinCosDeg(_rotation, sine, cosine);
+	float a = cosine * _scaleX, b = -sine * _scaleY, c = sine * _scaleX, d = cosine * _scaleY;
+	float *vertices = pose.getVertices(slotIndex);
+	for (size_t i = 0, n = pose.getVerticesLength(slotIndex), w = offset; i < n; i += 2, w += stride) {
+		float vx = vertices[i], vy = vertices[i + 1];
+		worldVertices[w] = vx * a + vy * b + _x;
+		worldVertices[w + 1] = vx * c + vy * d + _y;
+	}
+}
+
+SkeletonPoseCache *SkeletonInstance::getCache() {
+	return _cache;
+}
+
+float SkeletonInstance::getX() {
+	return _x;
+}
+
+void SkeletonInstance::setX(float inValue) {
+	_x = inValue;
+}
+
+float SkeletonInstance::getY() {
+	return _y;
+}
+
+void SkeletonInstance::setY(float inValue) {
+	_y = inValue;
+}
+
+void SkeletonInstance::setPosition(float x, float y) {
+	_x = x;
+	_y = y;
+}
+
+float SkeletonInstance::getRotation() {
+	return _rotation;
+}
+
+void SkeletonInstance::setRotation(float inValue) {
+	_rotation = inValue;
+}
+
+float SkeletonInstance::getScaleX() {
+	return _scaleX;
+}
+
+void SkeletonInstance::setScaleX(float inValue) {
+	_scaleX = inValue;
+}
+
+float SkeletonInstance::getScaleY() {
+	return _scaleY;
+}
+
+void SkeletonInstance::setScaleY(float inValue) {
+	_scaleY = inValue;
+}
+
+Color &SkeletonInstance::getColor() {
+	return _color;
+}
@@ -72,6 +72,7 @@
 #include <spine/DrawOrderTimeline.h>
 #include <spine/EventTimeline.h>
 #include <spine/Event.h>
+#include <spine/ProfilingExtension.h>
 #include <spine/Vertices.h>
 
 #if defined(WIN32) || defined(_WIN32) || defined(__WIN32) && !defined(__CYGWIN__)
@@ -81,11 +82,11 @@
 using namespace spine;
 
 SkeletonJson::SkeletonJson(Atlas *atlas) : _attachmentLoader(new(__FILE__, __LINE__) AtlasAttachmentLoader(atlas)),
-	_scale(1), _ownsLoader(true)
+	_scale(1), _useArena(false), _curveMode(CurveMode_Sampled), _ownsLoader(true)
 {}
 
 SkeletonJson::SkeletonJson(AttachmentLoader *attachmentLoader) : _attachmentLoader(attachmentLoader), _scale(1),
-	_ownsLoader(false)
+	_useArena(false), _curveMode(CurveMode_Sampled), _ownsLoader(false)
 {
 	assert(_attachmentLoader != NULL);
 }
@@ -113,6 +114,7 @@ SkeletonData *SkeletonJson::readSkeletonDataFile(const String &path) {
 }
 
 SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
+	SP_PROFILE_SCOPE("SkeletonJson::readSkeletonData");
 	int i, ii;
 	SkeletonData *skeletonData;
 	Json *root, *skeleton, *bones, *boneMap, *ik, *transform, *path, *slots, *skins, *animations, *events;
@@ -128,6 +130,8 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 	}
 
 	skeletonData = new(__FILE__, __LINE__) SkeletonData();
+	if (_useArena) skeletonData->_arena.setArena(new(__FILE__, __LINE__) Arena());
+	ArenaScope arenaScope(skeletonData->getArena());
 
 	skeleton = Json::getItem(root, "skeleton");
 	if (skeleton) {
@@ -188,6 +192,7 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 		skeletonData->_bones[i] = data;
 		bonesCount++;
 	}
+	skeletonData->updateNameIndex();
 
 	/* Slots. */
 	slots = Json::getItem(root, "slots");
@@ -243,6 +248,7 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 			skeletonData->_slots[i] = data;
 		}
 	}
+	skeletonData->updateNameIndex();
 
 	/* IK constraints. */
 	ik = Json::getItem(root, "ik");
@@ -401,6 +407,7 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 			skeletonData->_pathConstraints[i] = data;
 		}
 	}
+	skeletonData->updateNameIndex();
 
 	/* Skins. */
 	skins = Json::getItem(root, "skins");
@@ -472,7 +479,8 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 				skeletonData->_defaultSkin = skin;
 			}
 
-			for (attachmentsMap = Json::getItem(skinMap, "attachments")->_child; attachmentsMap; attachmentsMap = attachmentsMap->_next) {
+			Json *attachments = Json::getItem(skinMap, "attachments");
+			for (attachmentsMap = attachments ? attachments->_child : NULL; attachmentsMap; attachmentsMap = attachmentsMap->_next) {
 				SlotData* slot = skeletonData->findSlot(attachmentsMap->_name);
 				Json *attachmentMap;
 
@@ -587,6 +595,8 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 								_attachmentLoader->configureAttachment(mesh);
 							} else {
 								bool inheritDeform = Json::getInt(attachmentMap, "deform", 1) ? true : false;
+								// Linked meshes are owned by the loader, not the skeleton data.
+								ArenaScope noArena(NULL);
 								LinkedMesh *linkedMesh = new(__FILE__, __LINE__) LinkedMesh(mesh,
 									String(Json::getString(attachmentMap, "skin", 0)), slot->getIndex(), String(entry->_valueString),
 									inheritDeform);
@@ -645,6 +655,7 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 							if (end) clip->_endSlot = skeletonData->findSlot(end);
 							vertexCount = Json::getInt(attachmentMap, "vertexCount", 0) << 1;
 							readVertices(attachmentMap, clip, vertexCount);
+							clip->updateConvexPolygons();
 							_attachmentLoader->configureAttachment(attachment);
 							break;
 						}
@@ -655,6 +666,7 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 			}
 		}
 	}
+	skeletonData->updateNameIndex();
 
 	/* Linked meshes. */
 	int n = _linkedMeshes.size();
@@ -702,6 +714,7 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 			skeletonData->_events[i] = eventData;
 		}
 	}
+	skeletonData->updateNameIndex();
 
 	/* Animations. */
 	animations = Json::getItem(root, "animations");
@@ -721,6 +734,10 @@ SkeletonData *SkeletonJson::readSkeletonData(const char *json) {
 		}
 	}
 
+	skeletonData->updateNameIndex();
+	skeletonData->updateAttachmentHandles();
+	skeletonData->updateConstraintOrder();
+
 	delete root;
 
 	return skeletonData;
@@ -754,7 +771,7 @@ void SkeletonJson::readCurve(Json *frame, CurveTimeline *timeline, size_t frameI
 		float c2 = Json::getFloat(frame, "c2", 0);
 		float c3 = Json::getFloat(frame, "c3", 1);
 		float c4 = Json::getFloat(frame, "c4", 1);
-		timeline->setCurve(frameIndex, c1, c2, c3, c4);
+		timeline->setCurve(frameIndex, c1, c2, c3, c4, _curveMode);
 	}
 }
 
@@ -1223,6 +1240,7 @@ void SkeletonJson::readVertices(Json *attachmentMap, VertexAttachment *attachmen
 }
 
 void SkeletonJson::setError(Json *root, const String &value1, const String &value2) {
+	ArenaScope noArena(NULL);
 	_error = String(value1).append(value2);
 	delete root;
 }
@@ -0,0 +1,138 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifdef SPINE_UE4
+#include "SpinePluginPrivatePCH.h"
+#endif
+
+#include <spine/SkeletonPose.h>
+
+#include <spine/Bone.h>
+#include <spine/RegionAttachment.h>
+#include <spine/Skeleton.h>
+#include <spine/Slot.h>
+#include <spine/SlotData.h>
+#include <spine/VertexAttachment.h>
+
+using namespace spine;
+
+SkeletonPose::SkeletonPose() {
+}
+
+size_t SkeletonPose::getBoneCount() {
+	return _boneTransforms.size() / 6;
+}
+
+Vector<float> &SkeletonPose::getBoneTransforms() {
+	return _boneTransforms;
+}
+
+size_t SkeletonPose::getSlotCount() {
+	return _attachments.size();
+}
+
+Vector<int> &SkeletonPose::getDrawOrder() {
+	return _drawOrder;
+}
+
+Attachment *SkeletonPose::getAttachment(size_t slotIndex) {
+	return _attachments[slotIndex];
+}
+
+Color &SkeletonPose::getColor(size_t slotIndex) {
+	return _colors[slotIndex];
+}
+
+Color &SkeletonPose::getDarkColor(size_t slotIndex) {
+	return _darkColors[slotIndex];
+}
+
+size_t SkeletonPose::getVerticesLength(size_t slotIndex) {
+	return _vertexOffsets[slotIndex + 1] - _vertexOffsets[slotIndex];
+}
+
+float *SkeletonPose::getVertices(size_t slotIndex) {
+	return getVerticesLength(slotIndex) ? _vertices.buffer() + _vertexOffsets[slotIndex] : NULL;
+}
+
+void SkeletonPose::capture(Skeleton &skeleton) {
+	Vector<Bone *> &bones = skeleton.getBones();
+	_boneTransforms.setSize(bones.size() * 6, 0);
+	float *transforms = _boneTransforms.buffer();
+	for (size_t i = 0, n = bones.size(); i < n; i++, transforms += 6) {
+		Bone &bone = *bones[i];
+		transforms[0] = bone.getA();
+		transforms[1] = bone.getB();
+		transforms[2] = bone.getC();
+		transforms[3] = bone.getD();
+		transforms[4] = bone.getWorldX();
+		transforms[5] = bone.getWorldY();
+	}
+
+	Vector<Slot *> &drawOrder = skeleton.getDrawOrder();
+	_drawOrder.setSize(drawOrder.size(), 0);
+	for (size_t i = 0, n = drawOrder.size(); i < n; i++)
+		_drawOrder[i] = drawOrder[i]->getData().getIndex();
+
+	// Size the vertices first so computing them writes straight into the final buffer.
+	Vector<Slot *> &slots = skeleton.getSlots();
+	size_t slotCount = slots.size();
+	_attachments.setSize(slotCount, NULL);
+	_colors.setSize(slotCount, Color());
+	_darkColors.setSize(slotCount, Color());
+	_vertexOffsets.setSize(slotCount + 1, 0);
+	size_t verticesLength = 0;
+	for (size_t i = 0; i < slotCount; i++) {
+		Slot &slot = *slots[i];
+		Attachment *attachment = slot.getAttachment();
+		_attachments[i] = attachment;
+		_colors[i] = slot.getColor();
+		_darkColors[i] = slot.getDarkColor();
+		_vertexOffsets[i] = verticesLength;
+		if (attachment == NULL) continue;
+		if (attachment->getRTTI().isExactly(RegionAttachment::rtti))
+			verticesLength += 8;
+		else if (attachment->getRTTI().instanceOf(VertexAttachment::rtti))
+			verticesLength += static_cast<VertexAttachment *>(attachment)->getWorldVerticesLength();
+	}
+	_vertexOffsets[slotCount] = verticesLength;
+
+	_vertices.setSize(verticesLength, 0);
+	for (size_t i = 0; i < slotCount; i++) {
+		size_t length = getVerticesLength(i);
+		if (length == 0) continue;
+		Slot &slot = *slots[i];
+		Attachment *attachment = _attachments[i];
+		if (attachment->getRTTI().isExactly(RegionAttachment::rtti))
+			static_cast<RegionAttachment *>(attachment)->computeWorldVertices(slot.getBone(), _vertices.buffer(), _vertexOffsets[i], 2);
+		else
+			static_cast<VertexAttachment *>(attachment)->computeWorldVertices(slot, 0, length, _vertices.buffer(), _vertexOffsets[i], 2);
+	}
+}
@@ -0,0 +1,98 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifdef SPINE_UE4
+#include "SpinePluginPrivatePCH.h"
+#endif
+
+#include <spine/SkeletonPoseCache.h>
+
+#include <spine/Animation.h>
+#include <spine/Skeleton.h>
+#include <spine/SkeletonPose.h>
+
+using namespace spine;
+
+SkeletonPoseCache::SkeletonPoseCache(SkeletonData *skeletonData, float framesPerSecond) :
+		_skeletonData(skeletonData),
+		_skeleton(new(__FILE__, __LINE__) Skeleton(skeletonData)),
+		_framesPerSecond(framesPerSecond) {
+	assert(framesPerSecond > 0);
+}
+
+SkeletonPoseCache::~SkeletonPoseCache() {
+	clear();
+	delete _skeleton;
+}
+
+SkeletonPose *SkeletonPoseCache::getPose(Animation *animation, float time, bool loop, Skin *skin) {
+	float duration = animation ? animation->getDuration() : 0;
+	if (loop && duration > 0)
+		time = MathUtil::fmod(time, duration);
+	else if (time > duration)
+		time = duration;
+	if (time < 0) time = 0;
+	Key key(animation, skin, (int) (time * _framesPerSecond));
+
+	if (_poses.containsKey(key)) return _poses[key];
+
+	Skeleton &skeleton = *_skeleton;
+	skeleton.setSkin(skin);
+	skeleton.setToSetupPose();
+	if (animation) {
+		float frameTime = key.frame / _framesPerSecond;
+		animation->apply(skeleton, frameTime, frameTime, false, NULL, 1, MixBlend_Setup, MixDirection_In);
+	}
+	skeleton.updateWorldTransform();
+
+	SkeletonPose *pose = new(__FILE__, __LINE__) SkeletonPose();
+	pose->capture(skeleton);
+	_poses.put(key, pose);
+	return pose;
+}
+
+void SkeletonPoseCache::clear() {
+	HashMap<Key, SkeletonPose *>::Entries entries = _poses.getEntries();
+	while (entries.hasNext())
+		delete entries.next().value;
+	_poses.clear();
+}
+
+size_t SkeletonPoseCache::size() {
+	return _poses.size();
+}
+
+SkeletonData *SkeletonPoseCache::getSkeletonData() {
+	return _skeletonData;
+}
+
+float SkeletonPoseCache::getFramesPerSecond() {
+	return _framesPerSecond;
+}
@@ -0,0 +1,389 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifdef SPINE_UE4
+#include "SpinePluginPrivatePCH.h"
+#endif
+
+#include <spine/SkeletonSnapshot.h>
+
+#include <spine/AnimationState.h>
+#include <spine/Bone.h>
+#include <spine/IkConstraint.h>
+#include <spine/PathConstraint.h>
+#include <spine/Skeleton.h>
+#include <spine/Slot.h>
+#include <spine/SlotData.h>
+#include <spine/TransformConstraint.h>
+
+using namespace spine;
+
+SkeletonSnapshot::SkeletonSnapshot() : _buffer(NULL), _size(0), _capacity(0), _position(0) {
+}
+
+SkeletonSnapshot::~SkeletonSnapshot() {
+	SpineExtension::free(_buffer, __FILE__, __LINE__);
+}
+
+void SkeletonSnapshot::capture(Skeleton &skeleton, AnimationState *state) {
+	_size = 0;
+	write(skeleton._bones.size());
+	write(skeleton._slots.size());
+	write(state != NULL);
+
+	write(skeleton._skin);
+	writeColor(skeleton._color);
+	write(skeleton._time);
+	write(skeleton._scaleX);
+	write(skeleton._scaleY);
+	write(skeleton._x);
+	write(skeleton._y);
+
+	for (size_t i = 0, n = skeleton._bones.size(); i < n; i++) {
+		Bone &bone = *skeleton._bones[i];
+		float values[20] = {
+			bone._x, bone._y, bone._rotation, bone._scaleX, bone._scaleY, bone._shearX, bone._shearY,
+			bone._ax, bone._ay, bone._arotation, bone._ascaleX, bone._ascaleY, bone._ashearX, bone._ashearY,
+			bone._a, bone._b, bone._worldX, bone._c, bone._d, bone._worldY
+		};
+		writeFloats(values, 20);
+		write(bone._appliedValid);
+	}
+
+	for (size_t i = 0, n = skeleton._slots.size(); i < n; i++) {
+		Slot &slot = *skeleton._slots[i];
+		writeColor(slot._color);
+		writeColor(slot._darkColor);
+		write(slot._attachment);
+		write(slot._attachmentState);
+		write(slot._attachmentTime);
+		write(slot.getDeformLength());
+		writeFloats(slot.getDeformVertices(), slot.getDeformLength());
+	}
+
+	for (size_t i = 0, n = skeleton._drawOrder.size(); i < n; i++)
+		write(skeleton._drawOrder[i]->_data.getIndex());
+
+	for (size_t i = 0, n = skeleton._ikConstraints.size(); i < n; i++) {
+		IkConstraint &constraint = *skeleton._ikConstraints[i];
+		write(constraint._bendDirection);
+		write(constraint._compress);
+		write(constraint._stretch);
+		write(constraint._mix);
+		write(constraint._softness);
+	}
+
+	for (size_t i = 0, n = skeleton._transformConstraints.size(); i < n; i++) {
+		TransformConstraint &constraint = *skeleton._transformConstraints[i];
+		float values[4] = {constraint._rotateMix, constraint._translateMix, constraint._scaleMix, constraint._shearMix};
+		writeFloats(values, 4);
+	}
+
+	for (size_t i = 0, n = skeleton._pathConstraints.size(); i < n; i++) {
+		PathConstraint &constraint = *skeleton._pathConstraints[i];
+		float values[4] = {constraint._position, constraint._spacing, constraint._rotateMix, constraint._translateMix};
+		writeFloats(values, 4);
+	}
+
+	if (state == NULL) return;
+
+	write(state->_timeScale);
+	write(state->_unkeyedState);
+	write(state->_tracks.size());
+	for (size_t i = 0, n = state->_tracks.size(); i < n; i++) {
+		TrackEntry *current = state->_tracks[i];
+		size_t fromCount = 0, nextCount = 0;
+		if (current != NULL) {
+			for (TrackEntry *from = current->_mixingFrom; from != NULL; from = from->_mixingFrom)
+				fromCount++;
+			for (TrackEntry *next = current->_next; next != NULL; next = next->_next)
+				nextCount++;
+		}
+		write(current != NULL);
+		if (current == NULL) continue;
+		write(fromCount);
+		write(nextCount);
+		writeEntry(*current);
+		for (TrackEntry *from = current->_mixingFrom; from != NULL; from = from->_mixingFrom)
+			writeEntry(*from);
+		for (TrackEntry *next = current->_next; next != NULL; next = next->_next)
+			writeEntry(*next);
+	}
+}
+
+void SkeletonSnapshot::restore(Skeleton &skeleton, AnimationState *state) {
+	_position = 0;
+	size_t boneCount, slotCount;
+	bool hasState;
+	read(boneCount);
+	read(slotCount);
+	read(hasState);
+	assert(boneCount == skeleton._bones.size() && slotCount == skeleton._slots.size());
+	assert(hasState || state == NULL);
+
+	Skin *skin;
+	read(skin);
+	if (skin != skeleton._skin) {
+		// Attachments are restored below, only which bones and constraints are active depends on the skin.
+		skeleton._skin = skin;
+		skeleton.clearAttachmentCache();
+		skeleton.updateCache();
+	}
+	readColor(skeleton._color);
+	read(skeleton._time);
+	read(skeleton._scaleX);
+	read(skeleton._scaleY);
+	read(skeleton._x);
+	read(skeleton._y);
+
+	for (size_t i = 0; i < boneCount; i++) {
+		Bone &bone = *skeleton._bones[i];
+		float values[20];
+		readFloats(values, 20);
+		bone._x = values[0];
+		bone._y = values[1];
+		bone._rotation = values[2];
+		bone._scaleX = values[3];
+		bone._scaleY = values[4];
+		bone._shearX = values[5];
+		bone._shearY = values[6];
+		bone._ax = values[7];
+		bone._ay = values[8];
+		bone._arotation = values[9];
+		bone._ascaleX = values[10];
+		bone._ascaleY = values[11];
+		bone._ashearX = values[12];
+		bone._ashearY = values[13];
+		bone._a = values[14];
+		bone._b = values[15];
+		bone._worldX = values[16];
+		bone._c = values[17];
+		bone._d = values[18];
+		bone._worldY = values[19];
+		read(bone._appliedValid);
+	}
+
+	for (size_t i = 0; i < slotCount; i++) {
+		Slot &slot = *skeleton._slots[i];
+		readColor(slot._color);
+		readColor(slot._darkColor);
+		read(slot._attachment);
+		read(slot._attachmentState);
+		read(slot._attachmentTime);
+		size_t deformCount;
+		read(deformCount);
+		slot._deformAlias = NULL;
+		slot._deform.setSize(deformCount, 0);
+		readFloats(slot._deform.buffer(), deformCount);
+	}
+
+	for (size_t i = 0, n = skeleton._drawOrder.size(); i < n; i++) {
+		int index;
+		read(index);
+		skeleton._drawOrder[i] = skeleton._slots[index];
+	}
+
+	for (size_t i = 0, n = skeleton._ikConstraints.size(); i < n; i++) {
+		IkConstraint &constraint = *skeleton._ikConstraints[i];
+		read(constraint._bendDirection);
+		read(constraint._compress);
+		read(constraint._stretch);
+		read(constraint._mix);
+		read(constraint._softness);
+	}
+
+	for (size_t i = 0, n = skeleton._transformConstraints.size(); i < n; i++) {
+		TransformConstraint &constraint = *skeleton._transformConstraints[i];
+		float values[4];
+		readFloats(values, 4);
+		constraint._rotateMix = values[0];
+		constraint._translateMix = values[1];
+		constraint._scaleMix = values[2];
+		constraint._shearMix = values[3];
+	}
+
+	for (size_t i = 0, n = skeleton._pathConstraints.size(); i < n; i++) {
+		PathConstraint &constraint = *skeleton._pathConstraints[i];
+		float values[4];
+		readFloats(values, 4);
+		constraint._position = values[0];
+		constraint._spacing = values[1];
+		constraint._rotateMix = values[2];
+		constraint._translateMix = values[3];
+	}
+
+	if (state == NULL) return;
+
+	// Return the current entries to the pool without raising events.
+	Vector<TrackEntry *> &tracks = state->_tracks;
+	for (size_t i = 0, n = tracks.size(); i < n; i++) {
+		TrackEntry *current = tracks[i];
+		if (current == NULL) continue;
+		for (TrackEntry *entry = current->_next; entry != NULL;) {
+			TrackEntry *next = entry->_next;
+			entry->reset();
+			state->_trackEntryPool.free(entry);
+			entry = next;
+		}
+		for (TrackEntry *entry = current; entry != NULL;) {
+			TrackEntry *from = entry->_mixingFrom;
+			entry->reset();
+			state->_trackEntryPool.free(entry);
+			entry = from;
+		}
+	}
+
+	read(state->_timeScale);
+	read(state->_unkeyedState);
+	size_t trackCount;
+	read(trackCount);
+	tracks.clear();
+	tracks.setSize(trackCount, NULL);
+	for (size_t i = 0; i < trackCount; i++) {
+		bool hasCurrent;
+		read(hasCurrent);
+		if (!hasCurrent) continue;
+		size_t fromCount, nextCount;
+		read(fromCount);
+		read(nextCount);
+		TrackEntry *current = readEntry(*state);
+		tracks[i] = current;
+		TrackEntry *to = current;
+		for (size_t ii = 0; ii < fromCount; ii++) {
+			TrackEntry *from = readEntry(*state);
+			to->_mixingFrom = from;
+			from->_mixingTo = to;
+			to = from;
+		}
+		TrackEntry *last = current;
+		for (size_t ii = 0; ii < nextCount; ii++) {
+			TrackEntry *next = readEntry(*state);
+			last->_next = next;
+			last = next;
+		}
+	}
+	state->_animationsChanged = true;
+}
+
+const unsigned char *SkeletonSnapshot::getData() {
+	return _buffer;
+}
+
+size_t SkeletonSnapshot::size() {
+	return _size;
+}
+
+void SkeletonSnapshot::grow(size_t size) {
+	_capacity = MathUtil::max(_capacity * 2, _size + size);
+	_buffer = SpineExtension::realloc(_buffer, _capacity, __FILE__, __LINE__);
+}
+
+void SkeletonSnapshot::writeFloats(const float *values, size_t count) {
+	size_t bytes = count * sizeof(float);
+	if (_size + bytes > _capacity) grow(bytes);
+	if (bytes) memcpy(_buffer + _size, values, bytes);
+	_size += bytes;
+}
+
+void SkeletonSnapshot::readFloats(float *values, size_t count) {
+	size_t bytes = count * sizeof(float);
+	assert(_position + bytes <= _size);
+	if (bytes) memcpy(values, _buffer + _position, bytes);
+	_position += bytes;
+}
+
+void SkeletonSnapshot::writeColor(Color &color) {
+	float values[4] = {color.r, color.g, color.b, color.a};
+	writeFloats(values, 4);
+}
+
+void SkeletonSnapshot::readColor(Color &color) {
+	float values[4];
+	readFloats(values, 4);
+	color.r = values[0];
+	color.g = values[1];
+	color.b = values[2];
+	color.a = values[3];
+}
+
+void SkeletonSnapshot::writeEntry(TrackEntry &entry) {
+	write(entry._animation);
+	write(entry._trackIndex);
+	write(entry._loop);
+	write(entry._holdPrevious);
+	write(entry._mixBlend);
+	write(entry._listener);
+	write(entry._listenerObject);
+	float values[18] = {
+		entry._eventThreshold, entry._attachmentThreshold, entry._drawOrderThreshold,
+		entry._animationStart, entry._animationEnd, entry._animationLast, entry._nextAnimationLast,
+		entry._delay, entry._trackTime, entry._trackLast, entry._nextTrackLast, entry._trackEnd, entry._timeScale,
+		entry._alpha, entry._mixTime, entry._mixDuration, entry._interruptAlpha, entry._totalAlpha
+	};
+	writeFloats(values, 18);
+	write(entry._timelinesRotation.size());
+	writeFloats(entry._timelinesRotation.buffer(), entry._timelinesRotation.size());
+}
+
+TrackEntry *SkeletonSnapshot::readEntry(AnimationState &state) {
+	TrackEntry &entry = *state._trackEntryPool.obtain();
+	read(entry._animation);
+	read(entry._trackIndex);
+	read(entry._loop);
+	read(entry._holdPrevious);
+	read(entry._mixBlend);
+	read(entry._listener);
+	read(entry._listenerObject);
+	float values[18];
+	readFloats(values, 18);
+	entry._eventThreshold = values[0];
+	entry._attachmentThreshold = values[1];
+	entry._drawOrderThreshold = values[2];
+	entry._animationStart = values[3];
+	entry._animationEnd = values[4];
+	entry._animationLast = values[5];
+	entry._nextAnimationLast = values[6];
+	entry._delay = values[7];
+	entry._trackTime = values[8];
+	entry._trackLast = values[9];
+	entry._nextTrackLast = values[10];
+	entry._trackEnd = values[11];
+	entry._timeScale = values[12];
+	entry._alpha = values[13];
+	entry._mixTime = values[14];
+	entry._mixDuration = values[15];
+	entry._interruptAlpha = values[16];
+	entry._totalAlpha = values[17];
+	size_t rotationCount;
+	read(rotationCount);
+	entry._timelinesRotation.setSize(rotationCount, 0);
+	readFloats(entry._timelinesRotation.buffer(), rotationCount);
+	return &entry;
+}
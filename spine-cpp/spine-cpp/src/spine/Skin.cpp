@@ -128,11 +128,10 @@ void Skin::findNamesForSlot(size_t slotIndex, Vector<String> &names) {
 }
 
 void Skin::findAttachmentsForSlot(size_t slotIndex, Vector<Attachment *> &attachments) {
-	Skin::AttachmentMap::Entries entries = _attachments.getEntries();
-	while (entries.hasNext()) {
-		Skin::AttachmentMap::Entry &entry = entries.next();
-		if (entry._slotIndex == slotIndex) attachments.add(entry._attachment);
-	}
+	if (slotIndex >= _attachments._buckets.size()) return;
+	Vector<AttachmentMap::Entry> &bucket = _attachments._buckets[slotIndex];
+	for (size_t i = 0, n = bucket.size(); i < n; i++)
+		attachments.add(bucket[i]._attachment);
 }
 
 const String &Skin::getName() {
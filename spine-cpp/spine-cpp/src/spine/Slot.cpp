@@ -49,7 +49,9 @@ Slot::Slot(SlotData &data, Bone &bone) :
 		_hasDarkColor(data.hasDarkColor()),
 		_attachment(NULL),
 		_attachmentState(0),
-		_attachmentTime(0) {
+		_attachmentTime(0),
+		_deformAlias(NULL),
+		_deformAliasLength(0) {
 	setToSetupPose();
 }
 
@@ -60,7 +62,7 @@ void Slot::setToSetupPose() {
 	const String &attachmentName = _data.getAttachmentName();
 	if (attachmentName.length() > 0) {
 		_attachment = NULL;
-		setAttachment(_skeleton.getAttachment(_data.getIndex(), attachmentName));
+		setAttachment(_skeleton.getAttachment(_data.getIndex(), _data.getAttachmentHandle(), attachmentName));
 	} else {
 		setAttachment(NULL);
 	}
@@ -101,7 +103,7 @@ void Slot::setAttachment(Attachment *inValue) {
 
 	_attachment = inValue;
 	_attachmentTime = _skeleton.getTime();
-	_deform.clear();
+	clearDeform();
 }
 
 int Slot::getAttachmentState() {
@@ -121,5 +123,42 @@ void Slot::setAttachmentTime(float inValue) {
 }
 
 Vector<float> &Slot::getDeform() {
+	if (_deformAlias) copyDeformAlias();
 	return _deform;
 }
+
+const float *Slot::getDeformVertices() {
+	if (_deformAlias) return _deformAlias;
+	return _deform.size() > 0 ? _deform.buffer() : NULL;
+}
+
+size_t Slot::getDeformLength() {
+	return _deformAlias ? _deformAliasLength : _deform.size();
+}
+
+void Slot::setDeformAlias(const float *vertices, size_t length) {
+	_deformAlias = vertices;
+	_deformAliasLength = length;
+}
+
+void Slot::copyDeformAlias() {
+	_deform.setSize(_deformAliasLength, 0);
+	memcpy(_deform.buffer(), _deformAlias, _deformAliasLength * sizeof(float));
+	_deformAlias = NULL;
+}
+
+float *Slot::resizeDeform(size_t length, bool keep) {
+	if (_deformAlias) {
+		if (keep)
+			copyDeformAlias();
+		else
+			_deformAlias = NULL;
+	}
+	_deform.setSize(length, 0);
+	return _deform.buffer();
+}
+
+void Slot::clearDeform() {
+	_deform.clear();
+	_deformAlias = NULL;
+}
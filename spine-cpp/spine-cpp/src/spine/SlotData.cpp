@@ -45,6 +45,7 @@ SlotData::SlotData(int index, const String &name, BoneData &boneData) :
 		_darkColor(0, 0, 0, 0),
 		_hasDarkColor(false),
 		_attachmentName(),
+		_attachmentHandle(-1),
 		_blendMode(BlendMode_Normal) {
 	assert(_index >= 0);
 	assert(_name.length() > 0);
@@ -84,6 +85,11 @@ const String &SlotData::getAttachmentName() {
 
 void SlotData::setAttachmentName(const String &inValue) {
 	_attachmentName = inValue;
+	_attachmentHandle = -1;
+}
+
+int SlotData::getAttachmentHandle() {
+	return _attachmentHandle;
 }
 
 BlendMode SlotData::getBlendMode() {
@@ -0,0 +1,256 @@
+/******************************************************************************
+ * Spine Runtimes License Agreement
+ * Last updated January 1, 2020. Replaces all prior versions.
+ *
+ * Copyright (c) 2013-2020, Esoteric Software LLC
+ *
+ * Integration of the Spine Runtimes into software or otherwise creating
+ * derivative works of the Spine Runtimes is permitted under the terms and
+ * conditions of Section 2 of the Spine Editor License Agreement:
+ * http://esotericsoftware.com/spine-editor-license
+ *
+ * Otherwise, it is permitted to integrate the Spine Runtimes into software
+ * or otherwise create derivative works of the Spine Runtimes (collectively,
+ * "Products"), provided that each user of the Products must obtain their own
+ * Spine Editor license and redistribution of the Products in any form must
+ * include this license and copyright notice.
+ *
+ * THE SPINE RUNTIMES ARE PROVIDED BY ESOTERIC SOFTWARE LLC "AS IS" AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL ESOTERIC SOFTWARE LLC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES,
+ * BUSINESS INTERRUPTION, OR LOSS OF USE, DATA, OR PROFITS) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+ * THE SPINE RUNTIMES, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *****************************************************************************/
+
+
+#ifdef SPINE_UE4
+#include "SpinePluginPrivatePCH.h"
+#endif
+
+#include <spine/Threading.h>
+
+#include <stdlib.h>
+
+#if defined(SPINE_NO_THREADS)
+#elif defined(_WIN32)
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+using namespace spine;
+
+#if defined(SPINE_NO_THREADS)
+
+Mutex::Mutex() : _handle(NULL) {
+}
+
+Mutex::~Mutex() {
+}
+
+void Mutex::lock() {
+}
+
+void Mutex::unlock() {
+}
+
+Condition::Condition() : _handle(NULL) {
+}
+
+Condition::~Condition() {
+}
+
+void Condition::wait(Mutex &) {
+}
+
+void Condition::signal() {
+}
+
+void Condition::broadcast() {
+}
+
+bool Thread::start(Function, void *) {
+	return false;
+}
+
+void Thread::join() {
+}
+
+int Thread::getProcessorCount() {
+	return 1;
+}
+
+#else
+
+struct ThreadStart {
+	Thread::Function function;
+	void *argument;
+};
+
+static ThreadStart *newThreadStart(Thread::Function function, void *argument) {
+	ThreadStart *start = (ThreadStart *) ::malloc(sizeof(ThreadStart));
+	start->function = function;
+	start->argument = argument;
+	return start;
+}
+
+/// Runs on the new thread, which owns the start parameters.
+static void runThreadStart(ThreadStart *start) {
+	Thread::Function function = start->function;
+	void *argument = start->argument;
+	::free(start);
+	function(argument);
+}
+
+#endif
+
+#if defined(SPINE_NO_THREADS)
+#elif defined(_WIN32)
+
+Mutex::Mutex() : _handle(::malloc(sizeof(CRITICAL_SECTION))) {
+	InitializeCriticalSection((CRITICAL_SECTION *) _handle);
+}
+
+Mutex::~Mutex() {
+	DeleteCriticalSection((CRITICAL_SECTION *) _handle);
+	::free(_handle);
+}
+
+void Mutex::lock() {
+	EnterCriticalSection((CRITICAL_SECTION *) _handle);
+}
+
+void Mutex::unlock() {
+	LeaveCriticalSection((CRITICAL_SECTION *) _handle);
+}
+
+Condition::Condition() : _handle(::malloc(sizeof(CONDITION_VARIABLE))) {
+	InitializeConditionVariable((CONDITION_VARIABLE *) _handle);
+}
+
+Condition::~Condition() {
+	::free(_handle);
+}
+
+void Condition::wait(Mutex &mutex) {
+	SleepConditionVariableCS((CONDITION_VARIABLE *) _handle, (CRITICAL_SECTION *) mutex._handle, INFINITE);
+}
+
+void Condition::signal() {
+	WakeConditionVariable((CONDITION_VARIABLE *) _handle);
+}
+
+void Condition::broadcast() {
+	WakeAllConditionVariable((CONDITION_VARIABLE *) _handle);
+}
+
+static DWORD WINAPI threadEntry(LPVOID start) {
+	runThreadStart((ThreadStart *) start);
+	return 0;
+}
+
+bool Thread::start(Function function, void *argument) {
+	if (_handle) return false;
+	ThreadStart *start = newThreadStart(function, argument);
+	_handle = CreateThread(NULL, 0, threadEntry, start, 0, NULL);
+	if (!_handle) ::free(start);
+	return _handle != NULL;
+}
+
+void Thread::join() {
+	if (!_handle) return;
+	WaitForSingleObject((HANDLE) _handle, INFINITE);
+	CloseHandle((HANDLE) _handle);
+	_handle = NULL;
+}
+
+int Thread::getProcessorCount() {
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	return info.dwNumberOfProcessors > 0 ? (int) info.dwNumberOfProcessors : 1;
+}
+
+#else
+
+Mutex::Mutex() : _handle(::malloc(sizeof(pthread_mutex_t))) {
+	pthread_mutex_init((pthread_mutex_t *) _handle, NULL);
+}
+
+Mutex::~Mutex() {
+	pthread_mutex_destroy((pthread_mutex_t *) _handle);
+	::free(_handle);
+}
+
+void Mutex::lock() {
+	pthread_mutex_lock((pthread_mutex_t *) _handle);
+}
+
+void Mutex::unlock() {
+	pthread_mutex_unlock((pthread_mutex_t *) _handle);
+}
+
+Condition::Condition() : _handle(::malloc(sizeof(pthread_cond_t))) {
+	pthread_cond_init((pthread_cond_t *) _handle, NULL);
+}
+
+Condition::~Condition() {
+	pthread_cond_destroy((pthread_cond_t *) _handle);
+	::free(_handle);
+}
+
+void Condition::wait(Mutex &mutex) {
+	pthread_cond_wait((pthread_cond_t *) _handle, (pthread_mutex_t *) mutex._handle);
+}
+
+void Condition::signal() {
+	pthread_cond_signal((pthread_cond_t *) _handle);
+}
+
+void Condition::broadcast() {
+	pthread_cond_broadcast((pthread_cond_t *) _handle);
+}
+
+static void *threadEntry(void *start) {
+	runThreadStart((ThreadStart *) start);
+	return NULL;
+}
+
+bool Thread::start(Function function, void *argument) {
+	if (_handle) return false;
+	ThreadStart *start = newThreadStart(function, argument);
+	pthread_t *handle = (pthread_t *) ::malloc(sizeof(pthread_t));
+	if (pthread_create(handle, NULL, threadEntry, start) != 0) {
+		::free(handle);
+		::free(start);
+		return false;
+	}
+	_handle = handle;
+	return true;
+}
+
+void Thread::join() {
+	if (!_handle) return;
+	pthread_join(*(pthread_t *) _handle, NULL);
+	::free(_handle);
+	_handle = NULL;
+}
+
+int Thread::getProcessorCount() {
+	long count = sysconf(_SC_NPROCESSORS_ONLN);
+	return count > 0 ? (int) count : 1;
+}
+
+#endif
+
+Thread::Thread() : _handle(NULL) {
+}
+
+Thread::~Thread() {
+	join();
+}
@@ -40,6 +40,7 @@
 #include <spine/SlotData.h>
 #include <spine/Bone.h>
 #include <spine/BoneData.h>
+#include <spine/QuantizedFrames.h>
 
 using namespace spine;
 
@@ -52,12 +53,13 @@ const int TranslateTimeline::PREV_Y = -1;
 const int TranslateTimeline::X = 1;
 const int TranslateTimeline::Y = 2;
 
-TranslateTimeline::TranslateTimeline(int frameCount) : CurveTimeline(frameCount), _boneIndex(0) {
+TranslateTimeline::TranslateTimeline(int frameCount) : CurveTimeline(frameCount), _boneIndex(0), _quantized(NULL) {
 	_frames.ensureCapacity(frameCount * ENTRIES);
 	_frames.setSize(frameCount * ENTRIES, 0);
 }
 
 TranslateTimeline::~TranslateTimeline() {
+	delete _quantized;
 }
 
 void TranslateTimeline::apply(Skeleton &skeleton, float lastTime, float time, Vector<Event *> *pEvents, float alpha,
@@ -65,13 +67,27 @@ void TranslateTimeline::apply(Skeleton &skeleton, float lastTime, float time, Ve
 ) {
 	SP_UNUSED(lastTime);
 	SP_UNUSED(pEvents);
-	SP_UNUSED(direction);
 
 	Bone *boneP = skeleton._bones[_boneIndex];
 	Bone &bone = *boneP;
 	if (!bone._active) return;
 
-	if (time < _frames[0]) {
+	if (_quantized) {
+		float window[QuantizedFrames::MAX_WINDOW_SIZE];
+		int firstFrame, size = _quantized->decode(time, window, firstFrame);
+		applyFrames(bone, window, size, getCurve(firstFrame), time, alpha, blend, direction, NULL);
+		return;
+	}
+
+	applyFrames(bone, _frames.buffer(), (int)_frames.size(), getCurves().buffer(), time, alpha, blend, direction, NULL);
+}
+
+void TranslateTimeline::applyFrames(Bone &bone, const float *frames, int size, const float *curves, float time, float alpha,
+	MixBlend blend, MixDirection direction, int *cursor
+) {
+	SP_UNUSED(direction);
+
+	if (time < frames[0]) {
 		switch (blend) {
 		case MixBlend_Setup:
 			bone._x = bone._data._x;
@@ -86,21 +102,21 @@ void TranslateTimeline::apply(Skeleton &skeleton, float lastTime, float time, Ve
 	}
 
 	float x, y;
-	if (time >= _frames[_frames.size() - ENTRIES]) {
+	if (time >= frames[size - ENTRIES]) {
 		// Time is after last frame.
-		x = _frames[_frames.size() + PREV_X];
-		y = _frames[_frames.size() + PREV_Y];
+		x = frames[size + PREV_X];
+		y = frames[size + PREV_Y];
 	} else {
 		// Interpolate between the previous frame and the current frame.
-		int frame = Animation::binarySearch(_frames, time, ENTRIES);
-		x = _frames[frame + PREV_X];
-		y = _frames[frame + PREV_Y];
-		float frameTime = _frames[frame];
-		float percent = getCurvePercent(frame / ENTRIES - 1,
-			1 - (time - frameTime) / (_frames[frame + PREV_TIME] - frameTime));
-
-		x += (_frames[frame + X] - x) * percent;
-		y += (_frames[frame + Y] - y) * percent;
+		int frame = Animation::search(frames, size, time, ENTRIES, cursor);
+		x = frames[frame + PREV_X];
+		y = frames[frame + PREV_Y];
+		float frameTime = frames[frame];
+		float percent = getCurvePercent(curves, frame / ENTRIES - 1,
+			1 - (time - frameTime) / (frames[frame + PREV_TIME] - frameTime));
+
+		x += (frames[frame + X] - x) * percent;
+		y += (frames[frame + Y] - y) * percent;
 	}
 
 	switch (blend) {
@@ -37,6 +37,7 @@
 
 #include <spine/Bone.h>
 #include <spine/Skeleton.h>
+#include <spine/SimdUtil.h>
 
 using namespace spine;
 
@@ -61,69 +62,83 @@ void VertexAttachment::computeWorldVertices(Slot &slot, size_t start, size_t cou
 }
 
 void VertexAttachment::computeWorldVertices(Slot &slot, size_t start, size_t count, float *worldVertices, size_t offset, size_t stride) {
-	count = offset + (count >> 1) * stride;
+	size_t vertexCount = count >> 1;
+	worldVertices += offset;
 	Skeleton &skeleton = slot._bone._skeleton;
-	Vector<float> *deformArray = &slot.getDeform();
-	Vector<float> *vertices = &_vertices;
+	const float *deformVertices = slot.getDeformVertices();
 	Vector<size_t> &bones = _bones;
 	if (bones.size() == 0) {
-		if (deformArray->size() > 0) vertices = deformArray;
+		const float *vertices = deformVertices ? deformVertices : _vertices.buffer();
 
 		Bone &bone = slot._bone;
-		float x = bone._worldX;
-		float y = bone._worldY;
-		float a = bone._a, b = bone._b, c = bone._c, d = bone._d;
-		for (size_t vv = start, w = offset; w < count; vv += 2, w += stride) {
-			float vx = (*vertices)[vv];
-			float vy = (*vertices)[vv + 1];
-			worldVertices[w] = vx * a + vy * b + x;
-			worldVertices[w + 1] = vx * c + vy * d + y;
-		}
+		SimdUtil::transform(vertices + start, vertexCount, bone._a, bone._b, bone._c, bone._d, bone._worldX,
+			bone._worldY, worldVertices, stride);
 		return;
 	}
 
-	int v = 0, skip = 0;
+	size_t v = 0, skip = 0;
 	for (size_t i = 0; i < start; i += 2) {
-		int n = bones[v];
+		size_t n = bones[v];
 		v += n + 1;
 		skip += n;
 	}
 
-	Vector<Bone *> &skeletonBones = skeleton.getBones();
-	if (deformArray->size() == 0) {
-		for (size_t w = offset, b = skip * 3; w < count; w += stride) {
-			float wx = 0, wy = 0;
-			int n = bones[v++];
-			n += v;
-			for (; v < n; v++, b += 3) {
-				Bone *boneP = skeletonBones[bones[v]];
-				Bone &bone = *boneP;
-				float vx = (*vertices)[b];
-				float vy = (*vertices)[b + 1];
-				float weight = (*vertices)[b + 2];
-				wx += (vx * bone._a + vy * bone._b + bone._worldX) * weight;
-				wy += (vx * bone._c + vy * bone._d + bone._worldY) * weight;
+	// The matrices of the influences of a block of vertices are gathered into a packed array first, so the transform itself
+	// only reads contiguous memory.
+	const size_t MaxInfluences = 128;
+	float matrices[MaxInfluences * SimdUtil::MatrixSize];
+	int influenceCounts[MaxInfluences];
+
+	Bone **skeletonBones = skeleton.getBones().buffer();
+	size_t *boneIndices = bones.buffer();
+	const float *localVertices = _vertices.buffer() + skip * 3;
+	const float *deform = deformVertices ? deformVertices + (skip << 1) : NULL;
+	for (size_t i = 0; i < vertexCount;) {
+		size_t blockVertices = 0, blockInfluences = 0;
+		float *matrix = matrices;
+		while (i + blockVertices < vertexCount && blockVertices < MaxInfluences) {
+			size_t n = boneIndices[v];
+			if (blockInfluences + n > MaxInfluences) break;
+			influenceCounts[blockVertices++] = (int) n;
+			blockInfluences += n;
+			for (size_t end = ++v + n; v < end; v++, matrix += SimdUtil::MatrixSize) {
+				Bone &bone = *skeletonBones[boneIndices[v]];
+				matrix[0] = bone._a;
+				matrix[1] = bone._c;
+				matrix[2] = bone._b;
+				matrix[3] = bone._d;
+				matrix[4] = bone._worldX;
+				matrix[5] = bone._worldY;
 			}
-			worldVertices[w] = wx;
-			worldVertices[w + 1] = wy;
 		}
-	} else {
-		for (size_t w = offset, b = skip * 3, f = skip << 1; w < count; w += stride) {
+
+		if (blockVertices == 0) {
+			// A single vertex with more influences than fit in a block.
+			size_t n = boneIndices[v++];
 			float wx = 0, wy = 0;
-			int n = bones[v++];
-			n += v;
-			for (; v < n; v++, b += 3, f += 2) {
-				Bone *boneP = skeletonBones[bones[v]];
-				Bone &bone = *boneP;
-				float vx = (*vertices)[b] + (*deformArray)[f];
-				float vy = (*vertices)[b + 1] + (*deformArray)[f + 1];
-				float weight = (*vertices)[b + 2];
+			for (size_t end = v + n; v < end; v++, localVertices += 3) {
+				Bone &bone = *skeletonBones[boneIndices[v]];
+				float vx = localVertices[0], vy = localVertices[1];
+				if (deform) {
+					vx += deform[0];
+					vy += deform[1];
+					deform += 2;
+				}
+				float weight = localVertices[2];
 				wx += (vx * bone._a + vy * bone._b + bone._worldX) * weight;
 				wy += (vx * bone._c + vy * bone._d + bone._worldY) * weight;
 			}
-			worldVertices[w] = wx;
-			worldVertices[w + 1] = wy;
+			worldVertices[i * stride] = wx;
+			worldVertices[i * stride + 1] = wy;
+			i++;
+			continue;
 		}
+
+		SimdUtil::transformWeighted(matrices, influenceCounts, blockVertices, localVertices, deform, worldVertices + i * stride,
+			stride);
+		localVertices += blockInfluences * 3;
+		if (deform) deform += blockInfluences << 1;
+		i += blockVertices;
 	}
 }
 
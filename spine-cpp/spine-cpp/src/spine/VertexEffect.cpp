@@ -100,7 +100,8 @@ void SwirlVertexEffect::transform(float &positionX, float &positionY, float &u,
 	float dist = (float)MathUtil::sqrt(x * x + y * y);
 	if (dist < _radius) {
 		float theta = _interpolation.interpolate(0, _angle, (_radius - dist) / _radius);
-		float cos = MathUtil::cos(theta), sin = MathUtil::sin(theta);
+		float cos, sin;
+		MathUtil::sinCos(theta, sin, cos);
 		positionX = cos * x - sin * y + _worldX;
 		positionY = sin * x + cos * y + _worldY;
 	}